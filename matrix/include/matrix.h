@@ -10,6 +10,7 @@
 
 #include <stdio.h>
 #include "matrix_typedef.h"
+#include "matrix_expr.h"
 
 namespace matrix
 {
@@ -17,19 +18,66 @@ namespace matrix
 /**
  * 행렬 표현 클래스
  */
-class	Matrix
+template<class T>
+class	BasicMatrix
 {
+public:
+	typedef	T											elem_t;		///< 요소 데이터 형식
+	typedef	typename elem_traits<T>::real_t				real_t;		///< 크기 (norm) 형식
+private:
+	struct		FuncInfo
+	{
+		const BasicMatrix*	matrix;
+		elem_t			alpha;
+		const elem_t*	vecX;
+		elem_t			beta;
+		elem_t*			vecY;
+		size_t			startRow;
+		size_t			endRow;		///< (미포함)
+	};
+
+	struct		CombineInfo
+	{
+		size_t					num;		///< 항 수
+		const elem_t*			coef;		///< 항 별 계수
+		const BasicMatrix* const*	operand;	///< 항 별 피연산자
+		elem_t*					result;		///< 결과 데이터
+		size_t					start;		///< 시작 요소 위치
+		size_t					end;		///< 종료 요소 위치 (미포함)
+	};
+
+	struct		GemmInfo
+	{
+		const elem_t*	a;			///< A 행렬 (요소 (i, p) = a[i * rsA + p * csA])
+		size_t			rsA;
+		size_t			csA;
+		const elem_t*	b;			///< B 행렬 (k x n, 행 우선)
+		elem_t*			c;			///< 결과 행렬 (m x n, 행 우선)
+		size_t			n;
+		size_t			k;
+		size_t			startRow;
+		size_t			endRow;		///< (미포함)
+		elem_t*			packA;		///< 작업 별 A 블록 버퍼
+		elem_t*			packB;		///< 작업 별 B 패널 버퍼
+	};
 private:
 	size_t		mRowSize;	///< 행 크기
 	size_t		mColSize;	///< 열 크기
 	elem_t*		mData;		///< 행렬 데이터
+
+	friend class	MatrixBuilder;
+	friend class	MatrixFile;
+	template<class, class>	friend class	BasicMatrixCSR;
 public:
-				Matrix			(	void	);
-				Matrix			(	size_t		row,
+				BasicMatrix			(	void	);
+				BasicMatrix			(	size_t		row,
 									size_t		col
 								);
-				Matrix			(	const Matrix&		matrix		);
-	virtual	~Matrix		(	void	);
+				BasicMatrix			(	const BasicMatrix&		matrix		);
+				BasicMatrix			(	BasicMatrix&&			matrix		);
+	template<size_t N>
+				BasicMatrix		(	const LinearExpr<BasicMatrix, N>&	expr	);
+	virtual	~BasicMatrix		(	void	);
 public:
 	elem_t		getElem		(	size_t		row,
 									size_t		col
@@ -38,20 +86,58 @@ public:
 									size_t		col,
 									elem_t		elem
 								);
-	Matrix		add				(	const Matrix&	operand	) const;
-	Matrix		sub				(	const Matrix&	operand	) const;
-	Matrix		multiply		(	const Matrix&	operand	) const;
-	Matrix		multiply		(	elem_t		operand	) const;
-	Matrix		transpose		(	void	) const;
-	Matrix		stmultiply		(	const Matrix&	operand	) const;
-	const Matrix&		equal			(	const Matrix&	operand	);
-	Matrix		sol_cg		(	const Matrix&	operand	);
+	BasicMatrix		add				(	const BasicMatrix&	operand	) const;
+	BasicMatrix		sub				(	const BasicMatrix&	operand	) const;
+	BasicMatrix		multiply		(	const BasicMatrix&	operand	) const;
+	BasicMatrix		multiply		(	elem_t		operand	) const;
+	BasicMatrix		transpose		(	void	) const;
+	BasicMatrix		stmultiply		(	const BasicMatrix&	operand	) const;
+	const BasicMatrix&		equal			(	const BasicMatrix&	operand	);
+	void		swap			(	BasicMatrix&		operand	);
+	const BasicMatrix&		axpy		(	elem_t			alpha,
+										const BasicMatrix&	operand
+									);
+	const BasicMatrix&		scale		(	elem_t		alpha	);
+	const BasicMatrix&		scale_add	(	elem_t			alpha,
+										const BasicMatrix&	operand
+									);
+	void		combine		(	size_t						num,
+								const elem_t				coef[],
+								const BasicMatrix* const			operand[]
+							);
+	void		spmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		spmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+	void		pspmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		pspmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+	BasicMatrix		sol_cg		(	const BasicMatrix&	operand	);
 public:
-	inline Matrix		operator+		(	const Matrix&	operand	) const;
-	inline Matrix		operator-		(	const Matrix&	operand	) const;
-	inline Matrix		operator*		(	const Matrix&	operand	) const;
-	inline Matrix		operator*		(	elem_t		operand		) const;
-	inline const Matrix&		operator=		(	const Matrix&	operand	);
+	inline LinearExpr<BasicMatrix, 2>	operator+		(	const BasicMatrix&	operand	) const;
+	inline LinearExpr<BasicMatrix, 2>	operator-		(	const BasicMatrix&	operand	) const;
+	inline BasicMatrix		operator*		(	const BasicMatrix&	operand	) const;
+	inline LinearExpr<BasicMatrix, 1>	operator*		(	elem_t		operand		) const;
+	inline const BasicMatrix&		operator=		(	const BasicMatrix&	operand	);
+	inline const BasicMatrix&		operator=		(	BasicMatrix&&		operand	);
+	inline const BasicMatrix&		operator+=		(	const BasicMatrix&	operand	);
+	inline const BasicMatrix&		operator-=		(	const BasicMatrix&	operand	);
+	inline const BasicMatrix&		operator*=		(	elem_t		operand		);
+	template<size_t N>
+	inline const BasicMatrix&		operator=		(	const LinearExpr<BasicMatrix, N>&	expr	);
+	template<size_t N>
+	inline const BasicMatrix&		operator+=		(	const LinearExpr<BasicMatrix, N>&	expr	);
+	template<size_t N>
+	inline const BasicMatrix&		operator-=		(	const LinearExpr<BasicMatrix, N>&	expr	);
 public:
 	inline bool	isValid		(	void	);
 	inline size_t	getRow			(	void	) const;
@@ -62,63 +148,226 @@ private:
 									size_t		col
 								);
 	void		freeElems		(	void	);
-	void		copyElems		(	const Matrix&		matrix		);
-	void		chkSameSize	(	const Matrix&		matrix		) const;
+	void		copyElems		(	const BasicMatrix&		matrix		);
+	void		chkSameSize	(	const BasicMatrix&		matrix		) const;
 	void		chkBound		(	size_t		row,
 									size_t		col
 								) const;
+	void		spmvRows		(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[],
+									size_t			startRow,
+									size_t			endRow
+								) const;
+private:
+	static void		gemm_			(	size_t			m,
+										size_t			n,
+										size_t			k,
+										const elem_t*	a,
+										size_t			rsA,
+										size_t			csA,
+										const elem_t*	b,
+										elem_t*			c
+									);
+	static void		packA_			(	size_t			mc,
+										size_t			kc,
+										const elem_t*	a,
+										size_t			rsA,
+										size_t			csA,
+										elem_t*			packed
+									);
+	static void		packB_			(	size_t			kc,
+										size_t			nc,
+										const elem_t*	b,
+										size_t			ldb,
+										elem_t*			packed
+									);
+	static void		microKernel_	(	size_t			kc,
+										const elem_t*	a,
+										const elem_t*	b,
+										elem_t*			c,
+										size_t			ldc,
+										size_t			mr,
+										size_t			nr,
+										bool			accumulate
+									);
+private:
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadSpmv		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadGemm		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCombine	(	void*	pData	);
 };
 
+typedef	BasicMatrix<double>	Matrix;		///< double 요소 행렬
+
 /**
  * 행렬 덧셈
- * @return		행렬 덧셈 결과
+ * 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+ * @return		행렬 덧셈 표현식
  */
-Matrix		Matrix::operator+		(	const Matrix&	operand	) const
+template<class T>
+LinearExpr<BasicMatrix<T>, 2>		BasicMatrix<T>::operator+		(	const BasicMatrix&	operand	) const
 {
-	return	add(operand);
+	return	LinearExpr<BasicMatrix, 1>(1, *this) + operand;
 }
 
 /**
  * 행렬 뺄셈
- * @return		행렬 뺄셈 결과
+ * 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+ * @return		행렬 뺄셈 표현식
  */
-Matrix		Matrix::operator-		(	const Matrix&	operand	) const
+template<class T>
+LinearExpr<BasicMatrix<T>, 2>		BasicMatrix<T>::operator-		(	const BasicMatrix&	operand	) const
 {
-	return	sub(operand);
+	return	LinearExpr<BasicMatrix, 1>(1, *this) - operand;
 }
 
 /**
  * 행렬 곱셈
  * @return		행렬 곱셈 결과
  */
-Matrix		Matrix::operator*		(	const Matrix&	operand	) const
+template<class T>
+BasicMatrix<T>		BasicMatrix<T>::operator*		(	const BasicMatrix&	operand	) const
 {
 	return	multiply(operand);
 }
 
 /**
- * 행렬 곱셈
- * @return		행렬 곱셈 결과
+ * 행렬 x 단일 값
+ * 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+ * @return		행렬 x 단일 값 표현식
  */
-Matrix		Matrix::operator*		(	elem_t		operand		) const
+template<class T>
+LinearExpr<BasicMatrix<T>, 1>		BasicMatrix<T>::operator*		(	elem_t		operand		) const
 {
-	return	multiply(operand);
+	return	LinearExpr<BasicMatrix, 1>(operand, *this);
 }
 
 /**
  * 행렬 대입
  * @return		대입 할 행렬
  */
-const Matrix&		Matrix::operator=		(	const Matrix&	operand	)
+template<class T>
+const BasicMatrix<T>&		BasicMatrix<T>::operator=		(	const BasicMatrix&	operand	)
 {
 	return	equal(operand);
 }
 
+/**
+ * 행렬 이동 대입
+ * 데이터를 복사하지 않고 피연산자와 맞바꾸며, 기존 데이터는 피연산자가 소멸할 때 해제된다.
+ * @return		대입 된 행렬
+ */
+template<class T>
+const BasicMatrix<T>&		BasicMatrix<T>::operator=		(	BasicMatrix&&		operand	)
+{
+	swap(operand);
+
+	return	*this;
+}
+
+/**
+ * 행렬 덧셈 (결과를 자신에 저장)
+ * @return		덧셈 결과
+ */
+template<class T>
+const BasicMatrix<T>&		BasicMatrix<T>::operator+=		(	const BasicMatrix&	operand	)
+{
+	return	axpy(1, operand);
+}
+
+/**
+ * 행렬 뺄셈 (결과를 자신에 저장)
+ * @return		뺄셈 결과
+ */
+template<class T>
+const BasicMatrix<T>&		BasicMatrix<T>::operator-=		(	const BasicMatrix&	operand	)
+{
+	return	axpy(-1, operand);
+}
+
+/**
+ * 행렬 x 단일 값 (결과를 자신에 저장)
+ * @return		곱셈 결과
+ */
+template<class T>
+const BasicMatrix<T>&		BasicMatrix<T>::operator*=		(	elem_t		operand		)
+{
+	return	scale(operand);
+}
+
+/**
+ * 표현식 계산 결과로 생성
+ * 모든 항을 combine()으로 한 번에 계산한다.
+ */
+template<class T>
+template<size_t N>
+BasicMatrix<T>::BasicMatrix		(	const LinearExpr<BasicMatrix, N>&	expr	///< 계산 할 표현식
+			)
+:mRowSize(0),
+ mColSize(0),
+mData(NULL)
+{
+	combine(N, expr.getCoef(), expr.getOperand());
+}
+
+/**
+ * 표현식 대입
+ * 모든 항을 combine()으로 한 번에 계산하며, 자신이 피연산자이어도 된다.
+ * @return		대입 된 행렬
+ */
+template<class T>
+template<size_t N>
+const BasicMatrix<T>&		BasicMatrix<T>::operator=		(	const LinearExpr<BasicMatrix, N>&	expr	///< 계산 할 표현식
+														)
+{
+	combine(N, expr.getCoef(), expr.getOperand());
+
+	return	*this;
+}
+
+/**
+ * 표현식 덧셈 (결과를 자신에 저장)
+ * 한 항이면 axpy(), 여러 항이면 자신을 포함한 표현식으로 계산한다.
+ * @return		덧셈 결과
+ */
+template<class T>
+template<size_t N>
+const BasicMatrix<T>&		BasicMatrix<T>::operator+=		(	const LinearExpr<BasicMatrix, N>&	expr	///< 더할 표현식
+														)
+{
+	if( N == 1 )
+	{
+		return	axpy(expr.getCoef()[0], *expr.getOperand()[0]);
+	}
+
+	return	operator=(*this + expr);
+}
+
+/**
+ * 표현식 뺄셈 (결과를 자신에 저장)
+ * 한 항이면 axpy(), 여러 항이면 자신을 포함한 표현식으로 계산한다.
+ * @return		뺄셈 결과
+ */
+template<class T>
+template<size_t N>
+const BasicMatrix<T>&		BasicMatrix<T>::operator-=		(	const LinearExpr<BasicMatrix, N>&	expr	///< 뺄 표현식
+														)
+{
+	if( N == 1 )
+	{
+		return	axpy(-expr.getCoef()[0], *expr.getOperand()[0]);
+	}
+
+	return	operator=(*this - expr);
+}
+
 /**
  * 행렬 객체가 유효한지 검사
  * @return		행렬 객체가 유효하면 true, 유효하지 않으면 false
  */
-bool	Matrix::isValid		(	void	)
+template<class T>
+bool	BasicMatrix<T>::isValid		(	void	)
 {
 	bool	ret		=	false;
 
@@ -135,7 +384,8 @@ bool	Matrix::isValid		(	void	)
  * 열 크기 가져오기
  * @return		열 크기
  */
-size_t	Matrix::getRow			(	void	) const
+template<class T>
+size_t	BasicMatrix<T>::getRow			(	void	) const
 {
 	return	mRowSize;
 }
@@ -144,12 +394,14 @@ size_t	Matrix::getRow			(	void	) const
  * 행 크기 가져오기
  * @return		행 크기
  */
-size_t	Matrix::getCol			(	void	) const
+template<class T>
+size_t	BasicMatrix<T>::getCol			(	void	) const
 {
 	return	mColSize;
 }
 
-size_t	Matrix::getSize		(	void	) const
+template<class T>
+size_t	BasicMatrix<T>::getSize		(	void	) const
 {
 	return	getRow() * getCol();
 }
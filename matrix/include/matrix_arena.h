@@ -0,0 +1,467 @@
+/*
+ * matrix_arena.h
+ *
+ *  Created on: 2015. 9. 2.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_ARENA_H_
+#define INCLUDE_MATRIX_ARENA_H_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <atomic>
+#include <new>
+#include <algorithm>
+#include <type_traits>
+
+namespace	matrix
+{
+
+/**
+ * 행 저장 공간 (arena)
+ * 큰 덩어리 (chunk)를 할당해 두고 앞에서부터 잘라 주며, 잘라 준 공간은 개별로 해제하지 않고 버려진 크기만 기록한다.
+ * 덩어리는 reset() 또는 소멸 시 한 번에 해제한다.
+ * 여러 쓰레드가 동시에 할당할 수 있도록 덩어리 안의 사용 위치는 원자적으로 증가시킨다.
+ */
+class	RowArena
+{
+public:
+	enum
+	{
+		ALIGN			=	16,					///< 할당 단위 및 정렬 (바이트, malloc 정렬 이하)
+		MIN_CHUNK_SIZE	=	64 * 1024,			///< 첫 덩어리 크기 (바이트)
+		MAX_CHUNK_SIZE	=	16 * 1024 * 1024,	///< 덩어리 최대 크기 (바이트)
+	};
+private:
+	struct		Chunk
+	{
+		Chunk*					next;		///< 다음 덩어리 (할당 된 모든 덩어리 목록)
+		size_t					size;		///< 데이터 크기
+		std::atomic<size_t>		used;		///< 잘라 준 크기 (size를 넘을 수 있다)
+	};
+
+	std::atomic<Chunk*>		mHead;			///< 할당 된 덩어리 목록
+	std::atomic<Chunk*>		mCurrent;		///< 현재 잘라 주는 덩어리
+	std::atomic<size_t>		mChunkSize;		///< 다음 덩어리 크기
+	std::atomic<size_t>		mSize;			///< 할당 된 덩어리 전체 크기
+	std::atomic<size_t>		mWaste;			///< 해제 되어 다시 쓰지 않는 크기
+public:
+				RowArena		(	void	);
+	virtual		~RowArena		(	void	);
+private:
+				RowArena		(	const RowArena&		arena	);
+	const RowArena&		operator=	(	const RowArena&		arena	);
+public:
+	void*		allocate		(	size_t		size	);
+	inline void		deallocate		(	size_t		size	);
+	void		reset			(	void	);
+	inline size_t	getSize			(	void	) const;
+	inline size_t	getWasteSize	(	void	) const;
+private:
+	Chunk*		createChunk		(	size_t		size	);
+	static inline size_t	getHeaderSize	(	void	);
+	static inline char*		getData			(	Chunk*		chunk	);
+};
+
+/**
+ * 노드 저장 공간 (pool)
+ * 같은 크기의 노드를 행 저장 공간에서 묶음으로 잘라 받아 나누어 주고, 해제 된 노드는 목록에 모아 다시 쓴다.
+ * 쓰레드마다 다른 구역 (stripe)을 사용하므로 여러 쓰레드가 동시에 할당해도 서로 기다리는 일이 적다.
+ * 처음 요청 된 크기만 노드로 관리하며, 다른 크기 요청은 힙에서 할당한다.
+ */
+class	NodePool
+{
+public:
+	enum
+	{
+		STRIPE_NUM		=	16,		///< 구역 수
+		BLOCK_NODE_NUM	=	64,		///< 구역이 한 번에 잘라 받는 노드 수
+	};
+private:
+	struct		FreeNode
+	{
+		FreeNode*		next;		///< 다음 해제 된 노드
+	};
+	struct		Stripe
+	{
+		std::atomic_flag		lock;			///< 구역 잠금
+		FreeNode*				freeList;		///< 해제 된 노드 목록
+		char*					pos;			///< 잘라 받은 묶음의 다음 노드 위치
+		char*					end;			///< 잘라 받은 묶음 끝
+		char					padding[64];	///< 다른 구역과 캐시 줄을 나누지 않도록 채움
+	};
+
+	RowArena				mArena;					///< 노드 묶음을 잘라 받는 공간
+	std::atomic<size_t>		mNodeSize;				///< 노드 크기 (0이면 아직 정하지 않음)
+	Stripe					mStripe[STRIPE_NUM];	///< 쓰레드 별 구역
+public:
+				NodePool		(	void	);
+	virtual		~NodePool		(	void	);
+private:
+				NodePool		(	const NodePool&		pool	);
+	const NodePool&		operator=	(	const NodePool&		pool	);
+public:
+	void*		allocate		(	size_t		size	);
+	void		deallocate		(	void*		ptr,
+									size_t		size
+								);
+	void		reset			(	void	);
+	inline size_t	getSize			(	void	) const;
+private:
+	bool		isNode			(	size_t		size	);
+	static size_t	getStripe		(	void	);
+};
+
+/**
+ * 행 데이터 할당자
+ * 행 저장 공간이 지정되어 있으면 그곳에서 잘라 받고, 없으면 힙에서 할당한다.
+ * 맞바꾸기와 이동 대입은 데이터와 함께 할당자도 옮기며, 복사 생성한 행은 힙을 사용한다.
+ */
+template<class T>
+class	RowAllocator
+{
+public:
+	typedef	T					value_type;
+	typedef	std::true_type		propagate_on_container_move_assignment;
+	typedef	std::true_type		propagate_on_container_swap;
+	typedef	std::false_type		propagate_on_container_copy_assignment;
+private:
+	RowArena*		mArena;			///< 행 저장 공간 (NULL이면 힙)
+
+	template<class>	friend class	RowAllocator;
+public:
+				RowAllocator	(	void	);
+	explicit	RowAllocator	(	RowArena*	arena	);
+	template<class U>
+				RowAllocator	(	const RowAllocator<U>&	alloc	);
+public:
+	T*			allocate		(	size_t		num		);
+	void		deallocate		(	T*			ptr,
+									size_t		num
+								);
+	RowAllocator	select_on_container_copy_construction	(	void	) const;
+	inline RowArena*	getArena	(	void	) const;
+public:
+	template<class U>
+	inline bool		operator==		(	const RowAllocator<U>&	alloc	) const;
+	template<class U>
+	inline bool		operator!=		(	const RowAllocator<U>&	alloc	) const;
+};
+
+/**
+ * 행 노드 할당자
+ * 노드 저장 공간이 지정되어 있으면 한 개씩 할당하는 노드를 그곳에서 받고, 없으면 힙에서 할당한다.
+ * 공간을 옮기는 규칙은 RowAllocator와 같다.
+ */
+template<class T>
+class	NodeAllocator
+{
+public:
+	typedef	T					value_type;
+	typedef	std::true_type		propagate_on_container_move_assignment;
+	typedef	std::true_type		propagate_on_container_swap;
+	typedef	std::false_type		propagate_on_container_copy_assignment;
+private:
+	NodePool*		mPool;			///< 노드 저장 공간 (NULL이면 힙)
+
+	template<class>	friend class	NodeAllocator;
+public:
+				NodeAllocator	(	void	);
+	explicit	NodeAllocator	(	NodePool*	pool	);
+	template<class U>
+				NodeAllocator	(	const NodeAllocator<U>&	alloc	);
+public:
+	T*			allocate		(	size_t		num		);
+	void		deallocate		(	T*			ptr,
+									size_t		num
+								);
+	NodeAllocator	select_on_container_copy_construction	(	void	) const;
+	inline NodePool*	getPool		(	void	) const;
+public:
+	template<class U>
+	inline bool		operator==		(	const NodeAllocator<U>&	alloc	) const;
+	template<class U>
+	inline bool		operator!=		(	const NodeAllocator<U>&	alloc	) const;
+};
+
+/**
+ * 해제 된 크기 기록
+ * 공간은 reset() 전까지 다시 쓰지 않는다.
+ */
+void	RowArena::deallocate		(	size_t		size	///< 해제 된 크기 (바이트)
+									)
+{
+	mWaste.fetch_add(size, std::memory_order_relaxed);
+}
+
+/**
+ * 할당 된 덩어리 전체 크기 가져오기
+ * @return 덩어리 전체 크기 (바이트)
+ */
+size_t	RowArena::getSize		(	void	) const
+{
+	return	mSize.load(std::memory_order_relaxed);
+}
+
+/**
+ * 해제 되어 다시 쓰지 않는 크기 가져오기
+ * @return 버려진 크기 (바이트)
+ */
+size_t	RowArena::getWasteSize	(	void	) const
+{
+	return	mWaste.load(std::memory_order_relaxed);
+}
+
+/**
+ * 덩어리 헤더 크기 가져오기
+ * @return ALIGN 단위로 올린 헤더 크기 (바이트)
+ */
+size_t	RowArena::getHeaderSize	(	void	)
+{
+	return	( sizeof(Chunk) + ALIGN - 1 ) / ALIGN * ALIGN;
+}
+
+/**
+ * 덩어리 데이터 시작 위치 가져오기
+ * @return 덩어리 헤더 뒤 ALIGN 경계 위치
+ */
+char*	RowArena::getData		(	Chunk*		chunk	///< 덩어리
+								)
+{
+	return	(char*)chunk + getHeaderSize();
+}
+
+/**
+ * 노드 묶음으로 할당 된 전체 크기 가져오기
+ * @return 전체 크기 (바이트)
+ */
+size_t	NodePool::getSize		(	void	) const
+{
+	return	mArena.getSize();
+}
+
+/**
+ * 생성자 (힙 사용)
+ */
+template<class T>
+RowAllocator<T>::RowAllocator		(	void	)
+:mArena(NULL)
+{
+}
+
+/**
+ * 생성자
+ */
+template<class T>
+RowAllocator<T>::RowAllocator		(	RowArena*	arena	///< 행 저장 공간 (NULL이면 힙)
+									)
+:mArena(arena)
+{
+}
+
+/**
+ * 다른 형식 할당자에서 변환
+ */
+template<class T>
+template<class U>
+RowAllocator<T>::RowAllocator		(	const RowAllocator<U>&	alloc	///< 원본 할당자
+									)
+:mArena(alloc.mArena)
+{
+}
+
+/**
+ * 할당
+ * @exception 메모리 할당 실패 시 std::bad_alloc 발생
+ * @return 할당 된 공간
+ */
+template<class T>
+T*		RowAllocator<T>::allocate		(	size_t		num		///< 요소 수
+										)
+{
+	if( mArena == NULL )
+	{
+		return	(T*)::operator new(num * sizeof(T));
+	}
+
+	return	(T*)mArena->allocate(num * sizeof(T));
+}
+
+/**
+ * 해제
+ * 행 저장 공간에서 받은 공간은 버려진 크기만 기록한다.
+ */
+template<class T>
+void	RowAllocator<T>::deallocate		(	T*			ptr,	///< 해제 할 공간
+											size_t		num		///< 요소 수
+										)
+{
+	if( mArena == NULL )
+	{
+		::operator delete(ptr);
+	}
+	else
+	{
+		mArena->deallocate(num * sizeof(T));
+	}
+}
+
+/**
+ * 복사 생성 할 행의 할당자 가져오기
+ * 복사한 행은 원본 행렬보다 오래 남을 수 있으므로 힙을 사용한다.
+ * @return 힙 할당자
+ */
+template<class T>
+RowAllocator<T>		RowAllocator<T>::select_on_container_copy_construction	(	void	) const
+{
+	return	RowAllocator();
+}
+
+/**
+ * 행 저장 공간 가져오기
+ * @return 행 저장 공간 (NULL이면 힙)
+ */
+template<class T>
+RowArena*	RowAllocator<T>::getArena		(	void	) const
+{
+	return	mArena;
+}
+
+/**
+ * 할당자 비교
+ * @return 같은 공간에서 할당하면 true
+ */
+template<class T>
+template<class U>
+bool	RowAllocator<T>::operator==		(	const RowAllocator<U>&	alloc	///< 비교 할 할당자
+										) const
+{
+	return	mArena == alloc.mArena;
+}
+
+/**
+ * 할당자 비교
+ * @return 다른 공간에서 할당하면 true
+ */
+template<class T>
+template<class U>
+bool	RowAllocator<T>::operator!=		(	const RowAllocator<U>&	alloc	///< 비교 할 할당자
+										) const
+{
+	return	mArena != alloc.mArena;
+}
+
+/**
+ * 생성자 (힙 사용)
+ */
+template<class T>
+NodeAllocator<T>::NodeAllocator		(	void	)
+:mPool(NULL)
+{
+}
+
+/**
+ * 생성자
+ */
+template<class T>
+NodeAllocator<T>::NodeAllocator		(	NodePool*	pool	///< 노드 저장 공간 (NULL이면 힙)
+										)
+:mPool(pool)
+{
+}
+
+/**
+ * 다른 형식 할당자에서 변환
+ */
+template<class T>
+template<class U>
+NodeAllocator<T>::NodeAllocator		(	const NodeAllocator<U>&	alloc	///< 원본 할당자
+										)
+:mPool(alloc.mPool)
+{
+}
+
+/**
+ * 할당
+ * 한 개씩 할당하는 노드만 노드 저장 공간에서 받는다.
+ * @exception 메모리 할당 실패 시 std::bad_alloc 발생
+ * @return 할당 된 공간
+ */
+template<class T>
+T*		NodeAllocator<T>::allocate		(	size_t		num		///< 요소 수
+											)
+{
+	if( ( mPool == NULL ) || ( num != 1 ) )
+	{
+		return	(T*)::operator new(num * sizeof(T));
+	}
+
+	return	(T*)mPool->allocate(sizeof(T));
+}
+
+/**
+ * 해제
+ */
+template<class T>
+void	NodeAllocator<T>::deallocate		(	T*			ptr,	///< 해제 할 공간
+												size_t		num		///< 요소 수
+											)
+{
+	if( ( mPool == NULL ) || ( num != 1 ) )
+	{
+		::operator delete(ptr);
+	}
+	else
+	{
+		mPool->deallocate(ptr, sizeof(T));
+	}
+}
+
+/**
+ * 복사 생성 할 행의 할당자 가져오기
+ * @return 힙 할당자
+ */
+template<class T>
+NodeAllocator<T>	NodeAllocator<T>::select_on_container_copy_construction	(	void	) const
+{
+	return	NodeAllocator();
+}
+
+/**
+ * 노드 저장 공간 가져오기
+ * @return 노드 저장 공간 (NULL이면 힙)
+ */
+template<class T>
+NodePool*	NodeAllocator<T>::getPool		(	void	) const
+{
+	return	mPool;
+}
+
+/**
+ * 할당자 비교
+ * @return 같은 공간에서 할당하면 true
+ */
+template<class T>
+template<class U>
+bool	NodeAllocator<T>::operator==		(	const NodeAllocator<U>&	alloc	///< 비교 할 할당자
+											) const
+{
+	return	mPool == alloc.mPool;
+}
+
+/**
+ * 할당자 비교
+ * @return 다른 공간에서 할당하면 true
+ */
+template<class T>
+template<class U>
+bool	NodeAllocator<T>::operator!=		(	const NodeAllocator<U>&	alloc	///< 비교 할 할당자
+											) const
+{
+	return	mPool != alloc.mPool;
+}
+
+};
+
+#endif /* INCLUDE_MATRIX_ARENA_H_ */
@@ -0,0 +1,144 @@
+/*
+ * matrix_builder.h
+ *
+ *  Created on: 2015. 7. 27.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_BUILDER_H_
+#define INCLUDE_MATRIX_BUILDER_H_
+
+#include <stdio.h>
+#include "matrix_typedef.h"
+
+namespace	matrix
+{
+
+template<class T>			class	BasicMatrix;
+template<class T, class I>	class	BasicMatrixCSR;
+template<class T, class I>	class	BasicSparseMatrix;
+template<class T, class R>	class	BasicSparseMatrix2;
+
+typedef	BasicMatrix<double>					Matrix;
+typedef	BasicMatrixCSR<double, index_t>		MatrixCSR;
+typedef	BasicSparseMatrix<double, index_t>	SparseMatrix;
+typedef	BasicSparseMatrix2<double>			SparseMatrix2;
+
+/**
+ * (행, 열, 값) 요소 묶음으로 행렬을 한 번에 생성하는 클래스 (COO)
+ * 요소를 모은 뒤 열, 행 순서로 병렬 기수 정렬(계수 정렬 2회)을 하고,
+ * 같은 위치의 값은 더하고 0이 된 값은 버린 후 각 행렬 형식으로 정확한 크기만 할당하여 채운다.
+ */
+class	MatrixBuilder
+{
+public:
+	typedef	THREAD_RETURN_TYPE(THREAD_FUNC_TYPE *Operation)(void*);
+	struct		SortInfo
+	{
+		const size_t*	key;		///< 정렬 키 (요소 위치 별)
+		const size_t*	src;		///< 입력 순서 (NULL이면 요소 순서)
+		size_t*			dst;		///< 출력 순서
+		size_t*			hist;		///< 작업 별 키 개수 / 기록 위치
+		size_t			start;		///< 작업 시작 위치
+		size_t			end;		///< 작업 종료 위치 (미포함)
+	};
+	struct		RowInfo
+	{
+		MatrixBuilder*	builder;
+		void*			target;		///< 생성 할 행렬
+		size_t			startRow;
+		size_t			endRow;		///< (미포함)
+	};
+private:
+	size_t					mRowSize;		///< 행 크기
+	size_t					mColSize;		///< 열 크기
+	std::vector<size_t>		mRow;			///< 요소 행 위치
+	std::vector<size_t>		mCol;			///< 요소 열 위치
+	std::vector<elem_t>		mElem;			///< 요소 값
+	bool					mCompressed;	///< 정렬 결과가 현재 요소와 일치하는지 여부
+	std::vector<size_t>		mOrder;			///< 정렬 된 요소 순서
+	std::vector<size_t>		mRowStart;		///< 정렬 결과에서 행 별 시작 위치
+	std::vector<size_t>		mRowCount;		///< 정렬 결과에서 행 별 요소 수 (중복 합산 후)
+	std::vector<size_t>		mSortCol;		///< 정렬 된 열 위치
+	std::vector<elem_t>		mSortElem;		///< 정렬 된 요소 값
+
+	friend class	MatrixFile;
+public:
+				MatrixBuilder	(	size_t		row,
+									size_t		col
+								);
+	virtual		~MatrixBuilder	(	void	);
+public:
+	void		reserve			(	size_t		num		);
+	void		addElem			(	size_t		row,
+									size_t		col,
+									elem_t		elem
+								);
+	void		addElems		(	const size_t	row[],
+									const size_t	col[],
+									const elem_t	elem[],
+									size_t			num
+								);
+	void		clear			(	void	);
+	void		build			(	MatrixCSR&		matrix	);
+	void		build			(	SparseMatrix&	matrix	);
+	void		build			(	SparseMatrix2&	matrix	);
+	void		build			(	Matrix&			matrix	);
+public:
+	inline size_t	getRow		(	void	) const;
+	inline size_t	getCol		(	void	) const;
+	inline size_t	getSize		(	void	) const;
+private:
+	void		compress		(	void	);
+	void		sortByKey		(	const std::vector<size_t>&	key,
+									size_t						keyRange,
+									const size_t*				src,
+									size_t*						dst,
+									size_t*						keyStart
+								);
+	void		doRowFunc		(	Operation	func,
+									void*		target
+								);
+	void		chkBound		(	size_t		row,
+									size_t		col
+								) const;
+private:
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCount			(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadScatter		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCompress		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadBuildCSR		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadBuildSparse	(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadBuildSparse2	(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadBuildMatrix	(	void*	pData	);
+};
+
+/**
+ * 행 크기 가져오기
+ * @return 행 크기
+ */
+size_t	MatrixBuilder::getRow		(	void	) const
+{
+	return	mRowSize;
+}
+
+/**
+ * 열 크기 가져오기
+ * @return 열 크기
+ */
+size_t	MatrixBuilder::getCol		(	void	) const
+{
+	return	mColSize;
+}
+
+/**
+ * 입력 된 요소 수 가져오기 (중복 포함)
+ * @return 요소 수
+ */
+size_t	MatrixBuilder::getSize		(	void	) const
+{
+	return	mElem.size();
+}
+
+};
+
+#endif /* INCLUDE_MATRIX_BUILDER_H_ */
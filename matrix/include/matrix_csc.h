@@ -0,0 +1,216 @@
+/*
+ * matrix_csc.h
+ *
+ *  Created on: 2015. 8. 26.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_CSC_H_
+#define INCLUDE_MATRIX_CSC_H_
+
+#include <stdio.h>
+#include "matrix_typedef.h"
+
+namespace	matrix
+{
+
+template<class T, class I>
+class	BasicMatrixCSR;
+
+/**
+* 희소 행렬 표현 클래스 (CSC)
+* 열 별 시작 위치, 행 위치, 요소 값을 각각 SIMD_ALIGN 바이트 경계에 정렬 된 별도 배열로 가진다.
+* 각 열의 요소는 행 순서로 정렬되며, 배열은 전치 행렬의 CSR 배열과 같다.
+* MatrixCSR과의 변환은 열 별 요소 수를 세어 위치를 정하는 계수 정렬 (counting sort)로 O(요소 수)에 수행한다.
+*/
+template<class T, class I = index_t>
+class	BasicMatrixCSC
+{
+public:
+	typedef	T											elem_t;		///< 요소 데이터 형식
+	typedef	typename elem_traits<T>::real_t				real_t;		///< 크기 (norm) 형식
+	typedef	I											index_t;	///< 행 위치 / 열 별 시작 위치 형식
+	struct		TransposeInfo
+	{
+		size_t					row;			///< 입력 행 크기
+		size_t					col;			///< 입력 열 크기
+		const index_t*			start;			///< 입력 행 별 시작 위치
+		const index_t*			idx;			///< 입력 열 위치
+		const elem_t*			value;			///< 입력 요소 값
+		index_t*				outIdx;			///< 결과 행 위치
+		elem_t*					outValue;		///< 결과 요소 값
+	};
+private:
+	struct		FuncInfo
+	{
+		const TransposeInfo*	info;
+		index_t*				count;			///< 쓰레드 별 열 요소 수 / 기록 위치 (열 크기 개)
+		size_t					startRow;
+		size_t					endRow;
+	};
+
+	size_t				mRowSize;			///< 행 크기
+	size_t				mColSize;			///< 열 크기
+	index_t*			mColStart;			///< 열 별 시작 위치 (mColSize + 1 개)
+	index_t*			mRowIdx;			///< 요소 행 위치
+	elem_t*				mValue;				///< 요소 값
+public:
+				BasicMatrixCSC		(	void	);
+				BasicMatrixCSC		(	size_t		row,
+										size_t		col
+									);
+				BasicMatrixCSC		(	const BasicMatrixCSC&		matrix		);
+				BasicMatrixCSC		(	BasicMatrixCSC&&			matrix		);
+	explicit	BasicMatrixCSC		(	const BasicMatrixCSR<T, I>&	matrix		);
+	virtual		~BasicMatrixCSC		(	void	);
+public:
+	elem_t		getElem			(	size_t		row,
+									size_t		col
+								) const;
+	BasicMatrixCSR<T, I>	transpose		(	void	) const;
+	void		swap			(	BasicMatrixCSC&		operand		);
+	void		spmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		tspmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+public:
+	inline const BasicMatrixCSC&		operator=		(	const BasicMatrixCSC&	operand	);
+	inline const BasicMatrixCSC&		operator=		(	BasicMatrixCSC&&		operand	);
+public:
+	inline size_t	getCol			(	void	) const;
+	inline size_t	getRow			(	void	) const;
+	inline size_t	getSize			(	void	) const;
+	inline const index_t*	getColStart		(	void	) const;
+	inline const index_t*	getRowIdx		(	void	) const;
+	inline const elem_t*	getValue		(	void	) const;
+public:
+	static void		transposeArrays	(	size_t			row,
+										size_t			col,
+										const index_t	start[],
+										const index_t	idx[],
+										const elem_t	value[],
+										index_t			outStart[],
+										index_t			outIdx[],
+										elem_t			outValue[],
+										bool			useThread
+									);
+private:
+	void		allocElems		(	size_t		row,
+									size_t		col,
+									size_t		size
+								);
+	void		freeElems		(	void	);
+	void		chkBound		(	size_t		row,
+									size_t		col
+								) const;
+private:
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCount		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadScatter	(	void*	pData	);
+};
+
+typedef	BasicMatrixCSC<double>	MatrixCSC;		///< double 요소 행렬
+
+/**
+ * 행렬 대입
+ * @return		대입 된 행렬
+ */
+template<class T, class I>
+const BasicMatrixCSC<T, I>&		BasicMatrixCSC<T, I>::operator=		(	const BasicMatrixCSC&	operand	///< 피연산자
+																	)
+{
+	if( this != &operand )
+	{
+		BasicMatrixCSC		copy(operand);
+
+		swap(copy);
+	}
+
+	return	*this;
+}
+
+/**
+ * 행렬 이동 대입
+ * 데이터를 복사하지 않고 피연산자와 맞바꾸며, 기존 데이터는 피연산자가 소멸할 때 해제된다.
+ * @return		대입 된 행렬
+ */
+template<class T, class I>
+const BasicMatrixCSC<T, I>&		BasicMatrixCSC<T, I>::operator=		(	BasicMatrixCSC&&		operand	///< 피연산자
+																	)
+{
+	swap(operand);
+
+	return	*this;
+}
+
+/**
+ * 열 크기 가져오기
+ * @return		열 크기
+ */
+template<class T, class I>
+size_t	BasicMatrixCSC<T, I>::getCol		(	void	) const
+{
+	return	mColSize;
+}
+
+/**
+ * 행 크기 가져오기
+ * @return		행 크기
+ */
+template<class T, class I>
+size_t	BasicMatrixCSC<T, I>::getRow		(	void	) const
+{
+	return	mRowSize;
+}
+
+/**
+ * 행렬 요소 데이터 수 가져오기
+ * @return		요소 데이터 크기
+ */
+template<class T, class I>
+size_t	BasicMatrixCSC<T, I>::getSize		(	void	) const
+{
+	size_t	size	=	0;
+
+	if( mColStart != NULL )
+	{
+		size	=	mColStart[mColSize];
+	}
+
+	return	size;
+}
+
+/**
+ * 열 별 시작 위치 배열 가져오기
+ * @return		열 별 시작 위치 배열 (열 크기 + 1 개)
+ */
+template<class T, class I>
+const typename BasicMatrixCSC<T, I>::index_t*	BasicMatrixCSC<T, I>::getColStart		(	void	) const
+{
+	return	mColStart;
+}
+
+/**
+ * 요소 행 위치 배열 가져오기
+ * @return		요소 행 위치 배열
+ */
+template<class T, class I>
+const typename BasicMatrixCSC<T, I>::index_t*	BasicMatrixCSC<T, I>::getRowIdx		(	void	) const
+{
+	return	mRowIdx;
+}
+
+/**
+ * 요소 값 배열 가져오기
+ * @return		요소 값 배열
+ */
+template<class T, class I>
+const typename BasicMatrixCSC<T, I>::elem_t*	BasicMatrixCSC<T, I>::getValue		(	void	) const
+{
+	return	mValue;
+}
+
+};
+
+#endif /* INCLUDE_MATRIX_CSC_H_ */
@@ -10,16 +10,38 @@
 
 #include <stdio.h>
 #include "matrix_typedef.h"
+#include "matrix_expr.h"
+#include "matrix_error.h"
 
 namespace	matrix
 {
 
+template<class T, class I>
+class	BasicPreconditioner;
+template<class T>
+class	BasicMatrix;
+template<class T, class I>
+class	BasicSparseMatrix;
+template<class T, class R>
+class	BasicSparseMatrix2;
+template<class T, class I>
+class	BasicMatrixCSC;
+class	MappedFile;
+class	ChunkQueue;
+
 /**
 * 희소 행렬 표현 클래스 (CSR)
+* 행 별 시작 위치, 열 위치, 요소 값을 각각 SIMD_ALIGN 바이트 경계에 정렬 된 별도 배열로 가진다. (SoA)
+* 연산에 사용하는 기본 형식이며, 다른 행렬 클래스에서 변환하거나 배열을 그대로 외부 코드에 넘길 수 있다.
+* 위치 형식 I (기본 uint32_t)는 열 크기와 요소 수를 표현할 수 있어야 한다.
 */
-class	MatrixCSR
+template<class T, class I = index_t>
+class	BasicMatrixCSR
 {
 public:
+	typedef	T											elem_t;		///< 요소 데이터 형식
+	typedef	typename elem_traits<T>::real_t				real_t;		///< 크기 (norm) 형식
+	typedef	I											index_t;	///< 열 위치 / 행 별 시작 위치 형식
 	enum	FuncKind
 	{
 		FUNC_ADD,			///< 덧셈
@@ -29,28 +51,76 @@ public:
 		FUNC_PMULTIPLY,		///< 전치 행렬 곱셈
 		FUNC_COPY,			///< 행렬 복사
 		FUNC_COMPARE,		///< 행렬 비교
+		FUNC_MULTIPLY_SYMBOLIC,	///< 곱셈 결과 행 별 요소 수 계산
+		FUNC_MULTIPLY_NUMERIC,	///< 곱셈 결과 값 계산
+		FUNC_SPMV,				///< 행렬 x 벡터
+		FUNC_COMBINE_SYMBOLIC,	///< 선형 결합 결과 행 별 요소 수 계산
+		FUNC_COMBINE_NUMERIC,	///< 선형 결합 결과 값 계산
+		FUNC_TOUCH,				///< 요소 배열 first touch
 	};
 	struct		OpInfo
 	{
-		const MatrixCSR*	operandA;
-		const MatrixCSR*	operandB;
+		const BasicMatrixCSR*	operandA;
+		const BasicMatrixCSR*	operandB;
 		elem_t				elemOperandB;
-		MatrixCSR*			result;
-		void*				retVal;
+		BasicMatrixCSR*			result;
+		size_t*				rowSize;		///< 행 별 결과 요소 수
+		const elem_t*		vecX;			///< SpMV 입력 벡터
+		elem_t*				vecY;			///< SpMV 결과 벡터
+		elem_t				beta;			///< SpMV 결과 벡터 계수 (elemOperandB는 alpha)
+		size_t				termNum;		///< 선형 결합 항 수
+		const elem_t*		coef;			///< 선형 결합 항 별 계수
+		const BasicMatrixCSR* const*	terms;		///< 선형 결합 항 별 피연산자
+		THREAD_RETURN_TYPE	retVal;
 	};
 private:
+	typedef	THREAD_RETURN_TYPE(THREAD_FUNC_TYPE *Operation)(void*);
+	struct		FuncInfo
+	{
+		OpInfo					opInfo;
+		Operation				func;
+		size_t					startCol;
+		size_t					endCol;
+		ChunkQueue*				queue;			///< 조각 큐 (NULL이면 startCol ~ endCol 한 구간만 수행)
+		const size_t*			chunkStart;		///< 조각 별 시작 행 (조각 수 + 1 개)
+		size_t					task;			///< 작업 번호
+		std::vector<elem_t>		accum;			///< 곱셈 누적 배열 (작업 안의 조각들이 같이 사용)
+		std::vector<size_t>		marker;			///< 열 별 마지막 방문 행 (작업 안의 조각들이 같이 사용)
+	};
+
 	size_t				mColSize;			///< 행 크기
 	size_t				mRowSize;			///< 열 크기
-	size_t*				mRowStart;
-	std::vector<node_t>		mData;
+	index_t*			mRowStart;			///< 행 별 시작 위치 (mRowSize + 1 개)
+	index_t*			mColIdx;			///< 요소 열 위치
+	elem_t*				mValue;				///< 요소 값
+	size_t				mCapacity;			///< 요소 배열 할당 크기
+	MappedFile*			mMapping;			///< 데이터가 매핑 된 파일 (NULL이면 직접 할당한 메모리)
+
+	friend class	MatrixBuilder;
+	template<class, class>	friend class	BasicPreconditioner;
+	friend class	MatrixFile;
 
 public:
-				MatrixCSR		(	void	);
-				MatrixCSR		(	size_t		row,
+				BasicMatrixCSR		(	void	);
+				BasicMatrixCSR		(	size_t		row,
 									size_t		col
 								);
-				MatrixCSR		(	const MatrixCSR&		matrix		);
-	virtual		~MatrixCSR		(	void	);
+				BasicMatrixCSR		(	const BasicMatrixCSR&		matrix		);
+				BasicMatrixCSR		(	BasicMatrixCSR&&				matrix		);
+	template<size_t N>
+				BasicMatrixCSR		(	const LinearExpr<BasicMatrixCSR, N>&	expr	);
+				BasicMatrixCSR		(	size_t			row,
+									size_t			col,
+									const index_t	rowStart[],
+									const index_t	colIdx[],
+									const elem_t	value[]
+								);
+	explicit	BasicMatrixCSR		(	const BasicMatrix<T>&			matrix	);
+	explicit	BasicMatrixCSR		(	const BasicSparseMatrix<T, I>&	matrix	);
+	template<class R>
+	explicit	BasicMatrixCSR		(	const BasicSparseMatrix2<T, R>&	matrix	);
+	explicit	BasicMatrixCSR		(	const BasicMatrixCSC<T, I>&		matrix	);
+	virtual		~BasicMatrixCSR		(	void	);
 public:
 	elem_t		getElem		(	size_t				row,
 									size_t				col
@@ -59,95 +129,387 @@ public:
 								size_t				col,
 								elem_t				elem
 							);
-	MatrixCSR	add			(	const MatrixCSR&	operand	) const;
-	MatrixCSR	sub			(	const MatrixCSR&	operand	) const;
-	MatrixCSR	multiply	(	const MatrixCSR&	operand	) const;
-	MatrixCSR	multiply	(	elem_t		operand	) const;
-	MatrixCSR	transpose	(	void	) const;
-	MatrixCSR	tmultiply	(	const MatrixCSR&	operand	) const;
-	MatrixCSR	stmultiply	(	const MatrixCSR&	operand	) const;
-	const MatrixCSR&		equal		(	const MatrixCSR&	operand	);
-	bool		compare	(	const MatrixCSR&	operand	) const;
-	MatrixCSR	sol_cg	(	const MatrixCSR&	operand	);
+	BasicMatrixCSR	add			(	const BasicMatrixCSR&	operand	) const;
+	BasicMatrixCSR	padd		(	const BasicMatrixCSR&	operand	) const;
+	BasicMatrixCSR	sub			(	const BasicMatrixCSR&	operand	) const;
+	BasicMatrixCSR	psub		(	const BasicMatrixCSR&	operand	) const;
+	BasicMatrixCSR	multiply	(	const BasicMatrixCSR&	operand	) const;
+	BasicMatrixCSR	pmultiply	(	const BasicMatrixCSR&	operand	) const;
+	BasicMatrixCSR	multiply	(	elem_t		operand	) const;
+	BasicMatrixCSR	pmultiply	(	elem_t		operand	) const;
+	BasicMatrixCSR	transpose	(	void	) const;
+	BasicMatrixCSR	ptranspose	(	void	) const;
+	BasicMatrixCSR	tmultiply	(	const BasicMatrixCSR&	operand	) const;
+	BasicMatrixCSR	ptmultiply	(	const BasicMatrixCSR&	operand	) const;
+	BasicMatrixCSR	stmultiply	(	const BasicMatrixCSR&	operand	) const;
+	BasicMatrixCSR	pstmultiply	(	const BasicMatrixCSR&	operand	) const;
+	const BasicMatrixCSR&		equal		(	const BasicMatrixCSR&	operand	);
+	const BasicMatrixCSR&		pequal		(	const BasicMatrixCSR&	operand	);
+	bool		compare	(	const BasicMatrixCSR&	operand	) const;
+	bool		pcompare	(	const BasicMatrixCSR&	operand	) const;
+	void		swap		(	BasicMatrixCSR&		operand	);
+	const BasicMatrixCSR&		axpy		(	elem_t				alpha,
+											const BasicMatrixCSR&	operand
+										);
+	const BasicMatrixCSR&		scale		(	elem_t		alpha	);
+	const BasicMatrixCSR&		scale_add	(	elem_t				alpha,
+											const BasicMatrixCSR&	operand
+										);
+	void		combine		(	size_t						num,
+								const elem_t				coef[],
+								const BasicMatrixCSR* const	operand[]
+							);
+	void		spmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		spmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+	void		pspmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		pspmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+	BasicMatrixCSR	sol_cg	(	const BasicMatrixCSR&	operand	);
+	BasicMatrixCSR	sol_pcg	(	const BasicMatrixCSR&		operand,
+							const BasicPreconditioner<T, I>&	precond
+						) const;
+	BasicMatrixCSR	sol_pcg	(	const BasicMatrixCSR&		operand,
+							const BasicPreconditioner<T, I>&	precond,
+							uint32_t				iteration,
+							real_t					limit,
+							real_t&					rangeResult
+						) const;
 public:
-	inline MatrixCSR		operator+		(	const MatrixCSR&	operand	) const;
-	inline MatrixCSR		operator-		(	const MatrixCSR&	operand	) const;
-	inline MatrixCSR		operator*		(	const MatrixCSR&	operand	) const;
-	inline MatrixCSR		operator*		(	elem_t		operand		) const;
-	inline const MatrixCSR&		operator=		(	const MatrixCSR&	operand	);
-	inline bool	operator==		(	const MatrixCSR&	operand	) const;
+	inline LinearExpr<BasicMatrixCSR, 2>	operator+		(	const BasicMatrixCSR&	operand	) const;
+	inline LinearExpr<BasicMatrixCSR, 2>	operator-		(	const BasicMatrixCSR&	operand	) const;
+	inline BasicMatrixCSR		operator*		(	const BasicMatrixCSR&	operand	) const;
+	inline LinearExpr<BasicMatrixCSR, 1>	operator*		(	elem_t		operand		) const;
+	inline const BasicMatrixCSR&		operator=		(	const BasicMatrixCSR&	operand	);
+	inline const BasicMatrixCSR&		operator=		(	BasicMatrixCSR&&			operand	);
+	inline const BasicMatrixCSR&		operator+=		(	const BasicMatrixCSR&	operand	);
+	inline const BasicMatrixCSR&		operator-=		(	const BasicMatrixCSR&	operand	);
+	inline const BasicMatrixCSR&		operator*=		(	elem_t		operand		);
+	template<size_t N>
+	inline const BasicMatrixCSR&		operator=		(	const LinearExpr<BasicMatrixCSR, N>&	expr	);
+	template<size_t N>
+	inline const BasicMatrixCSR&		operator+=		(	const LinearExpr<BasicMatrixCSR, N>&	expr	);
+	template<size_t N>
+	inline const BasicMatrixCSR&		operator-=		(	const LinearExpr<BasicMatrixCSR, N>&	expr	);
+	inline bool	operator==		(	const BasicMatrixCSR&	operand	) const;
 public:
 	inline bool	isValid		(	void	);
 	inline size_t	getCol		(	void	) const;
 	inline size_t	getRow		(	void	) const;
 	inline size_t	getSize		(	void	) const;
+	inline const index_t*	getRowStart		(	void	) const;
+	inline const index_t*	getColIdx		(	void	) const;
+	inline const elem_t*	getValue		(	void	) const;
 private:
 	void		allocElems		(	size_t	row,
 									size_t	col
 								);
 	void		freeElems		(	void	);
-	void		copyElems		(	const MatrixCSR&		matrix		);
-	void		chkSameSize	(	const MatrixCSR&		matrix		) const;
+	void		reserveElems	(	size_t		capacity	);
+	void		placeElems		(	void	);
+	void		detach			(	void	);
+	void		copyElems		(	const BasicMatrixCSR&		matrix		);
+	void		pcopyElems		(	const BasicMatrixCSR&		matrix		);
+	void		chkSameSize	(	const BasicMatrixCSR&		matrix		) const;
 	void		chkBound		(	size_t		row,
 									size_t		col
 								) const;
+	void		spmvRows		(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[],
+									size_t			startRow,
+									size_t			endRow
+								) const;
+	BasicMatrixCSR	multiplyElems	(	const BasicMatrixCSR&	operand,
+										bool					useThread
+									) const;
+	BasicMatrixCSR	scaleElems		(	elem_t		operand,
+										bool		useThread
+									) const;
+	BasicMatrixCSR	transposeElems	(	bool		useThread	) const;
+	void		combineElems	(	size_t						num,
+									const elem_t				coef[],
+									const BasicMatrixCSR* const	operand[],
+									bool						useThread
+								);
+	bool		compareElems	(	const BasicMatrixCSR&	operand,
+									bool					useThread
+								) const;
+	void		doThreadFunc	(	FuncKind	kind,
+									OpInfo&		info,
+									bool		useThread,
+									size_t		work
+								) const;
+private:
+	template<class U>
+	static U*		allocArray		(	size_t		num		);
+	static void		freeArray		(	void*		ptr		);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadFunc				(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadMultiplySymbolic	(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadMultiplyNumeric	(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadSpmv				(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCombineSymbolic	(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCombineNumeric	(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadElemMul			(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCopy				(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCompare			(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadTouch				(	void*	pData	);
 };
 
+typedef	BasicMatrixCSR<double>	MatrixCSR;		///< double 요소 행렬
+
 /**
  * 행렬 덧셈
- * @return		행렬 덧셈 결과
+ * 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+ * @return		행렬 덧셈 표현식
  */
-MatrixCSR		MatrixCSR::operator+		(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+LinearExpr<BasicMatrixCSR<T, I>, 2>		BasicMatrixCSR<T, I>::operator+		(	const BasicMatrixCSR&	operand	///< 피연산자
 													) const
 {
-	return	add(operand);
+	return	LinearExpr<BasicMatrixCSR, 1>(1, *this) + operand;
 }
 
 /**
  * 행렬 뺄셈
- * @return		행렬 뺄셈 결과
+ * 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+ * @return		행렬 뺄셈 표현식
  */
-MatrixCSR		MatrixCSR::operator-		(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+LinearExpr<BasicMatrixCSR<T, I>, 2>		BasicMatrixCSR<T, I>::operator-		(	const BasicMatrixCSR&	operand	///< 피연산자
 													) const
 {
-	return	sub(operand);
+	return	LinearExpr<BasicMatrixCSR, 1>(1, *this) - operand;
 }
 
 /**
  * 행렬 곱셈
  * @return		행렬 곱셈 결과
  */
-MatrixCSR		MatrixCSR::operator*		(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::operator*		(	const BasicMatrixCSR&	operand	///< 피연산자
 													) const
 {
 	return	multiply(operand);
 }
 
 /**
- * 행렬 곱셈
- * @return		행렬 곱셈 결과
+ * 행렬 x 단일 값
+ * 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+ * @return		행렬 x 단일 값 표현식
  */
-MatrixCSR		MatrixCSR::operator*		(	elem_t		operand	///< 피연산자
+template<class T, class I>
+LinearExpr<BasicMatrixCSR<T, I>, 1>		BasicMatrixCSR<T, I>::operator*		(	elem_t		operand	///< 피연산자
 													) const
 {
-	return	multiply(operand);
+	return	LinearExpr<BasicMatrixCSR, 1>(operand, *this);
 }
 
 /**
  * 행렬 대입
  * @return		대입 할 행렬
  */
-const MatrixCSR&		MatrixCSR::operator=		(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::operator=		(	const BasicMatrixCSR&	operand	///< 피연산자
 															)
 {
 	return	equal(operand);
 }
 
+/**
+ * 행렬 이동 대입
+ * 데이터를 복사하지 않고 피연산자와 맞바꾸며, 기존 데이터는 피연산자가 소멸할 때 해제된다.
+ * @return		대입 된 행렬
+ */
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::operator=		(	BasicMatrixCSR&&			operand	///< 피연산자
+															)
+{
+	swap(operand);
+
+	return	*this;
+}
+
+/**
+ * 행렬 덧셈 (결과를 자신에 저장)
+ * @return		덧셈 결과
+ */
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::operator+=		(	const BasicMatrixCSR&	operand	///< 피연산자
+															)
+{
+	return	axpy(1, operand);
+}
+
+/**
+ * 행렬 뺄셈 (결과를 자신에 저장)
+ * @return		뺄셈 결과
+ */
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::operator-=		(	const BasicMatrixCSR&	operand	///< 피연산자
+															)
+{
+	return	axpy(-1, operand);
+}
+
+/**
+ * 행렬 x 단일 값 (결과를 자신에 저장)
+ * @return		곱셈 결과
+ */
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::operator*=		(	elem_t		operand	///< 피연산자
+															)
+{
+	return	scale(operand);
+}
+
+/**
+ * 표현식 계산 결과로 생성
+ * 모든 항을 combine()으로 한 번에 계산한다.
+ */
+template<class T, class I>
+template<size_t N>
+BasicMatrixCSR<T, I>::BasicMatrixCSR		(	const LinearExpr<BasicMatrixCSR, N>&	expr	///< 계산 할 표현식
+			)
+:mColSize(0),
+mRowSize(0),
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
+{
+	combine(N, expr.getCoef(), expr.getOperand());
+}
+
+/**
+ * 생성자 (SparseMatrix2 변환)
+ * 행 형식이 열 순서를 지키지 않는 행 (HashRow)은 열 위치를 정렬한 후 값을 다시 찾는다.
+ */
+template<class T, class I>
+template<class R>
+BasicMatrixCSR<T, I>::BasicMatrixCSR			(	const BasicSparseMatrix2<T, R>&	matrix		///< 변환 할 행렬
+								)
+:mColSize(0),
+mRowSize(0),
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
+{
+	allocElems(matrix.getRow(), matrix.getCol());
+
+	size_t		size	=	0;
+
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		size	+=	matrix.mData[row].mMap.size();
+
+		if( size > std::numeric_limits<index_t>::max() )
+		{
+			freeElems();
+			throw matrix::ErrMsg::createErrMsg("요소 수가 위치 형식 범위를 넘습니다.");
+		}
+
+		mRowStart[row+1]	=	size;
+	}
+
+	reserveElems(size);
+	placeElems();
+
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		const R&	map		=	matrix.mData[row].mMap;
+		size_t		pos		=	mRowStart[row];
+
+		for(typename BasicSparseMatrix2<T, R>::elem_map_itor itor=map.begin();itor!=map.end();++itor)
+		{
+			mColIdx[pos]	=	itor->first;
+			mValue[pos]		=	itor->second;
+			pos++;
+		}
+
+		if( std::is_sorted(&mColIdx[mRowStart[row]], &mColIdx[pos]) == false )
+		{
+			std::sort(&mColIdx[mRowStart[row]], &mColIdx[pos]);
+
+			for(size_t cnt=mRowStart[row];cnt<pos;++cnt)
+			{
+				mValue[cnt]		=	map.at(mColIdx[cnt]);
+			}
+		}
+	}
+}
+
+/**
+ * 표현식 대입
+ * 모든 항을 combine()으로 한 번에 계산하며, 자신이 피연산자이어도 된다.
+ * @return		대입 된 행렬
+ */
+template<class T, class I>
+template<size_t N>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::operator=		(	const LinearExpr<BasicMatrixCSR, N>&	expr	///< 계산 할 표현식
+														)
+{
+	combine(N, expr.getCoef(), expr.getOperand());
+
+	return	*this;
+}
+
+/**
+ * 표현식 덧셈 (결과를 자신에 저장)
+ * 한 항이면 axpy(), 여러 항이면 자신을 포함한 표현식으로 계산한다.
+ * @return		덧셈 결과
+ */
+template<class T, class I>
+template<size_t N>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::operator+=		(	const LinearExpr<BasicMatrixCSR, N>&	expr	///< 더할 표현식
+														)
+{
+	if( N == 1 )
+	{
+		return	axpy(expr.getCoef()[0], *expr.getOperand()[0]);
+	}
+
+	return	operator=(*this + expr);
+}
+
+/**
+ * 표현식 뺄셈 (결과를 자신에 저장)
+ * 한 항이면 axpy(), 여러 항이면 자신을 포함한 표현식으로 계산한다.
+ * @return		뺄셈 결과
+ */
+template<class T, class I>
+template<size_t N>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::operator-=		(	const LinearExpr<BasicMatrixCSR, N>&	expr	///< 뺄 표현식
+														)
+{
+	if( N == 1 )
+	{
+		return	axpy(-expr.getCoef()[0], *expr.getOperand()[0]);
+	}
+
+	return	operator=(*this - expr);
+}
+
 /**
  * 행렬 비교
  * @return		비교 결과
  */
-bool	MatrixCSR::operator==	(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+bool	BasicMatrixCSR<T, I>::operator==	(	const BasicMatrixCSR&	operand	///< 피연산자
 										) const
 {
 	return	compare(operand);
@@ -157,7 +519,8 @@ bool	MatrixCSR::operator==	(	const MatrixCSR&	operand	///< 피연산자
  * 행렬 객체가 유효한지 검사
  * @return		행렬 객체가 유효하면 true, 유효하지 않으면 false
  */
-bool	MatrixCSR::isValid		(	void	)
+template<class T, class I>
+bool	BasicMatrixCSR<T, I>::isValid		(	void	)
 {
 	bool	ret		=	false;
 
@@ -174,7 +537,8 @@ bool	MatrixCSR::isValid		(	void	)
  * 행 크기 가져오기
  * @return		행 크기
  */
-size_t	MatrixCSR::getCol		(	void	) const
+template<class T, class I>
+size_t	BasicMatrixCSR<T, I>::getCol		(	void	) const
 {
 	return	mColSize;
 }
@@ -183,7 +547,8 @@ size_t	MatrixCSR::getCol		(	void	) const
  * 열 크기 가져오기
  * @return		열 크기
  */
-size_t	MatrixCSR::getRow		(	void	) const
+template<class T, class I>
+size_t	BasicMatrixCSR<T, I>::getRow		(	void	) const
 {
 	return	mRowSize;
 }
@@ -192,9 +557,48 @@ size_t	MatrixCSR::getRow		(	void	) const
  * 행렬 요소 데이터 수 가져오기
  * @return		요소 데이터 크기
  */
-size_t	MatrixCSR::getSize		(	void	) const
+template<class T, class I>
+size_t	BasicMatrixCSR<T, I>::getSize		(	void	) const
+{
+	size_t	size	=	0;
+
+	if( mRowStart != NULL )
+	{
+		size	=	mRowStart[mRowSize];
+	}
+
+	return	size;
+}
+
+/**
+ * 행 별 시작 위치 배열 가져오기 (getRow() + 1 개)
+ * 복사 없이 외부 코드에 넘길 수 있으며, 행렬을 수정하거나 소멸하면 더 이상 사용할 수 없다.
+ * @return		행 별 시작 위치 배열
+ */
+template<class T, class I>
+const I*	BasicMatrixCSR<T, I>::getRowStart		(	void	) const
+{
+	return	mRowStart;
+}
+
+/**
+ * 요소 열 위치 배열 가져오기 (getSize() 개, 행 안에서 열 순서는 보장하지 않음)
+ * @return		요소 열 위치 배열
+ */
+template<class T, class I>
+const I*	BasicMatrixCSR<T, I>::getColIdx		(	void	) const
+{
+	return	mColIdx;
+}
+
+/**
+ * 요소 값 배열 가져오기 (getSize() 개)
+ * @return		요소 값 배열
+ */
+template<class T, class I>
+const T*	BasicMatrixCSR<T, I>::getValue		(	void	) const
 {
-	return	mData.size();
+	return	mValue;
 }
 
 }
@@ -0,0 +1,225 @@
+/*
+ * matrix_expr.h
+ *
+ *  Created on: 2015. 8. 17.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_EXPR_H_
+#define INCLUDE_MATRIX_EXPR_H_
+
+#include "matrix_typedef.h"
+
+namespace	matrix
+{
+
+/**
+ * 행렬 선형 결합 표현식 (coef[0] * operand[0] + ... + coef[N-1] * operand[N-1])
+ * 행렬의 +, -, x 단일 값 연산은 중간 결과 행렬을 만들지 않고 이 객체를 돌려주며,
+ * 행렬을 생성하거나 대입할 때 MatrixType::combine()으로 모든 항을 한 번에 계산한다.
+ * 피연산자의 주소만 가지므로 표현식은 같은 문장 안에서만 사용해야 한다.
+ */
+template<class MatrixType, size_t N>
+class	LinearExpr
+{
+public:
+	typedef	typename MatrixType::elem_t		elem_t;		///< 계수 형식 (행렬 요소 형식)
+private:
+	elem_t				mCoef[N];		///< 항 별 계수
+	const MatrixType*	mOperand[N];	///< 항 별 피연산자
+
+	template<class, size_t>	friend class	LinearExpr;
+public:
+	inline		LinearExpr		(	elem_t				coef,
+									const MatrixType&	operand
+								);
+	template<size_t A>
+	inline		LinearExpr		(	const LinearExpr<MatrixType, A>&		exprA,
+									const LinearExpr<MatrixType, N - A>&	exprB,
+									elem_t									coefB
+								);
+public:
+	inline LinearExpr<MatrixType, N + 1>	operator+	(	const MatrixType&	operand	) const;
+	inline LinearExpr<MatrixType, N + 1>	operator-	(	const MatrixType&	operand	) const;
+	template<size_t K>
+	inline LinearExpr<MatrixType, N + K>	operator+	(	const LinearExpr<MatrixType, K>&	operand	) const;
+	template<size_t K>
+	inline LinearExpr<MatrixType, N + K>	operator-	(	const LinearExpr<MatrixType, K>&	operand	) const;
+	inline LinearExpr<MatrixType, N>		operator*	(	elem_t		operand		) const;
+	inline MatrixType						operator*	(	const MatrixType&	operand	) const;
+public:
+	inline size_t					getTermNum		(	void	) const;
+	inline const elem_t*			getCoef			(	void	) const;
+	inline const MatrixType* const*	getOperand		(	void	) const;
+};
+
+/**
+ * 생성자 (coef * operand 한 항)
+ */
+template<class MatrixType, size_t N>
+LinearExpr<MatrixType, N>::LinearExpr	(	elem_t				coef,		///< 계수
+											const MatrixType&	operand		///< 피연산자
+										)
+{
+	static_assert(N == 1, "한 항 표현식만 만들 수 있습니다.");
+
+	mCoef[0]		=	coef;
+	mOperand[0]		=	&operand;
+}
+
+/**
+ * 생성자 (exprA + coefB * exprB)
+ */
+template<class MatrixType, size_t N>
+template<size_t A>
+LinearExpr<MatrixType, N>::LinearExpr	(	const LinearExpr<MatrixType, A>&		exprA,	///< 앞 표현식
+											const LinearExpr<MatrixType, N - A>&	exprB,	///< 뒤 표현식
+											elem_t									coefB	///< 뒤 표현식에 곱할 값
+										)
+{
+	for(size_t cnt=0;cnt<A;++cnt)
+	{
+		mCoef[cnt]			=	exprA.mCoef[cnt];
+		mOperand[cnt]		=	exprA.mOperand[cnt];
+	}
+
+	for(size_t cnt=0;cnt<N-A;++cnt)
+	{
+		mCoef[A+cnt]		=	coefB * exprB.mCoef[cnt];
+		mOperand[A+cnt]		=	exprB.mOperand[cnt];
+	}
+}
+
+/**
+ * 표현식 + 행렬
+ * @return		항이 추가 된 표현식
+ */
+template<class MatrixType, size_t N>
+LinearExpr<MatrixType, N + 1>	LinearExpr<MatrixType, N>::operator+	(	const MatrixType&	operand	///< 피연산자
+																		) const
+{
+	return	LinearExpr<MatrixType, N + 1>(*this, LinearExpr<MatrixType, 1>(1, operand), 1);
+}
+
+/**
+ * 표현식 - 행렬
+ * @return		항이 추가 된 표현식
+ */
+template<class MatrixType, size_t N>
+LinearExpr<MatrixType, N + 1>	LinearExpr<MatrixType, N>::operator-	(	const MatrixType&	operand	///< 피연산자
+																		) const
+{
+	return	LinearExpr<MatrixType, N + 1>(*this, LinearExpr<MatrixType, 1>(1, operand), -1);
+}
+
+/**
+ * 표현식 + 표현식
+ * @return		두 표현식의 항을 합친 표현식
+ */
+template<class MatrixType, size_t N>
+template<size_t K>
+LinearExpr<MatrixType, N + K>	LinearExpr<MatrixType, N>::operator+	(	const LinearExpr<MatrixType, K>&	operand	///< 피연산자
+																		) const
+{
+	return	LinearExpr<MatrixType, N + K>(*this, operand, 1);
+}
+
+/**
+ * 표현식 - 표현식
+ * @return		두 표현식의 항을 합친 표현식
+ */
+template<class MatrixType, size_t N>
+template<size_t K>
+LinearExpr<MatrixType, N + K>	LinearExpr<MatrixType, N>::operator-	(	const LinearExpr<MatrixType, K>&	operand	///< 피연산자
+																		) const
+{
+	return	LinearExpr<MatrixType, N + K>(*this, operand, -1);
+}
+
+/**
+ * 표현식 x 단일 값
+ * @return		모든 계수에 값을 곱한 표현식
+ */
+template<class MatrixType, size_t N>
+LinearExpr<MatrixType, N>	LinearExpr<MatrixType, N>::operator*	(	elem_t		operand		///< 피연산자
+																	) const
+{
+	LinearExpr<MatrixType, N>	result	=	*this;
+
+	for(size_t cnt=0;cnt<N;++cnt)
+	{
+		result.mCoef[cnt]	*=	operand;
+	}
+
+	return	result;
+}
+
+/**
+ * 표현식 x 행렬
+ * 표현식을 먼저 계산한 후 행렬 곱셈을 한다.
+ * @return		행렬 곱셈 결과
+ */
+template<class MatrixType, size_t N>
+MatrixType	LinearExpr<MatrixType, N>::operator*	(	const MatrixType&	operand	///< 피연산자
+													) const
+{
+	return	MatrixType(*this) * operand;
+}
+
+/**
+ * 항 수 가져오기
+ * @return		항 수
+ */
+template<class MatrixType, size_t N>
+size_t	LinearExpr<MatrixType, N>::getTermNum	(	void	) const
+{
+	return	N;
+}
+
+/**
+ * 항 별 계수 가져오기
+ * @return		계수 배열
+ */
+template<class MatrixType, size_t N>
+const typename MatrixType::elem_t*	LinearExpr<MatrixType, N>::getCoef	(	void	) const
+{
+	return	mCoef;
+}
+
+/**
+ * 항 별 피연산자 가져오기
+ * @return		피연산자 주소 배열
+ */
+template<class MatrixType, size_t N>
+const MatrixType* const*	LinearExpr<MatrixType, N>::getOperand	(	void	) const
+{
+	return	mOperand;
+}
+
+/**
+ * 행렬 + 표현식
+ * @return		항이 추가 된 표현식
+ */
+template<class MatrixType, size_t N>
+LinearExpr<MatrixType, N + 1>	operator+	(	const MatrixType&					operandA,	///< 앞 피연산자
+												const LinearExpr<MatrixType, N>&	operandB	///< 뒤 피연산자
+											)
+{
+	return	LinearExpr<MatrixType, N + 1>(LinearExpr<MatrixType, 1>(1, operandA), operandB, 1);
+}
+
+/**
+ * 행렬 - 표현식
+ * @return		항이 추가 된 표현식
+ */
+template<class MatrixType, size_t N>
+LinearExpr<MatrixType, N + 1>	operator-	(	const MatrixType&					operandA,	///< 앞 피연산자
+												const LinearExpr<MatrixType, N>&	operandB	///< 뒤 피연산자
+											)
+{
+	return	LinearExpr<MatrixType, N + 1>(LinearExpr<MatrixType, 1>(1, operandA), operandB, -1);
+}
+
+};
+
+#endif /* INCLUDE_MATRIX_EXPR_H_ */
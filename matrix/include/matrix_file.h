@@ -0,0 +1,242 @@
+/*
+ * matrix_file.h
+ *
+ *  Created on: 2015. 8. 12.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_FILE_H_
+#define INCLUDE_MATRIX_FILE_H_
+
+#include <stdio.h>
+#include "matrix_typedef.h"
+
+namespace	matrix
+{
+
+template<class T>			class	BasicMatrix;
+template<class T, class I>	class	BasicMatrixCSR;
+template<class T, class I>	class	BasicSparseMatrix;
+template<class T, class R>	class	BasicSparseMatrix2;
+
+typedef	BasicMatrix<double>					Matrix;
+typedef	BasicMatrixCSR<double, index_t>		MatrixCSR;
+typedef	BasicSparseMatrix<double, index_t>	SparseMatrix;
+typedef	BasicSparseMatrix2<double>			SparseMatrix2;
+class	MatrixBuilder;
+
+/**
+ * 읽기 전용 파일 매핑
+ * 객체가 소멸할 때 매핑을 해제한다.
+ */
+class	MappedFile
+{
+private:
+	const char*		mAddr;		///< 매핑 된 주소
+	size_t			mSize;		///< 파일 크기
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	HANDLE			mFile;		///< 파일 핸들
+	HANDLE			mMap;		///< 파일 매핑 핸들
+
+#endif
+
+public:
+				MappedFile		(	const char	fileName[]	);
+	virtual		~MappedFile		(	void	);
+private:
+				MappedFile		(	const MappedFile&	file	);
+	const MappedFile&	operator=	(	const MappedFile&	file	);
+public:
+	inline const char*	getAddr		(	void	) const;
+	inline size_t		getSize		(	void	) const;
+};
+
+/**
+ * 매핑 된 주소 가져오기
+ * @return 매핑 된 주소
+ */
+const char*		MappedFile::getAddr		(	void	) const
+{
+	return	mAddr;
+}
+
+/**
+ * 파일 크기 가져오기
+ * @return 파일 크기
+ */
+size_t		MappedFile::getSize		(	void	) const
+{
+	return	mSize;
+}
+
+/**
+ * 행렬 파일 입출력
+ *
+ * 이진 CSR 파일 형식 (버전 1)
+ * | 헤더 | 행 별 시작 위치 (행 + 1 개) | 열 위치 (요소 수) | 요소 값 (요소 수) |
+ * 각 배열은 CSR_FILE_ALIGN 바이트 경계에서 시작하고, 사이는 0으로 채운다.
+ * 배열은 index_t / elem_t 형식 그대로 저장하므로, 같은 형식을 쓰는 환경에서는
+ * 파일을 매핑하여 복사 없이 MatrixCSR로 사용할 수 있다.
+ * 위치 형식 크기가 다른 파일 (4 / 8 바이트)은 읽을 때 index_t로 변환하여 복사한다.
+ *
+ * Matrix Market 파일 (.mtx)
+ * coordinate / array 형식의 real, integer, pattern 값과 general, symmetric, skew-symmetric 대칭을 읽는다.
+ * 파일을 매핑한 후 줄 단위 경계로 나눈 구간을 쓰레드 풀에서 동시에 해석하여 MatrixBuilder에 바로 채운다.
+ * 쓰기는 Matrix는 array, 나머지 형식은 coordinate real general 형식으로 저장한다.
+ */
+class	MatrixFile
+{
+public:
+	struct		CSRHeader
+	{
+		char		magic[8];			///< 파일 식별자 ("MTXCSR")
+		uint32_t	version;			///< 형식 버전
+		uint32_t	headerSize;			///< 헤더 크기
+		uint32_t	byteOrder;			///< 바이트 순서 확인 값
+		uint32_t	indexSize;			///< 위치 형식 크기
+		uint32_t	valueSize;			///< 요소 값 형식 크기
+		uint32_t	align;				///< 배열 정렬 크기
+		uint64_t	rowSize;			///< 행 크기
+		uint64_t	colSize;			///< 열 크기
+		uint64_t	elemSize;			///< 요소 수
+		uint64_t	rowStartOffset;		///< 행 별 시작 위치 배열 위치
+		uint64_t	colIdxOffset;		///< 열 위치 배열 위치
+		uint64_t	valueOffset;		///< 요소 값 배열 위치
+		uint64_t	fileSize;			///< 파일 크기
+	};
+	enum	MtxFormat
+	{
+		MTX_COORDINATE,			///< (행, 열, 값) 목록
+		MTX_ARRAY,				///< 열 순서의 전체 값
+	};
+	enum	MtxField
+	{
+		MTX_REAL,				///< 실수
+		MTX_INTEGER,			///< 정수
+		MTX_PATTERN,			///< 값 없음 (1로 읽음)
+	};
+	enum	MtxSymmetry
+	{
+		MTX_GENERAL,			///< 대칭 없음
+		MTX_SYMMETRIC,			///< 아래 삼각만 저장, a(j,i) = a(i,j)
+		MTX_SKEW_SYMMETRIC,		///< 아래 삼각만 저장, a(j,i) = -a(i,j)
+	};
+	struct		MtxHeader
+	{
+		MtxFormat		format;
+		MtxField		field;
+		MtxSymmetry		symmetry;
+		size_t			rowSize;		///< 행 크기
+		size_t			colSize;		///< 열 크기
+		size_t			entrySize;		///< 파일에 저장 된 값 수
+		size_t			dataOffset;		///< 값 목록 시작 위치
+	};
+	struct		MtxChunk
+	{
+		const MtxHeader*	header;
+		MatrixBuilder*		builder;
+		const char*			start;			///< 구간 시작 위치
+		const char*			end;			///< 구간 종료 위치 (미포함)
+		size_t				entryNum;		///< 구간의 값 수
+		size_t				firstEntry;		///< 구간 첫 값의 파일 내 순서
+		size_t				offset;			///< 빌더 요소 배열 기록 시작 위치
+		size_t				elemNum;		///< 빌더에 기록한 요소 수
+		const char*			error;			///< 해석 실패 사유 (NULL이면 성공)
+	};
+	struct		ColIdxChunk
+	{
+		const index_t*		colIdx;			///< 매핑 된 열 위치 배열
+		size_t				start;			///< 구간 시작 위치
+		size_t				end;			///< 구간 종료 위치 (미포함)
+		uint64_t			colSize;		///< 열 크기
+		bool				valid;			///< 모든 열 위치가 열 크기 안에 있는지 여부
+	};
+private:
+				MatrixFile		(	void	);
+public:
+	static void		saveCSR			(	const MatrixCSR&	matrix,
+										const char			fileName[]
+									);
+	static void		loadCSR			(	MatrixCSR&			matrix,
+										const char			fileName[]
+									);
+	static void		convertText		(	const char		textFileName[],
+										size_t			row,
+										size_t			col,
+										const char		csrFileName[]
+									);
+	static bool		isCSRFile		(	const char		fileName[]	);
+	static void		readMtx			(	Matrix&			matrix,
+										const char		fileName[]
+									);
+	static void		readMtx			(	MatrixCSR&		matrix,
+										const char		fileName[]
+									);
+	static void		readMtx			(	SparseMatrix&	matrix,
+										const char		fileName[]
+									);
+	static void		readMtx			(	SparseMatrix2&	matrix,
+										const char		fileName[]
+									);
+	static void		writeMtx		(	const Matrix&			matrix,
+										const char				fileName[]
+									);
+	static void		writeMtx		(	const MatrixCSR&		matrix,
+										const char				fileName[]
+									);
+	static void		writeMtx		(	const SparseMatrix&		matrix,
+										const char				fileName[]
+									);
+	static void		writeMtx		(	const SparseMatrix2&	matrix,
+										const char				fileName[]
+									);
+private:
+	static void		writeCSR		(	const char		fileName[],
+										size_t			row,
+										size_t			col,
+										const index_t	rowStart[],
+										const index_t	colIdx[],
+										const elem_t	value[]
+									);
+	static void		writeBlock		(	FILE*			file,
+										const void*		data,
+										size_t			size,
+										uint64_t		offset,
+										uint64_t&		pos
+									);
+	static void		chkHeader		(	const CSRHeader&	header,
+										size_t				fileSize
+									);
+	static void		chkColIdx		(	const index_t	colIdx[],
+										size_t			size,
+										uint64_t		colSize
+									);
+	static uint64_t	readIndex		(	const char*		addr,
+										uint32_t		indexSize,
+										size_t			pos
+									);
+	static void		readMtxHeader	(	const MappedFile&	file,
+										MtxHeader&			header
+									);
+	static void		parseMtx		(	const MappedFile&	file,
+										const MtxHeader&	header,
+										MatrixBuilder&		builder
+									);
+	static FILE*	openMtx			(	const char		fileName[],
+										MtxFormat		format,
+										size_t			row,
+										size_t			col,
+										size_t			size
+									);
+	static void		closeMtx		(	FILE*		file	);
+private:
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCountMtx		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadParseMtx		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadChkColIdx		(	void*	pData	);
+};
+
+};
+
+#endif /* INCLUDE_MATRIX_FILE_H_ */
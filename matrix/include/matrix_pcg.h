@@ -0,0 +1,129 @@
+/*
+ * matrix_pcg.h
+ *
+ *  Created on: 2015. 8. 10.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_PCG_H_
+#define INCLUDE_MATRIX_PCG_H_
+
+#include <stdio.h>
+#include <math.h>
+#include "matrix_typedef.h"
+#include "matrix_error.h"
+#include "matrix_simd.h"
+#include "matrix_precond.h"
+
+namespace	matrix
+{
+
+/**
+ * 전처리 켤레 기울기법 (Preconditioned Conjugate Gradient)
+ * pspmv(x, y)를 제공하는 모든 행렬 형식에 사용할 수 있다.
+ * 상대 잔차 |b - A * x| / |b| 가 limit 보다 작아지거나 iteration 번 반복하면 끝낸다.
+ * 복소수 행렬은 켤레 없는 내적을 사용하므로 복소 대칭 행렬에 대해 COCG로 동작한다.
+ * @return 수행한 반복 횟수
+ * @exception 행렬과 전처리기 크기가 다르거나 메모리 할당 실패 시 예외 발생
+ */
+template<class MatrixType, class I>
+uint32_t	sol_pcg		(	const MatrixType&											matrix,			///< 계수 행렬 (대칭 양의 정부호)
+							const BasicPreconditioner<typename MatrixType::elem_t, I>&	precond,		///< 전처리기
+							const typename MatrixType::elem_t							b[],			///< 우변 벡터
+							typename MatrixType::elem_t									x[],			///< 초기 값 / 해 벡터
+							uint32_t													iteration,		///< 최대 반복 횟수
+							typename MatrixType::real_t									limit,			///< 상대 잔차 한계
+							typename MatrixType::real_t&								rangeResult		///< 마지막 상대 잔차
+						)
+{
+	typedef	typename MatrixType::elem_t		elem_t;
+	typedef	typename MatrixType::real_t		real_t;
+
+	size_t		size	=	matrix.getRow();
+
+	if( ( matrix.getCol() != size ) ||
+		( precond.getRow() != size ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
+	}
+
+	std::vector<elem_t>		r;
+	std::vector<elem_t>		z;
+	std::vector<elem_t>		p;
+	std::vector<elem_t>		ap;
+
+	try
+	{
+		r.resize(size);
+		z.resize(size);
+		p.resize(size);
+		ap.resize(size);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	real_t		normB	=	std::sqrt(std::abs(SimdKernel::dot(b, b, size)));
+
+	rangeResult		=	0;
+
+	if( normB == 0 )
+	{
+		std::fill(x, x + size, elem_t(0));
+		return	0;
+	}
+
+	// r = b - A * x
+	std::copy(b, b + size, r.begin());
+	matrix.pspmv(elem_t(-1), x, elem_t(1), r.data());
+
+	precond.apply(r.data(), z.data());
+	std::copy(z.begin(), z.end(), p.begin());
+
+	elem_t		rz		=	SimdKernel::dot(r.data(), z.data(), size);
+	uint32_t	cnt		=	0;
+
+	rangeResult		=	std::sqrt(std::abs(SimdKernel::dot(r.data(), r.data(), size))) / normB;
+
+	while( ( cnt < iteration ) &&
+		   ( rangeResult >= limit ) )
+	{
+		matrix.pspmv(p.data(), ap.data());
+
+		elem_t		pap		=	SimdKernel::dot(p.data(), ap.data(), size);
+
+		// 양의 정부호가 아니면 더 진행할 수 없다.
+		if( elem_traits<elem_t>::isPositive(pap) != true )
+		{
+			break;
+		}
+
+		elem_t		alpha	=	rz / pap;
+
+		SimdKernel::axpy(alpha, p.data(), x, size);
+		SimdKernel::axpy(-alpha, ap.data(), r.data(), size);
+
+		cnt++;
+		rangeResult		=	std::sqrt(std::abs(SimdKernel::dot(r.data(), r.data(), size))) / normB;
+
+		if( rangeResult < limit )
+		{
+			break;
+		}
+
+		precond.apply(r.data(), z.data());
+
+		elem_t		rzNew	=	SimdKernel::dot(r.data(), z.data(), size);
+
+		// p = z + (rzNew / rz) * p
+		SimdKernel::axpby(elem_t(1), z.data(), rzNew / rz, p.data(), size);
+		rz		=	rzNew;
+	}
+
+	return	cnt;
+}
+
+};
+
+#endif /* INCLUDE_MATRIX_PCG_H_ */
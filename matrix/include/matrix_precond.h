@@ -0,0 +1,188 @@
+/*
+ * matrix_precond.h
+ *
+ *  Created on: 2015. 8. 10.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_PRECOND_H_
+#define INCLUDE_MATRIX_PRECOND_H_
+
+#include <stdio.h>
+#include "matrix_typedef.h"
+
+namespace	matrix
+{
+
+template<class T, class I>
+class	BasicMatrixCSR;
+
+/**
+ * 전처리기 (Preconditioner) 추상 클래스
+ * sol_pcg에서 매 반복마다 z = M^-1 * r 을 계산하는 데 사용한다.
+ */
+template<class T, class I = index_t>
+class	BasicPreconditioner
+{
+public:
+	typedef	T			elem_t;		///< 요소 데이터 형식
+	typedef	I			index_t;	///< 위치 데이터 형식
+	typedef	THREAD_RETURN_TYPE(THREAD_FUNC_TYPE *Operation)(void*);
+	/**
+	 * 삼각 행렬 (CSR, 대각 요소는 따로 저장)
+	 * 같은 수준(level)의 행은 서로 의존하지 않으므로 동시에 풀 수 있다.
+	 */
+	struct		Factor
+	{
+		std::vector<index_t>	rowStart;		///< 행 별 시작 위치 (대각 제외)
+		std::vector<index_t>	col;			///< 열 위치
+		std::vector<elem_t>		val;			///< 요소 값
+		std::vector<elem_t>		diag;			///< 대각 요소 (비어 있으면 단위 대각)
+		std::vector<size_t>		levelStart;		///< 수준 별 시작 위치
+		std::vector<size_t>		levelRow;		///< 수준 순서로 정렬 된 행
+	};
+	struct		SolveInfo
+	{
+		const Factor*	factor;
+		const elem_t*	b;
+		elem_t*			x;
+		size_t			start;		///< levelRow 시작 위치
+		size_t			end;		///< levelRow 종료 위치 (미포함)
+	};
+protected:
+	size_t		mRowSize;		///< 행 크기
+public:
+				BasicPreconditioner		(	void	);
+	virtual		~BasicPreconditioner	(	void	);
+public:
+	virtual void	apply		(	const elem_t	r[],
+									elem_t			z[]
+								) const = 0;
+public:
+	inline size_t	getRow		(	void	) const;
+protected:
+	static void		loadMatrix		(	const BasicMatrixCSR<T, I>&		matrix,
+										std::vector<index_t>&	rowStart,
+										std::vector<index_t>&	col,
+										std::vector<elem_t>&	val
+									);
+	static void		buildLevels		(	Factor&		factor,
+										bool		lower
+									);
+	static void		solve			(	const Factor&	factor,
+										const elem_t	b[],
+										elem_t			x[]
+									);
+	static void		chkSquare		(	const BasicMatrixCSR<T, I>&	matrix	);
+private:
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadSolve		(	void*	pData	);
+	static void		solveRows		(	const Factor&	factor,
+										const elem_t	b[],
+										elem_t			x[],
+										size_t			start,
+										size_t			end
+									);
+};
+
+typedef	BasicPreconditioner<double>		Preconditioner;
+
+/**
+ * 행 크기 가져오기
+ * @return 행 크기
+ */
+template<class T, class I>
+size_t	BasicPreconditioner<T, I>::getRow		(	void	) const
+{
+	return	mRowSize;
+}
+
+/**
+ * Jacobi 전처리기 (M = diag(A))
+ */
+template<class T, class I = index_t>
+class	BasicJacobiPrecond	:	public	BasicPreconditioner<T, I>
+{
+public:
+	typedef	T		elem_t;		///< 요소 데이터 형식
+private:
+	using	BasicPreconditioner<T, I>::mRowSize;
+	using	BasicPreconditioner<T, I>::chkSquare;
+
+	std::vector<elem_t>		mInvDiag;		///< 대각 요소 역수
+public:
+				BasicJacobiPrecond	(	const BasicMatrixCSR<T, I>&	matrix	);
+	virtual		~BasicJacobiPrecond	(	void	);
+public:
+	virtual void	apply		(	const elem_t	r[],
+									elem_t			z[]
+								) const;
+};
+
+typedef	BasicJacobiPrecond<double>		JacobiPrecond;
+
+/**
+ * 불완전 Cholesky 전처리기 IC(0) (M = L * L^T, L은 A의 아래 삼각과 같은 모양)
+ * A는 대칭 양의 정부호 행렬이어야 한다.
+ */
+template<class T, class I = index_t>
+class	BasicIC0Precond	:	public	BasicPreconditioner<T, I>
+{
+public:
+	typedef	T		elem_t;		///< 요소 데이터 형식
+	typedef	I		index_t;	///< 위치 데이터 형식
+private:
+	typedef	typename BasicPreconditioner<T, I>::Factor		Factor;
+
+	using	BasicPreconditioner<T, I>::mRowSize;
+	using	BasicPreconditioner<T, I>::loadMatrix;
+	using	BasicPreconditioner<T, I>::buildLevels;
+	using	BasicPreconditioner<T, I>::solve;
+	using	BasicPreconditioner<T, I>::chkSquare;
+
+	Factor		mLower;		///< L
+	Factor		mUpper;		///< L^T
+public:
+				BasicIC0Precond		(	const BasicMatrixCSR<T, I>&	matrix	);
+	virtual		~BasicIC0Precond		(	void	);
+public:
+	virtual void	apply		(	const elem_t	r[],
+									elem_t			z[]
+								) const;
+};
+
+typedef	BasicIC0Precond<double>		IC0Precond;
+
+/**
+ * 불완전 LU 전처리기 ILU(0) (M = L * U, L과 U는 A와 같은 모양)
+ */
+template<class T, class I = index_t>
+class	BasicILU0Precond	:	public	BasicPreconditioner<T, I>
+{
+public:
+	typedef	T		elem_t;		///< 요소 데이터 형식
+	typedef	I		index_t;	///< 위치 데이터 형식
+private:
+	typedef	typename BasicPreconditioner<T, I>::Factor		Factor;
+
+	using	BasicPreconditioner<T, I>::mRowSize;
+	using	BasicPreconditioner<T, I>::loadMatrix;
+	using	BasicPreconditioner<T, I>::buildLevels;
+	using	BasicPreconditioner<T, I>::solve;
+	using	BasicPreconditioner<T, I>::chkSquare;
+
+	Factor		mLower;		///< L (단위 대각)
+	Factor		mUpper;		///< U
+public:
+				BasicILU0Precond		(	const BasicMatrixCSR<T, I>&	matrix	);
+	virtual		~BasicILU0Precond	(	void	);
+public:
+	virtual void	apply		(	const elem_t	r[],
+									elem_t			z[]
+								) const;
+};
+
+typedef	BasicILU0Precond<double>		ILU0Precond;
+
+};
+
+#endif /* INCLUDE_MATRIX_PRECOND_H_ */
@@ -0,0 +1,1019 @@
+/*
+ * matrix_row.h
+ *
+ *  Created on: 2015. 9. 4.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_ROW_H_
+#define INCLUDE_MATRIX_ROW_H_
+
+#include "matrix_typedef.h"
+#include <stdint.h>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <algorithm>
+
+namespace	matrix
+{
+
+/**
+ * 정렬 된 벡터 행 (SparseMatrix2 행 데이터)
+ * 요소를 열 순서로 연속 저장하므로 순서대로 읽는 연산 (곱셈, 덧셈, 변환)이 빠르며,
+ * 중간 위치 삽입 / 삭제는 뒤 요소를 옮긴다.
+ * std::map과 같은 방법으로 사용할 수 있는 기능만 제공한다.
+ */
+template<class T, class A = NodeAllocator< std::pair<size_t, T> > >
+class	SortedRow
+{
+public:
+	typedef	size_t								key_type;
+	typedef	T									mapped_type;
+	typedef	std::pair<size_t, T>				value_type;
+	typedef	A									allocator_type;
+	typedef	std::vector<value_type, A>			vector_t;
+	typedef	typename vector_t::iterator			iterator;
+	typedef	typename vector_t::const_iterator	const_iterator;
+private:
+	vector_t		mVector;		///< 열 순서로 정렬 된 요소
+public:
+				SortedRow		(	void	);
+	explicit	SortedRow		(	const allocator_type&	alloc	);
+public:
+	inline iterator			begin		(	void	);
+	inline iterator			end			(	void	);
+	inline const_iterator	begin		(	void	) const;
+	inline const_iterator	end			(	void	) const;
+	inline size_t			size		(	void	) const;
+	inline bool				empty		(	void	) const;
+	inline void				clear		(	void	);
+	inline void				swap		(	SortedRow&		row		);
+	inline allocator_type	get_allocator	(	void	) const;
+	iterator				find		(	size_t		key		);
+	const_iterator			find		(	size_t		key		) const;
+	T&						at			(	size_t		key		);
+	const T&				at			(	size_t		key		) const;
+	std::pair<iterator, bool>	insert	(	const value_type&	value	);
+	iterator				emplace_hint	(	const_iterator	hint,
+											size_t			key,
+											const T&		elem
+										);
+	iterator				erase		(	iterator	itor	);
+	size_t					erase		(	size_t		key		);
+public:
+	T&						operator[]	(	size_t		key		);
+private:
+	static inline bool		lessKey		(	const value_type&	elem,
+											size_t				key
+										);
+};
+
+/**
+ * 열린 주소 해시 행 (SparseMatrix2 행 데이터)
+ * 요소를 한 배열의 칸에 나누어 저장하고 선형 탐사로 찾으므로, 임의 위치 읽기 / 쓰기가 빠르다.
+ * 요소 순서는 정해지지 않으며, 삭제한 칸은 표시만 해 두고 배열을 다시 만들 때 정리한다.
+ * std::map과 같은 방법으로 사용할 수 있는 기능만 제공한다.
+ */
+template<class T, class A = NodeAllocator< std::pair<size_t, T> > >
+class	HashRow
+{
+public:
+	typedef	size_t								key_type;
+	typedef	T									mapped_type;
+	typedef	std::pair<size_t, T>				value_type;
+	typedef	A									allocator_type;
+	typedef	std::vector<value_type, A>			vector_t;
+	enum
+	{
+		MIN_SLOT_NUM	=	8,		///< 처음 배열 칸 수
+	};
+	static const size_t		EMPTY_KEY		=	~(size_t)0;			///< 빈 칸 표시
+	static const size_t		DELETED_KEY		=	~(size_t)0 - 1;		///< 삭제 된 칸 표시
+
+	/**
+	 * 사용 중인 칸만 차례로 가리키는 참조자
+	 */
+	template<class V>
+	class	Iterator
+	{
+	public:
+		typedef	std::forward_iterator_tag	iterator_category;
+		typedef	V							value_type;
+		typedef	ptrdiff_t					difference_type;
+		typedef	V*							pointer;
+		typedef	V&							reference;
+	private:
+		V*		mPos;			///< 현재 칸
+		V*		mEnd;			///< 배열 끝
+
+		template<class, class>	friend class	HashRow;
+		template<class>			friend class	Iterator;
+	public:
+		inline		Iterator		(	void	);
+		inline		Iterator		(	V*		pos,
+										V*		end
+									);
+		template<class U>
+		inline		Iterator		(	const Iterator<U>&	itor	);
+	public:
+		inline V&			operator*		(	void	) const;
+		inline V*			operator->		(	void	) const;
+		inline Iterator&	operator++		(	void	);
+		inline Iterator		operator++		(	int		);
+		inline bool			operator==		(	const Iterator&		itor	) const;
+		inline bool			operator!=		(	const Iterator&		itor	) const;
+	private:
+		inline void			skip			(	void	);
+	};
+
+	typedef	Iterator<value_type>			iterator;
+	typedef	Iterator<const value_type>		const_iterator;
+private:
+	vector_t		mSlot;			///< 칸 배열 (크기는 0 또는 2의 거듭제곱)
+	size_t			mSize;			///< 요소 수
+	size_t			mUsed;			///< 요소 수 + 삭제 된 칸 수
+	size_t			mShift;			///< 해시 값에서 칸 번호를 얻기 위해 버리는 비트 수
+public:
+				HashRow			(	void	);
+	explicit	HashRow			(	const allocator_type&	alloc	);
+public:
+	inline iterator			begin		(	void	);
+	inline iterator			end			(	void	);
+	inline const_iterator	begin		(	void	) const;
+	inline const_iterator	end			(	void	) const;
+	inline size_t			size		(	void	) const;
+	inline bool				empty		(	void	) const;
+	void					clear		(	void	);
+	void					swap		(	HashRow&		row		);
+	inline allocator_type	get_allocator	(	void	) const;
+	iterator				find		(	size_t		key		);
+	const_iterator			find		(	size_t		key		) const;
+	T&						at			(	size_t		key		);
+	const T&				at			(	size_t		key		) const;
+	std::pair<iterator, bool>	insert	(	const value_type&	value	);
+	iterator				emplace_hint	(	const_iterator	hint,
+											size_t			key,
+											const T&		elem
+										);
+	iterator				erase		(	iterator	itor	);
+	size_t					erase		(	size_t		key		);
+public:
+	T&						operator[]	(	size_t		key		);
+private:
+	size_t					findSlot	(	size_t		key		) const;
+	size_t					insertSlot	(	size_t		key,
+											const T&	elem
+										);
+	void					rehash		(	size_t		slotNum	);
+	inline size_t			getHome		(	size_t		key		) const;
+};
+
+/////////////////////////////
+// SortedRow
+
+/**
+ * 생성자
+ */
+template<class T, class A>
+SortedRow<T, A>::SortedRow		(	void	)
+{
+}
+
+/**
+ * 생성자
+ */
+template<class T, class A>
+SortedRow<T, A>::SortedRow		(	const allocator_type&	alloc	///< 요소 할당자
+								)
+:mVector(alloc)
+{
+}
+
+/**
+ * 첫 요소 참조자 가져오기
+ * @return 첫 요소 참조자
+ */
+template<class T, class A>
+typename SortedRow<T, A>::iterator	SortedRow<T, A>::begin		(	void	)
+{
+	return	mVector.begin();
+}
+
+/**
+ * 끝 참조자 가져오기
+ * @return 끝 참조자
+ */
+template<class T, class A>
+typename SortedRow<T, A>::iterator	SortedRow<T, A>::end		(	void	)
+{
+	return	mVector.end();
+}
+
+/**
+ * 첫 요소 상수 참조자 가져오기
+ * @return 첫 요소 상수 참조자
+ */
+template<class T, class A>
+typename SortedRow<T, A>::const_iterator	SortedRow<T, A>::begin		(	void	) const
+{
+	return	mVector.begin();
+}
+
+/**
+ * 끝 상수 참조자 가져오기
+ * @return 끝 상수 참조자
+ */
+template<class T, class A>
+typename SortedRow<T, A>::const_iterator	SortedRow<T, A>::end		(	void	) const
+{
+	return	mVector.end();
+}
+
+/**
+ * 요소 수 가져오기
+ * @return 요소 수
+ */
+template<class T, class A>
+size_t	SortedRow<T, A>::size		(	void	) const
+{
+	return	mVector.size();
+}
+
+/**
+ * 요소가 없는지 검사
+ * @return 요소가 없으면 true
+ */
+template<class T, class A>
+bool	SortedRow<T, A>::empty		(	void	) const
+{
+	return	mVector.empty();
+}
+
+/**
+ * 모든 요소 제거
+ */
+template<class T, class A>
+void	SortedRow<T, A>::clear		(	void	)
+{
+	mVector.clear();
+}
+
+/**
+ * 행 맞바꾸기
+ */
+template<class T, class A>
+void	SortedRow<T, A>::swap		(	SortedRow&		row		///< 맞바꿀 행
+									)
+{
+	mVector.swap(row.mVector);
+}
+
+/**
+ * 요소 할당자 가져오기
+ * @return 요소 할당자
+ */
+template<class T, class A>
+typename SortedRow<T, A>::allocator_type	SortedRow<T, A>::get_allocator		(	void	) const
+{
+	return	mVector.get_allocator();
+}
+
+/**
+ * 요소 찾기
+ * @return 찾은 요소 참조자 (없으면 end())
+ */
+template<class T, class A>
+typename SortedRow<T, A>::iterator	SortedRow<T, A>::find		(	size_t		key		///< 열 위치
+																)
+{
+	iterator	itor	=	std::lower_bound(mVector.begin(), mVector.end(), key, lessKey);
+
+	if( ( itor != mVector.end() ) && ( itor->first == key ) )
+	{
+		return	itor;
+	}
+
+	return	mVector.end();
+}
+
+/**
+ * 요소 찾기
+ * @return 찾은 요소 상수 참조자 (없으면 end())
+ */
+template<class T, class A>
+typename SortedRow<T, A>::const_iterator	SortedRow<T, A>::find		(	size_t		key		///< 열 위치
+																		) const
+{
+	const_iterator	itor	=	std::lower_bound(mVector.begin(), mVector.end(), key, lessKey);
+
+	if( ( itor != mVector.end() ) && ( itor->first == key ) )
+	{
+		return	itor;
+	}
+
+	return	mVector.end();
+}
+
+/**
+ * 요소 값 참조
+ * @exception 요소가 없으면 std::out_of_range 발생
+ * @return 요소 값
+ */
+template<class T, class A>
+T&		SortedRow<T, A>::at		(	size_t		key		///< 열 위치
+								)
+{
+	iterator	itor	=	find(key);
+
+	if( itor == mVector.end() )
+	{
+		throw	std::out_of_range("SortedRow::at");
+	}
+
+	return	itor->second;
+}
+
+/**
+ * 요소 값 참조
+ * @exception 요소가 없으면 std::out_of_range 발생
+ * @return 요소 값
+ */
+template<class T, class A>
+const T&	SortedRow<T, A>::at		(	size_t		key		///< 열 위치
+									) const
+{
+	const_iterator	itor	=	find(key);
+
+	if( itor == mVector.end() )
+	{
+		throw	std::out_of_range("SortedRow::at");
+	}
+
+	return	itor->second;
+}
+
+/**
+ * 요소 삽입
+ * 같은 열 위치의 요소가 있으면 바꾸지 않는다.
+ * @return 삽입 된 (또는 기존) 요소 참조자와 삽입 여부
+ */
+template<class T, class A>
+std::pair<typename SortedRow<T, A>::iterator, bool>	SortedRow<T, A>::insert		(	const value_type&	value	///< 삽입 할 요소
+																				)
+{
+	iterator	itor	=	std::lower_bound(mVector.begin(), mVector.end(), value.first, lessKey);
+
+	if( ( itor != mVector.end() ) && ( itor->first == value.first ) )
+	{
+		return	std::make_pair(itor, false);
+	}
+
+	return	std::make_pair(mVector.insert(itor, value), true);
+}
+
+/**
+ * 위치 힌트를 이용한 요소 삽입
+ * 끝 위치 힌트로 열 순서대로 삽입하면 뒤에 붙이기만 한다.
+ * @return 삽입 된 (또는 기존) 요소 참조자
+ */
+template<class T, class A>
+typename SortedRow<T, A>::iterator	SortedRow<T, A>::emplace_hint	(	const_iterator	hint,	///< 삽입 위치 힌트
+																		size_t			key,	///< 열 위치
+																		const T&		elem	///< 요소 값
+																	)
+{
+	if( ( hint == mVector.end() ) &&
+		( ( mVector.empty() == true ) || ( mVector.back().first < key ) ) )
+	{
+		mVector.push_back(value_type(key, elem));
+
+		return	mVector.end() - 1;
+	}
+
+	return	insert(value_type(key, elem)).first;
+}
+
+/**
+ * 요소 삭제
+ * @return 삭제 한 요소 다음 참조자
+ */
+template<class T, class A>
+typename SortedRow<T, A>::iterator	SortedRow<T, A>::erase		(	iterator	itor	///< 삭제 할 요소
+																)
+{
+	return	mVector.erase(itor);
+}
+
+/**
+ * 요소 삭제
+ * @return 삭제 한 요소 수
+ */
+template<class T, class A>
+size_t	SortedRow<T, A>::erase		(	size_t		key		///< 열 위치
+									)
+{
+	iterator	itor	=	find(key);
+
+	if( itor == mVector.end() )
+	{
+		return	0;
+	}
+
+	mVector.erase(itor);
+
+	return	1;
+}
+
+/**
+ * 요소 값 참조 (없으면 0 값 요소를 삽입)
+ * @return 요소 값
+ */
+template<class T, class A>
+T&		SortedRow<T, A>::operator[]		(	size_t		key		///< 열 위치
+										)
+{
+	iterator	itor	=	std::lower_bound(mVector.begin(), mVector.end(), key, lessKey);
+
+	if( ( itor == mVector.end() ) || ( itor->first != key ) )
+	{
+		itor	=	mVector.insert(itor, value_type(key, T()));
+	}
+
+	return	itor->second;
+}
+
+/**
+ * 열 위치 비교
+ * @return 요소의 열 위치가 작으면 true
+ */
+template<class T, class A>
+bool	SortedRow<T, A>::lessKey		(	const value_type&	elem,	///< 요소
+											size_t				key		///< 열 위치
+										)
+{
+	return	( elem.first < key );
+}
+
+/////////////////////////////
+// HashRow::Iterator
+
+/**
+ * 생성자
+ */
+template<class T, class A>
+template<class V>
+HashRow<T, A>::Iterator<V>::Iterator		(	void	)
+:mPos(NULL),
+ mEnd(NULL)
+{
+}
+
+/**
+ * 생성자
+ * 지정한 칸부터 사용 중인 첫 칸을 가리킨다.
+ */
+template<class T, class A>
+template<class V>
+HashRow<T, A>::Iterator<V>::Iterator		(	V*		pos,	///< 시작 칸
+												V*		end		///< 배열 끝
+											)
+:mPos(pos),
+ mEnd(end)
+{
+	skip();
+}
+
+/**
+ * 상수 참조자로 변환
+ */
+template<class T, class A>
+template<class V>
+template<class U>
+HashRow<T, A>::Iterator<V>::Iterator		(	const Iterator<U>&	itor	///< 원본 참조자
+											)
+:mPos(itor.mPos),
+ mEnd(itor.mEnd)
+{
+}
+
+/**
+ * 요소 참조
+ * @return 요소
+ */
+template<class T, class A>
+template<class V>
+V&		HashRow<T, A>::Iterator<V>::operator*		(	void	) const
+{
+	return	*mPos;
+}
+
+/**
+ * 요소 참조
+ * @return 요소 주소
+ */
+template<class T, class A>
+template<class V>
+V*		HashRow<T, A>::Iterator<V>::operator->		(	void	) const
+{
+	return	mPos;
+}
+
+/**
+ * 다음 요소로 이동
+ * @return 이동 한 참조자
+ */
+template<class T, class A>
+template<class V>
+typename HashRow<T, A>::template Iterator<V>&	HashRow<T, A>::Iterator<V>::operator++		(	void	)
+{
+	++mPos;
+	skip();
+
+	return	*this;
+}
+
+/**
+ * 다음 요소로 이동
+ * @return 이동 전 참조자
+ */
+template<class T, class A>
+template<class V>
+typename HashRow<T, A>::template Iterator<V>	HashRow<T, A>::Iterator<V>::operator++		(	int		)
+{
+	Iterator	itor	=	*this;
+
+	++(*this);
+
+	return	itor;
+}
+
+/**
+ * 참조자 비교
+ * @return 같은 칸이면 true
+ */
+template<class T, class A>
+template<class V>
+bool	HashRow<T, A>::Iterator<V>::operator==		(	const Iterator&		itor	///< 비교 할 참조자
+													) const
+{
+	return	mPos == itor.mPos;
+}
+
+/**
+ * 참조자 비교
+ * @return 다른 칸이면 true
+ */
+template<class T, class A>
+template<class V>
+bool	HashRow<T, A>::Iterator<V>::operator!=		(	const Iterator&		itor	///< 비교 할 참조자
+													) const
+{
+	return	mPos != itor.mPos;
+}
+
+/**
+ * 빈 칸과 삭제 된 칸 건너뛰기
+ */
+template<class T, class A>
+template<class V>
+void	HashRow<T, A>::Iterator<V>::skip		(	void	)
+{
+	while( ( mPos != mEnd ) && ( mPos->first >= DELETED_KEY ) )
+	{
+		++mPos;
+	}
+}
+
+/////////////////////////////
+// HashRow
+
+template<class T, class A>
+const size_t	HashRow<T, A>::EMPTY_KEY;
+template<class T, class A>
+const size_t	HashRow<T, A>::DELETED_KEY;
+
+/**
+ * 생성자
+ * 칸 배열은 처음 삽입할 때 만든다.
+ */
+template<class T, class A>
+HashRow<T, A>::HashRow		(	void	)
+:mSize(0),
+ mUsed(0),
+ mShift(0)
+{
+}
+
+/**
+ * 생성자
+ */
+template<class T, class A>
+HashRow<T, A>::HashRow		(	const allocator_type&	alloc	///< 요소 할당자
+							)
+:mSlot(alloc),
+ mSize(0),
+ mUsed(0),
+ mShift(0)
+{
+}
+
+/**
+ * 첫 요소 참조자 가져오기
+ * @return 첫 요소 참조자
+ */
+template<class T, class A>
+typename HashRow<T, A>::iterator	HashRow<T, A>::begin		(	void	)
+{
+	value_type*		data	=	mSlot.empty() ? NULL : &mSlot[0];
+
+	return	iterator(data, data + mSlot.size());
+}
+
+/**
+ * 끝 참조자 가져오기
+ * @return 끝 참조자
+ */
+template<class T, class A>
+typename HashRow<T, A>::iterator	HashRow<T, A>::end		(	void	)
+{
+	value_type*		data	=	mSlot.empty() ? NULL : &mSlot[0];
+
+	return	iterator(data + mSlot.size(), data + mSlot.size());
+}
+
+/**
+ * 첫 요소 상수 참조자 가져오기
+ * @return 첫 요소 상수 참조자
+ */
+template<class T, class A>
+typename HashRow<T, A>::const_iterator	HashRow<T, A>::begin		(	void	) const
+{
+	const value_type*	data	=	mSlot.empty() ? NULL : &mSlot[0];
+
+	return	const_iterator(data, data + mSlot.size());
+}
+
+/**
+ * 끝 상수 참조자 가져오기
+ * @return 끝 상수 참조자
+ */
+template<class T, class A>
+typename HashRow<T, A>::const_iterator	HashRow<T, A>::end		(	void	) const
+{
+	const value_type*	data	=	mSlot.empty() ? NULL : &mSlot[0];
+
+	return	const_iterator(data + mSlot.size(), data + mSlot.size());
+}
+
+/**
+ * 요소 수 가져오기
+ * @return 요소 수
+ */
+template<class T, class A>
+size_t	HashRow<T, A>::size		(	void	) const
+{
+	return	mSize;
+}
+
+/**
+ * 요소가 없는지 검사
+ * @return 요소가 없으면 true
+ */
+template<class T, class A>
+bool	HashRow<T, A>::empty		(	void	) const
+{
+	return	( mSize == 0 );
+}
+
+/**
+ * 모든 요소 제거
+ * 칸 배열은 유지한다.
+ */
+template<class T, class A>
+void	HashRow<T, A>::clear		(	void	)
+{
+	if( mUsed != 0 )
+	{
+		for(size_t cnt=0;cnt<mSlot.size();++cnt)
+		{
+			mSlot[cnt].first	=	EMPTY_KEY;
+		}
+	}
+
+	mSize	=	0;
+	mUsed	=	0;
+}
+
+/**
+ * 행 맞바꾸기
+ */
+template<class T, class A>
+void	HashRow<T, A>::swap		(	HashRow&		row		///< 맞바꿀 행
+								)
+{
+	mSlot.swap(row.mSlot);
+	std::swap(mSize, row.mSize);
+	std::swap(mUsed, row.mUsed);
+	std::swap(mShift, row.mShift);
+}
+
+/**
+ * 요소 할당자 가져오기
+ * @return 요소 할당자
+ */
+template<class T, class A>
+typename HashRow<T, A>::allocator_type	HashRow<T, A>::get_allocator		(	void	) const
+{
+	return	mSlot.get_allocator();
+}
+
+/**
+ * 요소 찾기
+ * @return 찾은 요소 참조자 (없으면 end())
+ */
+template<class T, class A>
+typename HashRow<T, A>::iterator	HashRow<T, A>::find		(	size_t		key		///< 열 위치
+															)
+{
+	size_t		slot	=	findSlot(key);
+
+	if( slot == mSlot.size() )
+	{
+		return	end();
+	}
+
+	return	iterator(&mSlot[slot], &mSlot[0] + mSlot.size());
+}
+
+/**
+ * 요소 찾기
+ * @return 찾은 요소 상수 참조자 (없으면 end())
+ */
+template<class T, class A>
+typename HashRow<T, A>::const_iterator	HashRow<T, A>::find		(	size_t		key		///< 열 위치
+																) const
+{
+	size_t		slot	=	findSlot(key);
+
+	if( slot == mSlot.size() )
+	{
+		return	end();
+	}
+
+	return	const_iterator(&mSlot[slot], &mSlot[0] + mSlot.size());
+}
+
+/**
+ * 요소 값 참조
+ * @exception 요소가 없으면 std::out_of_range 발생
+ * @return 요소 값
+ */
+template<class T, class A>
+T&		HashRow<T, A>::at		(	size_t		key		///< 열 위치
+								)
+{
+	size_t		slot	=	findSlot(key);
+
+	if( slot == mSlot.size() )
+	{
+		throw	std::out_of_range("HashRow::at");
+	}
+
+	return	mSlot[slot].second;
+}
+
+/**
+ * 요소 값 참조
+ * @exception 요소가 없으면 std::out_of_range 발생
+ * @return 요소 값
+ */
+template<class T, class A>
+const T&	HashRow<T, A>::at		(	size_t		key		///< 열 위치
+									) const
+{
+	size_t		slot	=	findSlot(key);
+
+	if( slot == mSlot.size() )
+	{
+		throw	std::out_of_range("HashRow::at");
+	}
+
+	return	mSlot[slot].second;
+}
+
+/**
+ * 요소 삽입
+ * 같은 열 위치의 요소가 있으면 바꾸지 않는다.
+ * @return 삽입 된 (또는 기존) 요소 참조자와 삽입 여부
+ */
+template<class T, class A>
+std::pair<typename HashRow<T, A>::iterator, bool>	HashRow<T, A>::insert		(	const value_type&	value	///< 삽입 할 요소
+																			)
+{
+	size_t		slot	=	findSlot(value.first);
+	bool		ret		=	false;
+
+	if( slot == mSlot.size() )
+	{
+		slot	=	insertSlot(value.first, value.second);
+		ret		=	true;
+	}
+
+	return	std::make_pair(iterator(&mSlot[slot], &mSlot[0] + mSlot.size()), ret);
+}
+
+/**
+ * 요소 삽입 (위치 힌트는 사용하지 않음)
+ * @return 삽입 된 (또는 기존) 요소 참조자
+ */
+template<class T, class A>
+typename HashRow<T, A>::iterator	HashRow<T, A>::emplace_hint	(	const_iterator	/*hint*/,	///< 삽입 위치 힌트 (사용 안 함)
+																	size_t			key,	///< 열 위치
+																	const T&		elem	///< 요소 값
+																)
+{
+	return	insert(value_type(key, elem)).first;
+}
+
+/**
+ * 요소 삭제
+ * 칸은 삭제 표시만 하므로 다른 요소의 참조자는 그대로 유효하다.
+ * @return 삭제 한 요소 다음 참조자
+ */
+template<class T, class A>
+typename HashRow<T, A>::iterator	HashRow<T, A>::erase		(	iterator	itor	///< 삭제 할 요소
+															)
+{
+	itor.mPos->first	=	DELETED_KEY;
+	--mSize;
+
+	return	++itor;
+}
+
+/**
+ * 요소 삭제
+ * @return 삭제 한 요소 수
+ */
+template<class T, class A>
+size_t	HashRow<T, A>::erase		(	size_t		key		///< 열 위치
+									)
+{
+	size_t		slot	=	findSlot(key);
+
+	if( slot == mSlot.size() )
+	{
+		return	0;
+	}
+
+	mSlot[slot].first	=	DELETED_KEY;
+	--mSize;
+
+	return	1;
+}
+
+/**
+ * 요소 값 참조 (없으면 0 값 요소를 삽입)
+ * @return 요소 값
+ */
+template<class T, class A>
+T&		HashRow<T, A>::operator[]		(	size_t		key		///< 열 위치
+										)
+{
+	size_t		slot	=	findSlot(key);
+
+	if( slot == mSlot.size() )
+	{
+		slot	=	insertSlot(key, T());
+	}
+
+	return	mSlot[slot].second;
+}
+
+/**
+ * 요소 칸 찾기
+ * @return 요소 칸 번호 (없으면 칸 수)
+ */
+template<class T, class A>
+size_t	HashRow<T, A>::findSlot		(	size_t		key		///< 열 위치
+									) const
+{
+	if( mSize == 0 )
+	{
+		return	mSlot.size();
+	}
+
+	size_t		mask	=	mSlot.size() - 1;
+
+	for(size_t slot=getHome(key);;slot=(slot + 1) & mask)
+	{
+		size_t		slotKey		=	mSlot[slot].first;
+
+		if( slotKey == key )
+		{
+			return	slot;
+		}
+
+		if( slotKey == EMPTY_KEY )
+		{
+			return	mSlot.size();
+		}
+	}
+}
+
+/**
+ * 없는 요소를 칸에 삽입
+ * 사용 중인 칸이 3/4을 넘으면 배열을 다시 만들며, 삭제 된 칸이 많으면 크기를 유지하고 정리만 한다.
+ * @return 삽입 한 칸 번호
+ */
+template<class T, class A>
+size_t	HashRow<T, A>::insertSlot		(	size_t		key,	///< 열 위치
+											const T&	elem	///< 요소 값
+										)
+{
+	if( ( mUsed + 1 ) * 4 > mSlot.size() * 3 )
+	{
+		size_t		slotNum		=	std::max(mSlot.size(), (size_t)MIN_SLOT_NUM);
+
+		if( ( mSize + 1 ) * 2 > slotNum )
+		{
+			slotNum		*=	2;
+		}
+
+		rehash(slotNum);
+	}
+
+	size_t		mask	=	mSlot.size() - 1;
+	size_t		slot	=	getHome(key);
+
+	while( mSlot[slot].first < DELETED_KEY )
+	{
+		slot	=	(slot + 1) & mask;
+	}
+
+	if( mSlot[slot].first == EMPTY_KEY )
+	{
+		++mUsed;
+	}
+
+	mSlot[slot]		=	value_type(key, elem);
+	++mSize;
+
+	return	slot;
+}
+
+/**
+ * 칸 배열 다시 만들기
+ * 삭제 된 칸을 정리하고 모든 요소를 새 배열에 다시 넣는다.
+ */
+template<class T, class A>
+void	HashRow<T, A>::rehash		(	size_t		slotNum		///< 새 칸 수 (2의 거듭제곱)
+									)
+{
+	vector_t	slot(slotNum, value_type(EMPTY_KEY, T()), mSlot.get_allocator());
+
+	mSlot.swap(slot);
+
+	mShift	=	64;
+
+	for(size_t num=slotNum;num>1;num>>=1)
+	{
+		--mShift;
+	}
+
+	size_t		mask	=	slotNum - 1;
+
+	for(size_t cnt=0;cnt<slot.size();++cnt)
+	{
+		if( slot[cnt].first < DELETED_KEY )
+		{
+			size_t		pos		=	getHome(slot[cnt].first);
+
+			while( mSlot[pos].first != EMPTY_KEY )
+			{
+				pos		=	(pos + 1) & mask;
+			}
+
+			mSlot[pos]	=	slot[cnt];
+		}
+	}
+
+	mUsed	=	mSize;
+}
+
+/**
+ * 요소의 첫 탐사 칸 가져오기
+ * 열 위치에 황금비 상수를 곱한 상위 비트를 사용하므로 연속 된 열도 고르게 흩어진다.
+ * @return 칸 번호
+ */
+template<class T, class A>
+size_t	HashRow<T, A>::getHome		(	size_t		key		///< 열 위치
+									) const
+{
+	return	(size_t)( ( (uint64_t)key * 0x9E3779B97F4A7C15ULL ) >> mShift );
+}
+
+};
+
+#endif /* INCLUDE_MATRIX_ROW_H_ */
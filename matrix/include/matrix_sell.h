@@ -0,0 +1,219 @@
+/*
+ * matrix_sell.h
+ *
+ *  Created on: 2015. 8. 24.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_SELL_H_
+#define INCLUDE_MATRIX_SELL_H_
+
+#include <stdio.h>
+#include "matrix_typedef.h"
+
+namespace	matrix
+{
+
+template<class T, class I>
+class	BasicMatrixCSR;
+
+/**
+* 희소 행렬 표현 클래스 (SELL-C-sigma, Sliced ELLPACK)
+* 정렬 된 순서의 행을 CHUNK_SIZE(C) 개씩 묶고, 묶음 안의 가장 긴 행 길이만큼 채워 열 우선 순서로 저장한다.
+* 같은 순서 j의 C 개 요소가 연속되므로 벡터 명령의 각 lane이 한 행씩 동시에 계산한다.
+* 채우는 요소를 줄이기 위해 sigma 개 행 범위 안에서 행을 길이가 긴 순서로 정렬한다. (sigma가 1이면 정렬 안 함)
+* MatrixCSR에서 변환하여 만드는 읽기 전용 형식으로, 행렬 x 벡터와 이를 사용하는 반복 법 (sol_pcg)에 사용한다.
+*/
+template<class T, class I = index_t>
+class	BasicMatrixSELL
+{
+public:
+	typedef	T									elem_t;		///< 요소 데이터 형식
+	typedef	typename elem_traits<T>::real_t		real_t;		///< 크기 (norm) 형식
+	typedef	I									index_t;	///< 열 위치 형식
+	enum
+	{
+		CHUNK_SIZE		=	8,			///< 묶음 행 수 (C, double AVX-512 벡터 1개 / AVX2 벡터 2개)
+		DEFAULT_SIGMA	=	256,		///< 기본 정렬 범위 행 수
+	};
+	typedef	void	(*ChunkFunc)	(	const elem_t*	value,
+										const index_t*	colIdx,
+										size_t			width,
+										const elem_t	x[],
+										elem_t			sum[]
+									);
+	struct		OpInfo
+	{
+		const BasicMatrixSELL*	operand;
+		elem_t					alpha;		///< 행렬 x 벡터 계수
+		const elem_t*			vecX;		///< 입력 벡터
+		elem_t					beta;		///< 결과 벡터 계수
+		elem_t*					vecY;		///< 결과 벡터
+	};
+private:
+	struct		FuncInfo
+	{
+		OpInfo					opInfo;
+		size_t					startChunk;
+		size_t					endChunk;
+	};
+
+	size_t				mRowSize;		///< 행 크기
+	size_t				mColSize;		///< 열 크기
+	size_t				mSize;			///< 요소 수 (채운 요소 제외)
+	size_t				mSigma;			///< 정렬 범위 행 수
+	size_t				mChunkNum;		///< 묶음 수
+	size_t*				mChunkStart;	///< 묶음 별 시작 위치 (mChunkNum + 1 개)
+	index_t*			mColIdx;		///< 요소 열 위치 (채운 요소는 같은 행의 열 위치)
+	elem_t*				mValue;			///< 요소 값 (채운 요소는 0)
+	index_t*			mRowPerm;		///< 정렬 된 순서 별 원래 행 위치 (mRowSize 개)
+	ChunkFunc			mChunkFunc;		///< 묶음 계산 함수
+public:
+				BasicMatrixSELL		(	void	);
+	explicit	BasicMatrixSELL		(	const BasicMatrixCSR<T, I>&	matrix,
+										size_t						sigma	=	DEFAULT_SIGMA
+									);
+				BasicMatrixSELL		(	const BasicMatrixSELL&		matrix		);
+				BasicMatrixSELL		(	BasicMatrixSELL&&			matrix		);
+	virtual		~BasicMatrixSELL	(	void	);
+public:
+	void		swap			(	BasicMatrixSELL&	operand		);
+	void		spmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		spmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+	void		pspmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		pspmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+public:
+	inline const BasicMatrixSELL&		operator=		(	const BasicMatrixSELL&	operand	);
+	inline const BasicMatrixSELL&		operator=		(	BasicMatrixSELL&&		operand	);
+public:
+	inline size_t	getCol			(	void	) const;
+	inline size_t	getRow			(	void	) const;
+	inline size_t	getSize			(	void	) const;
+	inline size_t	getPaddedSize	(	void	) const;
+	inline size_t	getSigma		(	void	) const;
+private:
+	void		allocElems		(	size_t		row,
+									size_t		col,
+									size_t		paddedSize
+								);
+	void		freeElems		(	void	);
+	void		copyElems		(	const BasicMatrixSELL&	matrix	);
+	void		spmvChunks		(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[],
+									size_t			startChunk,
+									size_t			endChunk
+								) const;
+private:
+	static ChunkFunc	selectChunkFunc		(	size_t		col		);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadSpmv		(	void*	pData	);
+};
+
+typedef	BasicMatrixSELL<double>	MatrixSELL;		///< double 요소 행렬
+
+/**
+ * 행렬 대입
+ * @return		대입 된 행렬
+ */
+template<class T, class I>
+const BasicMatrixSELL<T, I>&		BasicMatrixSELL<T, I>::operator=		(	const BasicMatrixSELL&	operand	///< 피연산자
+																)
+{
+	if( this != &operand )
+	{
+		BasicMatrixSELL		copy(operand);
+
+		swap(copy);
+	}
+
+	return	*this;
+}
+
+/**
+ * 행렬 이동 대입
+ * 데이터를 복사하지 않고 피연산자와 맞바꾸며, 기존 데이터는 피연산자가 소멸할 때 해제된다.
+ * @return		대입 된 행렬
+ */
+template<class T, class I>
+const BasicMatrixSELL<T, I>&		BasicMatrixSELL<T, I>::operator=		(	BasicMatrixSELL&&		operand	///< 피연산자
+																)
+{
+	swap(operand);
+
+	return	*this;
+}
+
+/**
+ * 열 크기 가져오기
+ * @return		열 크기
+ */
+template<class T, class I>
+size_t	BasicMatrixSELL<T, I>::getCol		(	void	) const
+{
+	return	mColSize;
+}
+
+/**
+ * 행 크기 가져오기
+ * @return		행 크기
+ */
+template<class T, class I>
+size_t	BasicMatrixSELL<T, I>::getRow		(	void	) const
+{
+	return	mRowSize;
+}
+
+/**
+ * 행렬 요소 데이터 수 가져오기 (채운 요소 제외)
+ * @return		요소 데이터 크기
+ */
+template<class T, class I>
+size_t	BasicMatrixSELL<T, I>::getSize		(	void	) const
+{
+	return	mSize;
+}
+
+/**
+ * 채운 요소를 포함한 저장 요소 수 가져오기
+ * getSize()와의 차이가 행렬 x 벡터에서 더 읽는 요소 수이다.
+ * @return		저장 요소 수
+ */
+template<class T, class I>
+size_t	BasicMatrixSELL<T, I>::getPaddedSize		(	void	) const
+{
+	size_t	size	=	0;
+
+	if( mChunkStart != NULL )
+	{
+		size	=	mChunkStart[mChunkNum];
+	}
+
+	return	size;
+}
+
+/**
+ * 정렬 범위 행 수 가져오기
+ * @return		정렬 범위 행 수
+ */
+template<class T, class I>
+size_t	BasicMatrixSELL<T, I>::getSigma		(	void	) const
+{
+	return	mSigma;
+}
+
+};
+
+#endif /* INCLUDE_MATRIX_SELL_H_ */
@@ -0,0 +1,291 @@
+/*
+ * matrix_simd.h
+ *
+ *  Created on: 2015. 8. 3.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_MATRIX_SIMD_H_
+#define INCLUDE_MATRIX_SIMD_H_
+
+#include <stdio.h>
+#include "matrix_typedef.h"
+
+#define	SIMD_ALIGN		(64)		///< 벡터 명령용 배열 정렬 크기 (캐시 줄, AVX-512 벡터 크기)
+
+namespace	matrix
+{
+
+/**
+ * 연속 된 요소 배열에 대한 벡터 명령 연산
+ * 실행 시 CPU가 지원하는 명령(AVX-512, AVX2, SSE2) 중 가장 넓은 것을 한 번 골라 사용하고,
+ * 지원하지 않으면 일반 반복문으로 수행한다.
+ * elem_t 이외의 형식 (float, 복소수) 배열은 같은 이름의 템플릿 함수가 일반 반복문으로 수행한다.
+ */
+class	SimdKernel
+{
+public:
+	enum	InstSet
+	{
+		INST_SCALAR,		///< 벡터 명령 사용 안 함
+		INST_SSE2,			///< SSE2 (128 bit)
+		INST_AVX2,			///< AVX2 + FMA (256 bit)
+		INST_AVX512,		///< AVX-512F (512 bit)
+	};
+	typedef	void	(*BinaryFunc)	(	const elem_t*	a,
+										const elem_t*	b,
+										elem_t*			c,
+										size_t			num
+									);
+	typedef	void	(*UnaryFunc)	(	elem_t			alpha,
+										const elem_t*	a,
+										elem_t*			c,
+										size_t			num
+									);
+	typedef	elem_t	(*DotFunc)		(	const elem_t*	a,
+										const elem_t*	b,
+										size_t			num
+									);
+	typedef	void	(*AxpbyFunc)	(	elem_t			alpha,
+										const elem_t*	x,
+										elem_t			beta,
+										elem_t*			y,
+										size_t			num
+									);
+	struct		FuncTable
+	{
+		InstSet			instSet;
+		BinaryFunc		add;
+		BinaryFunc		sub;
+		UnaryFunc		scale;
+		UnaryFunc		axpy;
+		AxpbyFunc		axpby;
+		DotFunc			dot;
+	};
+private:
+				SimdKernel		(	void	);
+public:
+	static InstSet	getInstSet	(	void	);
+	static void		add			(	const elem_t*	a,
+									const elem_t*	b,
+									elem_t*			c,
+									size_t			num
+								);
+	static void		sub			(	const elem_t*	a,
+									const elem_t*	b,
+									elem_t*			c,
+									size_t			num
+								);
+	static void		scale		(	elem_t			alpha,
+									const elem_t*	a,
+									elem_t*			c,
+									size_t			num
+								);
+	static void		axpy		(	elem_t			alpha,
+									const elem_t*	x,
+									elem_t*			y,
+									size_t			num
+								);
+	static void		axpby		(	elem_t			alpha,
+									const elem_t*	x,
+									elem_t			beta,
+									elem_t*			y,
+									size_t			num
+								);
+	static elem_t	dot			(	const elem_t*	a,
+									const elem_t*	b,
+									size_t			num
+								);
+	static void		transpose	(	const elem_t*	a,
+									size_t			row,
+									size_t			col,
+									elem_t*			c
+								);
+	static void*	allocAligned	(	size_t		size	);
+	static void		freeAligned		(	void*		ptr		);
+public:
+	template<class T>
+	static inline void	add			(	const T*	a,
+										const T*	b,
+										T*			c,
+										size_t		num
+									);
+	template<class T>
+	static inline void	sub			(	const T*	a,
+										const T*	b,
+										T*			c,
+										size_t		num
+									);
+	template<class T>
+	static inline void	scale		(	T			alpha,
+										const T*	a,
+										T*			c,
+										size_t		num
+									);
+	template<class T>
+	static inline void	axpy		(	T			alpha,
+										const T*	x,
+										T*			y,
+										size_t		num
+									);
+	template<class T>
+	static inline void	axpby		(	T			alpha,
+										const T*	x,
+										T			beta,
+										T*			y,
+										size_t		num
+									);
+	template<class T>
+	static inline T		dot			(	const T*	a,
+										const T*	b,
+										size_t		num
+									);
+	template<class T>
+	static inline void	transpose	(	const T*	a,
+										size_t		row,
+										size_t		col,
+										T*			c
+									);
+private:
+	static const FuncTable&		getTable		(	void	);
+	static FuncTable			selectTable		(	void	);
+};
+
+/**
+ * 요소 별 덧셈 (c = a + b, 일반 반복문)
+ */
+template<class T>
+void	SimdKernel::add		(	const T*	a,		///< 피연산자
+								const T*	b,		///< 피연산자
+								T*			c,		///< 결과 (a, b와 같아도 됨)
+								size_t		num		///< 요소 수
+							)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		c[cnt]	=	a[cnt] + b[cnt];
+	}
+}
+
+/**
+ * 요소 별 뺄셈 (c = a - b, 일반 반복문)
+ */
+template<class T>
+void	SimdKernel::sub		(	const T*	a,		///< 피연산자
+								const T*	b,		///< 피연산자
+								T*			c,		///< 결과 (a, b와 같아도 됨)
+								size_t		num		///< 요소 수
+							)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		c[cnt]	=	a[cnt] - b[cnt];
+	}
+}
+
+/**
+ * 단일 값 곱셈 (c = alpha * a, 일반 반복문)
+ */
+template<class T>
+void	SimdKernel::scale	(	T			alpha,	///< 곱할 값
+								const T*	a,		///< 피연산자
+								T*			c,		///< 결과 (a와 같아도 됨)
+								size_t		num		///< 요소 수
+							)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		c[cnt]	=	alpha * a[cnt];
+	}
+}
+
+/**
+ * y += alpha * x (일반 반복문)
+ */
+template<class T>
+void	SimdKernel::axpy	(	T			alpha,	///< x 계수
+								const T*	x,		///< 피연산자
+								T*			y,		///< 누적 할 배열
+								size_t		num		///< 요소 수
+							)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		y[cnt]	+=	alpha * x[cnt];
+	}
+}
+
+/**
+ * y = alpha * x + beta * y (일반 반복문)
+ */
+template<class T>
+void	SimdKernel::axpby	(	T			alpha,	///< x 계수
+								const T*	x,		///< 피연산자
+								T			beta,	///< y 계수
+								T*			y,		///< 결과 배열
+								size_t		num		///< 요소 수
+							)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		y[cnt]	=	alpha * x[cnt] + beta * y[cnt];
+	}
+}
+
+/**
+ * 내적 (켤레 없이 sum a[i] * b[i], 일반 반복문)
+ * @return 내적 값
+ */
+template<class T>
+T		SimdKernel::dot		(	const T*	a,		///< 피연산자
+								const T*	b,		///< 피연산자
+								size_t		num		///< 요소 수
+							)
+{
+	T		sum		=	0;
+
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		sum		+=	a[cnt] * b[cnt];
+	}
+
+	return	sum;
+}
+
+/**
+ * 전치 변환 (c = a^T, 일반 반복문)
+ * 읽기와 쓰기가 모두 캐시 안에서 이루어지도록 32 x 32 블록 단위로 변환한다.
+ */
+template<class T>
+void	SimdKernel::transpose	(	const T*	a,		///< row x col 행렬
+									size_t		row,	///< 행 크기
+									size_t		col,	///< 열 크기
+									T*			c		///< col x row 결과 행렬 (a와 달라야 함)
+								)
+{
+	const size_t	block	=	32;
+
+	for(size_t rb=0;rb<row;rb+=block)
+	{
+		size_t		rEnd	=	std::min(row, rb + block);
+
+		for(size_t cb=0;cb<col;cb+=block)
+		{
+			size_t		cEnd	=	std::min(col, cb + block);
+
+			for(size_t r=rb;r<rEnd;++r)
+			{
+				const T*	src		=	a + r * col;
+
+				for(size_t cc=cb;cc<cEnd;++cc)
+				{
+					c[cc * row + r]		=	src[cc];
+				}
+			}
+		}
+	}
+}
+
+};
+
+#endif /* INCLUDE_MATRIX_SIMD_H_ */
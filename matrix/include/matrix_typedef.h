@@ -9,6 +9,7 @@
 #define MATRIX_TYPEDEF_H_
 
 #include <matrix_settings.h>
+#include <matrix_arena.h>
 #include <stdint.h>
 #include <vector>
 #include <array>
@@ -16,6 +17,9 @@
 #include <map>
 #include <numeric>
 #include <algorithm>
+#include <complex>
+#include <cmath>
+#include <limits>
 
 #if(PLATFORM == PLATFORM_WINDOWS)
 
@@ -43,19 +47,60 @@ enum	BOOLEAN
 namespace	matrix
 {
 
-typedef	double	elem_t;		///< 요소 데이터 형식
+typedef	double		elem_t;		///< 기본 요소 데이터 형식
+typedef	uint32_t	index_t;	///< 기본 위치 데이터 형식 (열 위치, 행 별 시작 위치)
 
-class	node_t
+/**
+ * 요소 데이터 형식 별 특성
+ * 행렬 클래스는 float, double, std::complex<float>, std::complex<double> 요소로 사용할 수 있다.
+ */
+template<class T>
+struct	elem_traits
+{
+	typedef	T	real_t;		///< 크기 (norm) 형식
+
+	/**
+	 * 분해 / 반복 법에서 피벗으로 사용할 수 있는 값인지 검사 (실수는 양수)
+	 * @return 사용할 수 있으면 true
+	 */
+	static inline bool	isPositive	(	T	val		)
+	{
+		return	( val > 0 );
+	}
+};
+
+template<class T>
+struct	elem_traits< std::complex<T> >
+{
+	typedef	T	real_t;		///< 크기 (norm) 형식
+
+	/**
+	 * 분해 / 반복 법에서 피벗으로 사용할 수 있는 값인지 검사
+	 * 복소수는 순서가 없으므로 0이 아니면 사용한다. (복소 대칭 행렬)
+	 * @return 사용할 수 있으면 true
+	 */
+	static inline bool	isPositive	(	const std::complex<T>&	val		)
+	{
+		return	( val != std::complex<T>(0) );
+	}
+};
+
+/**
+ * 희소 행렬 요소 (열 위치, 값)
+ * 열 위치 형식 I는 열 크기를 표현할 수 있어야 한다.
+ */
+template<class T, class I = index_t>
+class	basic_node_t
 {
 public:
-	size_t		mCol;
-	elem_t		mElem;
+	I			mCol;
+	T			mElem;
 
-	node_t		(	size_t		col,
-					elem_t		data
+	basic_node_t	(	size_t		col,
+					T			data
 				)
 	{
-		mCol	=	col;
+		mCol	=	(I)col;
 		mElem	=	data;
 	}
 public:
@@ -63,58 +108,38 @@ public:
 	{
 		return (mCol == col);
 	}
-};
-
-typedef	std::vector<node_t>::iterator		elem_vector_itor;	///< 한 개 행 데이터 참조자
-
-struct	vector_node_t
-{
-	std::vector<node_t>		mVector;
-
-#if(PLATFORM == PLATFORM_WINDOWS)
-	CRITICAL_SECTION	mLock;
-#elif(PLATFORM == PLATFORM_LINUX)
-	pthread_mutex_t		mLock	=	PTHREAD_MUTEX_INITIALIZER;
-#endif
-
-	vector_node_t	()
+	inline bool	operator<		(	size_t		col		) const
 	{
-		#if(PLATFORM == PLATFORM_WINDOWS)
-
-		::InitializeCriticalSectionEx	(	&mLock,
-											MAX_SPIN_COUNT,
-											NULL
-										);
-
-		#elif(PLATFORM == PLATFORM_LINUX)
-
-		mLock	=	PTHREAD_MUTEX_INITIALIZER;
-
-		#endif
+		return (mCol < col);
 	}
-	~vector_node_t ()
+	inline bool	operator<		(	const basic_node_t&	node	) const
 	{
-		#if(PLATFORM == PLATFORM_WINDOWS)
+		return (mCol < node.mCol);
+	}
+};
 
-		DeleteCriticalSection ( &mLock );
+template<class T, class I = index_t>
+struct	basic_vector_node_t
+{
+	typedef	std::vector< basic_node_t<T, I>, RowAllocator< basic_node_t<T, I> > >	row_t;	///< 한 개 행 데이터 형식
 
-		#endif
-	}
+	row_t		mVector;
 };
 
 /////////////////////////////
 
-class	node_t2
+template<class T, class I = index_t>
+class	basic_node_t2
 {
 public:
-	size_t		mRow;
-	elem_t		mElem;
+	I			mRow;
+	T			mElem;
 
-	node_t2	(	size_t		row,
-					elem_t		data
+	basic_node_t2	(	size_t		row,
+					T			data
 				)
 	{
-		mRow	=	row;
+		mRow	=	(I)row;
 		mElem	=	data;
 	}
 public:
@@ -124,83 +149,36 @@ public:
 	}
 };
 
-typedef	std::vector<node_t2>::iterator		elem_vector_itor2;	///< 한 개 행 데이터 참조자
-
-struct	vector_node_t2
+template<class T, class I = index_t>
+struct	basic_vector_node_t2
 {
-	std::vector<node_t2>		mVector;
-
-#if(PLATFORM == PLATFORM_WINDOWS)
-	CRITICAL_SECTION	mLock;
-#elif(PLATFORM == PLATFORM_LINUX)
-	pthread_mutex_t		mLock	=	PTHREAD_MUTEX_INITIALIZER;
-#endif
-
-	vector_node_t2()
-	{
-		#if(PLATFORM == PLATFORM_WINDOWS)
-
-		::InitializeCriticalSectionEx	(	&mLock,
-											MAX_SPIN_COUNT,
-											NULL
-										);
-
-		#elif(PLATFORM == PLATFORM_LINUX)
-
-		mLock	=	PTHREAD_MUTEX_INITIALIZER;
-
-		#endif
-	}
-
-	~vector_node_t2 ()
-	{
-		#if(PLATFORM == PLATFORM_WINDOWS)
-
-		DeleteCriticalSection ( &mLock );
-
-		#endif
-	}
+	std::vector< basic_node_t2<T, I> >	mVector;
 };
 
 /////////////////////////////
 
 
-typedef	std::map<size_t, elem_t>::const_iterator	elem_map_itor;		///< 한 개 행 데이터 참조자
-
-struct	map_node_t
+template<class T, class R = std::map< size_t, T, std::less<size_t>, NodeAllocator< std::pair<const size_t, T> > > >
+struct	basic_map_node_t
 {
-	std::map<size_t, elem_t>	mMap;
-
-#if(PLATFORM == PLATFORM_WINDOWS)
-	CRITICAL_SECTION	mLock;
-#elif(PLATFORM == PLATFORM_LINUX)
-	pthread_mutex_t		mLock	=	PTHREAD_MUTEX_INITIALIZER;
-#endif
-
-	map_node_t	()
-	{
-		#if(PLATFORM == PLATFORM_WINDOWS)
+	typedef	R		map_t;	///< 한 개 행 데이터 형식
 
-		::InitializeCriticalSectionEx	(	&mLock,
-											MAX_SPIN_COUNT,
-											NULL
-										);
-
-		#elif(PLATFORM == PLATFORM_LINUX)
+	map_t		mMap;
+};
 
-		mLock	=	PTHREAD_MUTEX_INITIALIZER;
+template<class T, class R = typename basic_map_node_t<T>::map_t>
+class	BasicSparseMatrix2;
 
-		#endif
-	}
-	~map_node_t ()
-	{
-		#if(PLATFORM == PLATFORM_WINDOWS)
+typedef	basic_node_t<elem_t>			node_t;
+typedef	basic_vector_node_t<elem_t>		vector_node_t;
+typedef	basic_node_t2<elem_t>			node_t2;
+typedef	basic_vector_node_t2<elem_t>	vector_node_t2;
+typedef	basic_map_node_t<elem_t>		map_node_t;
 
-		DeleteCriticalSection ( &mLock );
-
-		#endif
-	}
-};
+typedef	vector_node_t::row_t::iterator			elem_vector_itor;	///< 한 개 행 데이터 참조자
+typedef	vector_node_t::row_t::const_iterator		elem_vector_citor;	///< 한 개 행 데이터 상수 참조자
+typedef	std::vector<node_t2>::iterator				elem_vector_itor2;	///< 한 개 행 데이터 참조자
+typedef	map_node_t::map_t::const_iterator		elem_map_itor;		///< 한 개 행 데이터 참조자
 
 #if(PLATFORM == PLATFORM_WINDOWS)
 
@@ -220,7 +198,7 @@ typedef		void*	THREAD_RETURN_TYPE;
 
 #endif
 
-typedef	std::vector<size_t>			csr_t;			///< 행렬 위치 데이터
+typedef	std::vector<index_t>		csr_t;			///< 행렬 위치 데이터
 typedef	csr_t::const_iterator		csr_itor;		///< 행렬 위치 데이터 참조자
 
 typedef	std::vector<elem_t>			elem_csr_t;		///< 한 개 행 데이터 형식
@@ -9,27 +9,45 @@
 #define SPARSE_MATRIX_H_
 
 #include <stdio.h>
+#include <atomic>
+#include <mutex>
 #include "matrix_typedef.h"
+#include "matrix_expr.h"
 
 namespace	matrix
 {
 
+class	ChunkQueue;
+
 /**
 * 희소 행렬 표현 클래스 (Array + Vector)
+* 열 위치 형식 I (기본 uint32_t)는 열 크기를 표현할 수 있어야 한다.
 */
-class	SparseMatrix
+template<class T, class I = index_t>
+class	BasicSparseMatrix
 {
 public:
+	typedef	T											elem_t;		///< 요소 데이터 형식
+	typedef	typename elem_traits<T>::real_t				real_t;		///< 크기 (norm) 형식
+	typedef	I											index_t;	///< 열 위치 형식
+	typedef	basic_node_t<T, I>							node_t;
+	typedef	basic_vector_node_t<T, I>					vector_node_t;
+	typedef	typename vector_node_t::row_t			row_t;		///< 한 개 행 데이터 형식
+	typedef	typename row_t::iterator		elem_vector_itor;	///< 한 개 행 데이터 참조자
+	typedef	typename row_t::const_iterator	elem_vector_citor;	///< 한 개 행 데이터 상수 참조자
 	enum	FuncKind
 	{
 		FUNC_ADD,			///< 덧셈
 		FUNC_SUB, 			///< 뺄셈
 		FUNC_MULTIPLY,		///< 곱셈
 		FUNC_ELEM_MUL,		///< 행렬 x 단일 값
-		FUNC_TMULTIPLY,		///< 뒤 행렬 전치 변환 후 앞 행렬 곱셈
-		FUNC_STMULTIPLY,	///< 앞 행렬 전치 변환 후 뒤 행렬 곱셈
 		FUNC_COPY,			///< 행렬 복사
 		FUNC_COMPARE,		///< 행렬 비교
+		FUNC_SORT,			///< 행 정렬
+		FUNC_SPMV,			///< 행렬 x 벡터
+		FUNC_AXPBY,			///< 자신에 대한 갱신 (this = beta * this + alpha * operand)
+		FUNC_COMBINE,		///< 선형 결합 (this = coef[0] * terms[0] + ...)
+		FUNC_RESERVE,		///< 행 공간 예약 (first touch)
 	};
 	enum	CG_LimitType
 	{
@@ -38,23 +56,54 @@ public:
 	};
 	struct		OpInfo
 	{
-		const SparseMatrix*		operandA;
-		const SparseMatrix*		operandB;
+		const BasicSparseMatrix*		operandA;
+		const BasicSparseMatrix*		operandB;
 		elem_t						elemOperandB;
-		SparseMatrix*			result;
+		BasicSparseMatrix*			result;
+		const elem_t*			vecX;			///< SpMV 입력 벡터
+		elem_t*					vecY;			///< SpMV 결과 벡터
+		elem_t					beta;			///< SpMV 결과 벡터 계수 (elemOperandB는 alpha)
+		size_t					termNum;		///< 선형 결합 항 수
+		const elem_t*			coef;			///< 선형 결합 항 별 계수
+		const BasicSparseMatrix* const*	terms;		///< 선형 결합 항 별 피연산자
+		const size_t*			rowSize;		///< 행 별 예약 크기 (NULL이면 현재 요소 수)
 		THREAD_RETURN_TYPE		retVal;
 	};
 private:
+	typedef	THREAD_RETURN_TYPE(THREAD_FUNC_TYPE *Operation)(void*);
+	struct		FuncInfo
+	{
+		OpInfo					opInfo;
+		Operation				func;
+		size_t					startRow;
+		size_t					endRow;
+		ChunkQueue*				queue;			///< 조각 큐 (NULL이면 startRow ~ endRow 한 구간만 수행)
+		const size_t*			chunkStart;		///< 조각 별 시작 행 (조각 수 + 1 개)
+		size_t					task;			///< 작업 번호
+	};
+
 	size_t				mRowSize;		///< 행 크기
 	size_t				mColSize;		///< 열 크기
-	vector_node_t*	mData;			///< 행렬 데이터
+	vector_node_t*	mData;			///< 행렬 데이터 (각 행은 열 순서로 정렬)
+	std::atomic<bool>	mSorted;		///< 모든 행이 정렬 되어 있는지 여부
+	RowArena*			mArena;			///< 행 저장 공간 (NULL이면 행 별 힙 할당)
+
+	static bool			sDefaultArena;	///< 새로 생성하는 행렬의 행 저장 공간 사용 여부
+	static std::mutex	sSortLock;		///< 읽기 연산에서 자동 정렬 직렬화
+
+	friend class	MatrixBuilder;
+	friend class	MatrixFile;
+	template<class, class>	friend class	BasicMatrixCSR;
 public:
-				SparseMatrix		(	void	);
-				SparseMatrix		(	size_t		row,
+				BasicSparseMatrix		(	void	);
+				BasicSparseMatrix		(	size_t		row,
 										size_t		col
 									);
-				SparseMatrix		(	const SparseMatrix&		matrix		);
-	virtual	~SparseMatrix	(	void	);
+				BasicSparseMatrix		(	const BasicSparseMatrix&		matrix		);
+				BasicSparseMatrix		(	BasicSparseMatrix&&			matrix		);
+	template<size_t N>
+				BasicSparseMatrix		(	const LinearExpr<BasicSparseMatrix, N>&	expr	);
+	virtual	~BasicSparseMatrix	(	void	);
 public:
 	elem_t		getElem		(	size_t		row,
 									size_t		col
@@ -63,57 +112,126 @@ public:
 									size_t		col,
 									elem_t		elem
 								);
+	void		appendElem		(	size_t		row,
+									size_t		col,
+									elem_t		elem
+								);
+	void		finalize		(	void	);
 	void		clear			(	void	);
 	void		clear			(	size_t		row		);
-	SparseMatrix	add				(	const SparseMatrix&	operand	) const;
-	SparseMatrix	padd			(	const SparseMatrix&	operand	) const;
-	SparseMatrix	sub				(	const SparseMatrix&	operand	) const;
-	SparseMatrix	psub			(	const SparseMatrix&	operand	) const;
-	SparseMatrix	multiply		(	const SparseMatrix&	operand	) const;
-	SparseMatrix	pmultiply		(	const SparseMatrix&	operand	) const;
-	SparseMatrix	multiply		(	elem_t		operand	) const;
-	SparseMatrix	pmultiply		(	elem_t		operand	) const;
-	SparseMatrix	tmultiply		(	const SparseMatrix&	operand	) const;
-	SparseMatrix	ptmultiply		(	const SparseMatrix&	operand	) const;
-	SparseMatrix	stmultiply		(	const SparseMatrix&	operand	) const;
-	SparseMatrix	pstmultiply	(	const SparseMatrix&	operand	) const;
-	SparseMatrix	square			(	void	);
-	SparseMatrix	psquare		(	void	);
-	const SparseMatrix&		equal		(	const SparseMatrix&	operand	);
-	const SparseMatrix&		pequal		(	const SparseMatrix&	operand	);
-	bool	compare	(	const SparseMatrix&	operand	) const;
-	bool	pcompare	(	const SparseMatrix&	operand	) const;
-	SparseMatrix	sol_cg	(	const SparseMatrix&	operand	);
-	SparseMatrix	sol_cg	(	const SparseMatrix&	operand,
-								const SparseMatrix&	init,
+	BasicSparseMatrix	add				(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	padd			(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	sub				(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	psub			(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	multiply		(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	pmultiply		(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	multiply		(	elem_t		operand	) const;
+	BasicSparseMatrix	pmultiply		(	elem_t		operand	) const;
+	BasicSparseMatrix	transpose		(	void	) const;
+	BasicSparseMatrix	tmultiply		(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	ptmultiply		(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	stmultiply		(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	pstmultiply	(	const BasicSparseMatrix&	operand	) const;
+	BasicSparseMatrix	square			(	void	);
+	BasicSparseMatrix	psquare		(	void	);
+	const BasicSparseMatrix&		equal		(	const BasicSparseMatrix&	operand	);
+	const BasicSparseMatrix&		pequal		(	const BasicSparseMatrix&	operand	);
+	bool	compare	(	const BasicSparseMatrix&	operand	) const;
+	bool	pcompare	(	const BasicSparseMatrix&	operand	) const;
+	void		swap			(	BasicSparseMatrix&		operand	);
+	const BasicSparseMatrix&		axpy		(	elem_t					alpha,
+											const BasicSparseMatrix&		operand
+										);
+	const BasicSparseMatrix&		scale		(	elem_t		alpha	);
+	const BasicSparseMatrix&		scale_add	(	elem_t					alpha,
+											const BasicSparseMatrix&		operand
+										);
+	void		combine		(	size_t						num,
+								const elem_t				coef[],
+								const BasicSparseMatrix* const	operand[]
+							);
+	void		spmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		spmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+	void		pspmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		pspmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+	BasicSparseMatrix	sol_cg	(	const BasicSparseMatrix&	operand	);
+	BasicSparseMatrix	sol_cg	(	const BasicSparseMatrix&	operand,
+								const BasicSparseMatrix&	init,
 								uint32_t				iteration,
-								elem_t					limit,
+								real_t					limit,
 								CG_LimitType			limitType,
-								elem_t&				rangeResult
+								real_t&				rangeResult
 							);
 public:
-	inline SparseMatrix		operator+		(	const SparseMatrix&	operand	) const;
-	inline SparseMatrix		operator-		(	const SparseMatrix&	operand	) const;
-	inline SparseMatrix		operator*		(	const SparseMatrix&	operand	) const;
-	inline SparseMatrix		operator*		(	elem_t		operand		) const;
-	inline const SparseMatrix&		operator=		(	const SparseMatrix&	operand	);
-	inline bool	operator==		(	const SparseMatrix&	operand	) const;
+	inline LinearExpr<BasicSparseMatrix, 2>	operator+		(	const BasicSparseMatrix&	operand	) const;
+	inline LinearExpr<BasicSparseMatrix, 2>	operator-		(	const BasicSparseMatrix&	operand	) const;
+	inline BasicSparseMatrix		operator*		(	const BasicSparseMatrix&	operand	) const;
+	inline LinearExpr<BasicSparseMatrix, 1>	operator*		(	elem_t		operand		) const;
+	inline const BasicSparseMatrix&		operator=		(	const BasicSparseMatrix&	operand	);
+	inline const BasicSparseMatrix&		operator=		(	BasicSparseMatrix&&		operand	);
+	inline const BasicSparseMatrix&		operator+=		(	const BasicSparseMatrix&	operand	);
+	inline const BasicSparseMatrix&		operator-=		(	const BasicSparseMatrix&	operand	);
+	inline const BasicSparseMatrix&		operator*=		(	elem_t		operand		);
+	template<size_t N>
+	inline const BasicSparseMatrix&		operator=		(	const LinearExpr<BasicSparseMatrix, N>&	expr	);
+	template<size_t N>
+	inline const BasicSparseMatrix&		operator+=		(	const LinearExpr<BasicSparseMatrix, N>&	expr	);
+	template<size_t N>
+	inline const BasicSparseMatrix&		operator-=		(	const LinearExpr<BasicSparseMatrix, N>&	expr	);
+	inline bool	operator==		(	const BasicSparseMatrix&	operand	) const;
 public:
 	inline bool		isValid		(	void	);
 	inline size_t		getCol			(	void	) const;
 	inline size_t		getRow			(	void	) const;
 	inline size_t		getSize		(	void	) const;
+	void		setArena		(	bool		use		);
+	inline bool		getArena		(	void	) const;
+	void		compact			(	void	);
+	static void		setDefaultArena	(	bool		use		);
+	static bool		getDefaultArena	(	void	);
 private:
+	inline size_t		countElems	(	void	) const;
+	void		moveRows		(	RowArena*	arena	);
 	void		allocElems		(	size_t		row,
 									size_t		col
 								);
 	void		freeElems		(	void	);
-	void		copyElems		(	const SparseMatrix&		matrix		);
-	void		pcopyElems		(	const SparseMatrix&		matrix		);
-	void		chkSameSize	(	const SparseMatrix&		matrix		) const;
+	void		reserveRows	(	const size_t	size[]	);
+	void		copyElems		(	const BasicSparseMatrix&		matrix		);
+	void		pcopyElems		(	const BasicSparseMatrix&		matrix		);
+	void		chkSameSize	(	const BasicSparseMatrix&		matrix		) const;
 	void		chkBound		(	size_t		row,
 									size_t		col
 								) const;
+	void		chkSorted		(	void	) const;
+	void		updateElems	(	elem_t					alpha,
+									const BasicSparseMatrix*		operand,
+									elem_t					beta
+								);
+	void		spmvRows		(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[],
+									size_t			startRow,
+									size_t			endRow
+								) const;
+	void		splitRows		(	FuncKind		kind,
+									const OpInfo&	info,
+									size_t			partNum,
+									size_t			bound[]
+								) const;
 	void		doThreadFunc	(	FuncKind	kind,
 									OpInfo&	info
 								) const;
@@ -126,10 +244,13 @@ private:
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadSub			(	void*	pData	);
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadMultiply		(	void*	pData	);
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadElemMul		(	void*	pData	);
-	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadTmultiply		(	void*	pData	);
-	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadStmultiply	(	void*	pData	);
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCopy			(	void*	pData	);
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCompare		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadSort			(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadSpmv			(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadAxpby			(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCombine		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadReserve		(	void*	pData	);
 private:
 	static void		delElem_		(	vector_node_t*	data,
 											size_t				row,
@@ -144,63 +265,216 @@ private:
 											size_t				col,
 											elem_t				elem
 										);
+	static void		sortRow_		(	row_t&	vec		);
+	static void		storeRow_		(	row_t&		dest,
+											row_t&		src
+										);
+	static void		mergeRow_		(	const row_t&	vecA,
+											const row_t&	vecB,
+											elem_t						coefB,
+											row_t&		result
+										);
+	static void		updateRow_		(	row_t&		vecA,
+											const row_t*	vecB,
+											elem_t						alpha,
+											elem_t						beta,
+											row_t&		buffer
+										);
+	static void		combineRow_	(	size_t						num,
+											const elem_t				coef[],
+											const BasicSparseMatrix* const	operand[],
+											size_t						row,
+											row_t&		result,
+											row_t&		buffer
+										);
+	static void		multiplyRow_	(	const row_t&	vecA,
+											const vector_node_t*		nodeB,
+											row_t&		result,
+											row_t&		buffer
+										);
 };
 
+typedef	BasicSparseMatrix<double>	SparseMatrix;		///< double 요소 행렬
+
 /**
 * 행렬 덧셈
-* @return 행렬 덧셈 결과
+* 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+* @return 행렬 덧셈 표현식
 */
-SparseMatrix		SparseMatrix::operator+		(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+LinearExpr<BasicSparseMatrix<T, I>, 2>		BasicSparseMatrix<T, I>::operator+		(	const BasicSparseMatrix&	operand	///< 피연산자
 													) const
 {
-	return	padd(operand);
+	return	LinearExpr<BasicSparseMatrix, 1>(1, *this) + operand;
 }
 
 /**
 * 행렬 뺄셈
-* @return 행렬 뺄셈 결과
+* 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+* @return 행렬 뺄셈 표현식
 */
-SparseMatrix		SparseMatrix::operator-		(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+LinearExpr<BasicSparseMatrix<T, I>, 2>		BasicSparseMatrix<T, I>::operator-		(	const BasicSparseMatrix&	operand	///< 피연산자
 												) const
 {
-	return	psub(operand);
+	return	LinearExpr<BasicSparseMatrix, 1>(1, *this) - operand;
 }
 
 /**
 * 행렬 곱셈
 * @return 행렬 곱셈 결과
 */
-SparseMatrix		SparseMatrix::operator*		(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>		BasicSparseMatrix<T, I>::operator*		(	const BasicSparseMatrix&	operand	///< 피연산자
 													) const
 {
 	return	pmultiply(operand);
 }
 
 /**
-* 행렬 곱셈
-* @return 행렬 곱셈 결과
+* 행렬 x 단일 값
+* 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+* @return 행렬 x 단일 값 표현식
 */
-SparseMatrix		SparseMatrix::operator*		(	elem_t		operand	///< 피연산자
+template<class T, class I>
+LinearExpr<BasicSparseMatrix<T, I>, 1>		BasicSparseMatrix<T, I>::operator*		(	elem_t		operand	///< 피연산자
 													) const
 {
-	return	pmultiply(operand);
+	return	LinearExpr<BasicSparseMatrix, 1>(operand, *this);
 }
 
 /**
 * 행렬 대입
 * @return 대입 할 행렬
 */
-const SparseMatrix&		SparseMatrix::operator=		(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::operator=		(	const BasicSparseMatrix&	operand	///< 피연산자
 															)
 {
 	return	pequal(operand);
 }
 
+/**
+* 행렬 이동 대입
+* 데이터를 복사하지 않고 피연산자와 맞바꾸며, 기존 데이터는 피연산자가 소멸할 때 해제된다.
+* @return 대입 된 행렬
+*/
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::operator=		(	BasicSparseMatrix&&		operand	///< 피연산자
+															)
+{
+	swap(operand);
+
+	return	*this;
+}
+
+/**
+* 행렬 덧셈 (결과를 자신에 저장)
+* @return 덧셈 결과
+*/
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::operator+=	(	const BasicSparseMatrix&	operand	///< 피연산자
+															)
+{
+	return	axpy(1, operand);
+}
+
+/**
+* 행렬 뺄셈 (결과를 자신에 저장)
+* @return 뺄셈 결과
+*/
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::operator-=	(	const BasicSparseMatrix&	operand	///< 피연산자
+															)
+{
+	return	axpy(-1, operand);
+}
+
+/**
+* 행렬 x 단일 값 (결과를 자신에 저장)
+* @return 곱셈 결과
+*/
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::operator*=	(	elem_t		operand	///< 피연산자
+															)
+{
+	return	scale(operand);
+}
+
+/**
+* 표현식 계산 결과로 생성
+* 모든 항을 combine()으로 한 번에 계산한다.
+*/
+template<class T, class I>
+template<size_t N>
+BasicSparseMatrix<T, I>::BasicSparseMatrix		(	const LinearExpr<BasicSparseMatrix, N>&	expr	///< 계산 할 표현식
+			)
+:mRowSize(0),
+ mColSize(0),
+ mData(NULL),
+ mSorted(true),
+ mArena(NULL)
+{
+	combine(N, expr.getCoef(), expr.getOperand());
+}
+
+/**
+* 표현식 대입
+* 모든 항을 combine()으로 한 번에 계산하며, 자신이 피연산자이어도 된다.
+* @return 대입 된 행렬
+*/
+template<class T, class I>
+template<size_t N>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::operator=		(	const LinearExpr<BasicSparseMatrix, N>&	expr	///< 계산 할 표현식
+														)
+{
+	combine(N, expr.getCoef(), expr.getOperand());
+
+	return	*this;
+}
+
+/**
+* 표현식 덧셈 (결과를 자신에 저장)
+* 한 항이면 axpy(), 여러 항이면 자신을 포함한 표현식으로 계산한다.
+* @return 덧셈 결과
+*/
+template<class T, class I>
+template<size_t N>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::operator+=		(	const LinearExpr<BasicSparseMatrix, N>&	expr	///< 더할 표현식
+														)
+{
+	if( N == 1 )
+	{
+		return	axpy(expr.getCoef()[0], *expr.getOperand()[0]);
+	}
+
+	return	operator=(*this + expr);
+}
+
+/**
+* 표현식 뺄셈 (결과를 자신에 저장)
+* 한 항이면 axpy(), 여러 항이면 자신을 포함한 표현식으로 계산한다.
+* @return 뺄셈 결과
+*/
+template<class T, class I>
+template<size_t N>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::operator-=		(	const LinearExpr<BasicSparseMatrix, N>&	expr	///< 뺄 표현식
+														)
+{
+	if( N == 1 )
+	{
+		return	axpy(-expr.getCoef()[0], *expr.getOperand()[0]);
+	}
+
+	return	operator=(*this - expr);
+}
+
 /**
 * 행렬 비교
 * @return 비교 결과
 */
-bool	SparseMatrix::operator==	(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+bool	BasicSparseMatrix<T, I>::operator==	(	const BasicSparseMatrix&	operand	///< 피연산자
 										) const
 {
 	return	pcompare(operand);
@@ -210,7 +484,8 @@ bool	SparseMatrix::operator==	(	const SparseMatrix&	operand	///< 피연산자
 * 행렬 객체가 유효한지 검사
 * @return 행렬 객체가 유효하면 true, 유효하지 않으면 false
 */
-bool	SparseMatrix::isValid		(	void	)
+template<class T, class I>
+bool	BasicSparseMatrix<T, I>::isValid		(	void	)
 {
 	bool	ret		=	false;
 
@@ -227,7 +502,8 @@ bool	SparseMatrix::isValid		(	void	)
 * 행 크기 가져오기
 * @return 행 크기
 */
-size_t	SparseMatrix::getRow		(	void	) const
+template<class T, class I>
+size_t	BasicSparseMatrix<T, I>::getRow		(	void	) const
 {
 	return	mRowSize;
 }
@@ -236,16 +512,41 @@ size_t	SparseMatrix::getRow		(	void	) const
 * 열 크기 가져오기
 * @return 열 크기
 */
-size_t	SparseMatrix::getCol		(	void	) const
+template<class T, class I>
+size_t	BasicSparseMatrix<T, I>::getCol		(	void	) const
 {
 	return	mColSize;
 }
 
+/**
+* 행 저장 공간 사용 여부 가져오기
+* @return 행 저장 공간을 사용하면 true
+*/
+template<class T, class I>
+bool	BasicSparseMatrix<T, I>::getArena		(	void	) const
+{
+	return	( mArena != NULL );
+}
+
 /**
 * 행렬 요소 데이터 수 가져오기
 * @return 요소 데이터 크기
 */
-size_t	SparseMatrix::getSize		(	void	) const
+template<class T, class I>
+size_t	BasicSparseMatrix<T, I>::getSize		(	void	) const
+{
+	chkSorted();
+
+	return	countElems();
+}
+
+/**
+* 저장 된 요소 수 세기
+* 정렬하지 않으므로 appendElem()으로 추가한 중복 요소도 센다.
+* @return 저장 요소 수
+*/
+template<class T, class I>
+size_t	BasicSparseMatrix<T, I>::countElems		(	void	) const
 {
 	size_t		sum		=	0;
 
@@ -10,46 +10,85 @@
 
 #include <stdio.h>
 #include "matrix_typedef.h"
+#include "matrix_expr.h"
+#include "matrix_row.h"
 
 namespace	matrix
 {
 
+class	ChunkQueue;
+
 /**
 * 희소 행렬 표현 클래스 (Array + Map)
+* 행 형식 R (기본 std::map)은 std::map과 같은 방법으로 사용할 수 있어야 하며,
+* SortedRow (순서대로 읽기가 빠름) 또는 HashRow (임의 위치 읽기 / 쓰기가 빠름)를 사용할 수 있다.
 */
-class	SparseMatrix2
+template<class T, class R>
+class	BasicSparseMatrix2
 {
 public:
+	typedef	T											elem_t;		///< 요소 데이터 형식
+	typedef	typename elem_traits<T>::real_t				real_t;		///< 크기 (norm) 형식
+	typedef	basic_map_node_t<T, R>						map_node_t;
+	typedef	typename map_node_t::map_t						map_t;				///< 한 개 행 데이터 형식
+	typedef	typename map_t::const_iterator					elem_map_itor;		///< 한 개 행 데이터 참조자
 	enum	FuncKind
 	{
 		FUNC_ADD,			///< 덧셈
 		FUNC_SUB, 			///< 뺄셈
 		FUNC_MULTIPLY,		///< 곱셈
 		FUNC_ELEM_MUL,		///< 행렬 x 단일 값
-		FUNC_TMULTIPLY,		///< 전치 행렬 곱셈
-		FUNC_STMULTIPLY,		///< 앞 전치 행렬 곱셈
 		FUNC_COPY,			///< 행렬 복사
 		FUNC_COMPARE,		///< 행렬 비교
+		FUNC_SPMV,			///< 행렬 x 벡터
+		FUNC_AXPBY,			///< 자신에 대한 갱신 (this = beta * this + alpha * operand)
+		FUNC_COMBINE,		///< 선형 결합 (this = coef[0] * terms[0] + ...)
 	};
 	struct		OpInfo
 	{
-		const SparseMatrix2*	operandA;
-		const SparseMatrix2*	operandB;
+		const BasicSparseMatrix2*	operandA;
+		const BasicSparseMatrix2*	operandB;
 		elem_t					elemOperandB;
-		SparseMatrix2*			result;
+		BasicSparseMatrix2*			result;
+		const elem_t*			vecX;			///< SpMV 입력 벡터
+		elem_t*					vecY;			///< SpMV 결과 벡터
+		elem_t					beta;			///< SpMV 결과 벡터 계수 (elemOperandB는 alpha)
+		size_t					termNum;		///< 선형 결합 항 수
+		const elem_t*			coef;			///< 선형 결합 항 별 계수
+		const BasicSparseMatrix2* const*	terms;		///< 선형 결합 항 별 피연산자
 		THREAD_RETURN_TYPE		retVal;
 	};
 private:
+	typedef	THREAD_RETURN_TYPE(THREAD_FUNC_TYPE *Operation)(void*);
+	struct		FuncInfo
+	{
+		OpInfo					opInfo;
+		Operation				func;
+		size_t					startCol;
+		size_t					endCol;
+		ChunkQueue*				queue;			///< 조각 큐 (NULL이면 startCol ~ endCol 한 구간만 수행)
+		const size_t*			chunkStart;		///< 조각 별 시작 행 (조각 수 + 1 개)
+		size_t					task;			///< 작업 번호
+	};
+
 	size_t			mRowSize;		///< 행 크기
 	size_t			mColSize;		///< 열 크기
 	map_node_t*		mData;		///< 행렬 데이터
+	NodePool*		mPool;		///< 행 노드 저장 공간
+
+	friend class	MatrixBuilder;
+	friend class	MatrixFile;
+	template<class, class>	friend class	BasicMatrixCSR;
 public:
-				SparseMatrix2		(	void	);
-				SparseMatrix2		(	size_t		row,
+				BasicSparseMatrix2		(	void	);
+				BasicSparseMatrix2		(	size_t		row,
 										size_t		col
 									);
-				SparseMatrix2		(	const SparseMatrix2&		matrix		);
-	virtual		~SparseMatrix2		(	void	);
+				BasicSparseMatrix2		(	const BasicSparseMatrix2&		matrix		);
+				BasicSparseMatrix2		(	BasicSparseMatrix2&&				matrix		);
+	template<size_t N>
+				BasicSparseMatrix2		(	const LinearExpr<BasicSparseMatrix2, N>&	expr	);
+	virtual		~BasicSparseMatrix2		(	void	);
 public:
 	elem_t		getElem		(	size_t		row,
 								size_t		col
@@ -58,30 +97,69 @@ public:
 								size_t		col,
 								elem_t		elem
 							);
-	SparseMatrix2	add			(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	padd		(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	sub			(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	psub		(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	multiply	(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	pmultiply	(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	multiply	(	elem_t		operand	) const;
-	SparseMatrix2	pmultiply	(	elem_t		operand	) const;
-	SparseMatrix2	tmultiply	(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	ptmultiply	(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	stmultiply	(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	pstmultiply	(	const SparseMatrix2&	operand	) const;
-	const SparseMatrix2&		equal		(	const SparseMatrix2&	operand	);
-	const SparseMatrix2&		pequal		(	const SparseMatrix2&	operand	);
-	bool			compare		(	const SparseMatrix2&	operand	) const;
-	bool			pcompare	(	const SparseMatrix2&	operand	) const;
-	SparseMatrix2	sol_cg	(	const SparseMatrix2&	operand	);
+	BasicSparseMatrix2	add			(	const BasicSparseMatrix2&	operand	) const;
+	BasicSparseMatrix2	padd		(	const BasicSparseMatrix2&	operand	) const;
+	BasicSparseMatrix2	sub			(	const BasicSparseMatrix2&	operand	) const;
+	BasicSparseMatrix2	psub		(	const BasicSparseMatrix2&	operand	) const;
+	BasicSparseMatrix2	multiply	(	const BasicSparseMatrix2&	operand	) const;
+	BasicSparseMatrix2	pmultiply	(	const BasicSparseMatrix2&	operand	) const;
+	BasicSparseMatrix2	multiply	(	elem_t		operand	) const;
+	BasicSparseMatrix2	pmultiply	(	elem_t		operand	) const;
+	BasicSparseMatrix2	transpose	(	void	) const;
+	BasicSparseMatrix2	tmultiply	(	const BasicSparseMatrix2&	operand	) const;
+	BasicSparseMatrix2	ptmultiply	(	const BasicSparseMatrix2&	operand	) const;
+	BasicSparseMatrix2	stmultiply	(	const BasicSparseMatrix2&	operand	) const;
+	BasicSparseMatrix2	pstmultiply	(	const BasicSparseMatrix2&	operand	) const;
+	const BasicSparseMatrix2&		equal		(	const BasicSparseMatrix2&	operand	);
+	const BasicSparseMatrix2&		pequal		(	const BasicSparseMatrix2&	operand	);
+	bool			compare		(	const BasicSparseMatrix2&	operand	) const;
+	bool			pcompare	(	const BasicSparseMatrix2&	operand	) const;
+	void		swap			(	BasicSparseMatrix2&		operand	);
+	const BasicSparseMatrix2&		axpy		(	elem_t					alpha,
+												const BasicSparseMatrix2&	operand
+											);
+	const BasicSparseMatrix2&		scale		(	elem_t		alpha	);
+	const BasicSparseMatrix2&		scale_add	(	elem_t					alpha,
+												const BasicSparseMatrix2&	operand
+											);
+	void		combine		(	size_t						num,
+								const elem_t				coef[],
+								const BasicSparseMatrix2* const	operand[]
+							);
+	void		spmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		spmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+	void		pspmv			(	const elem_t	x[],
+									elem_t			y[]
+								) const;
+	void		pspmv			(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[]
+								) const;
+	BasicSparseMatrix2	sol_cg	(	const BasicSparseMatrix2&	operand	);
 public:
-	inline SparseMatrix2		operator+		(	const SparseMatrix2&	operand	) const;
-	inline SparseMatrix2		operator-		(	const SparseMatrix2&	operand	) const;
-	inline SparseMatrix2		operator*		(	const SparseMatrix2&	operand	) const;
-	inline SparseMatrix2		operator*		(	elem_t		operand		) const;
-	inline const SparseMatrix2&		operator=		(	const SparseMatrix2&	operand	);
-	inline bool	operator==		(	const SparseMatrix2&	operand	) const;
+	inline LinearExpr<BasicSparseMatrix2, 2>	operator+		(	const BasicSparseMatrix2&	operand	) const;
+	inline LinearExpr<BasicSparseMatrix2, 2>	operator-		(	const BasicSparseMatrix2&	operand	) const;
+	inline BasicSparseMatrix2		operator*		(	const BasicSparseMatrix2&	operand	) const;
+	inline LinearExpr<BasicSparseMatrix2, 1>	operator*		(	elem_t		operand		) const;
+	inline const BasicSparseMatrix2&		operator=		(	const BasicSparseMatrix2&	operand	);
+	inline const BasicSparseMatrix2&		operator=		(	BasicSparseMatrix2&&			operand	);
+	inline const BasicSparseMatrix2&		operator+=		(	const BasicSparseMatrix2&	operand	);
+	inline const BasicSparseMatrix2&		operator-=		(	const BasicSparseMatrix2&	operand	);
+	inline const BasicSparseMatrix2&		operator*=		(	elem_t		operand		);
+	template<size_t N>
+	inline const BasicSparseMatrix2&		operator=		(	const LinearExpr<BasicSparseMatrix2, N>&	expr	);
+	template<size_t N>
+	inline const BasicSparseMatrix2&		operator+=		(	const LinearExpr<BasicSparseMatrix2, N>&	expr	);
+	template<size_t N>
+	inline const BasicSparseMatrix2&		operator-=		(	const LinearExpr<BasicSparseMatrix2, N>&	expr	);
+	inline bool	operator==		(	const BasicSparseMatrix2&	operand	) const;
 public:
 	inline bool		isValid		(	void	);
 	inline size_t	getRow		(	void	) const;
@@ -92,12 +170,29 @@ private:
 									size_t		col
 								);
 	void		freeElems		(	void	);
-	void		copyElems		(	const SparseMatrix2&		matrix		);
-	void		pcopyElems		(	const SparseMatrix2&		matrix		);
-	void		chkSameSize		(	const SparseMatrix2&		matrix		) const;
+	inline typename map_t::allocator_type	getAllocator	(	void	) const;
+	void		copyElems		(	const BasicSparseMatrix2&		matrix		);
+	void		pcopyElems		(	const BasicSparseMatrix2&		matrix		);
+	void		chkSameSize		(	const BasicSparseMatrix2&		matrix		) const;
 	void		chkBound		(	size_t		row,
 									size_t		col
 								) const;
+	void		updateElems		(	elem_t					alpha,
+									const BasicSparseMatrix2*	operand,
+									elem_t					beta
+								);
+	void		spmvRows		(	elem_t			alpha,
+									const elem_t	x[],
+									elem_t			beta,
+									elem_t			y[],
+									size_t			startRow,
+									size_t			endRow
+								) const;
+	void		splitRows		(	FuncKind		kind,
+									const OpInfo&	info,
+									size_t			partNum,
+									size_t			bound[]
+								) const;
 	void		doThreadFunc	(	FuncKind	kind,
 									OpInfo&		info
 								) const;
@@ -110,67 +205,207 @@ private:
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadSub			(	void*	pData	);
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadMultiply	(	void*	pData	);
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadElemMul		(	void*	pData	);
-	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadTmultiply	(	void*	pData	);
-	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadStmultiply	(	void*	pData	);
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCopy			(	void*	pData	);
 	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCompare		(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadSpmv			(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadAxpby			(	void*	pData	);
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	threadCombine		(	void*	pData	);
+private:
+	static void		updateRow_		(	map_t&			mapA,
+										const map_t*		mapB,
+										elem_t								alpha,
+										elem_t								beta
+									);
+	static void		combineRow_		(	size_t								num,
+										const elem_t						coef[],
+										const BasicSparseMatrix2* const			operand[],
+										size_t								row,
+										map_t&			result
+									);
 };
 
+typedef	BasicSparseMatrix2<double>						SparseMatrix2;			///< double 요소 행렬
+typedef	BasicSparseMatrix2< double, SortedRow<double> >	SortedSparseMatrix2;	///< double 요소 행렬 (정렬 된 벡터 행)
+typedef	BasicSparseMatrix2< double, HashRow<double> >		HashSparseMatrix2;		///< double 요소 행렬 (해시 행)
+
 /**
 * 행렬 덧셈
-* @return 행렬 덧셈 결과
+* 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+* @return 행렬 덧셈 표현식
 */
-SparseMatrix2		SparseMatrix2::operator+		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+LinearExpr<BasicSparseMatrix2<T, R>, 2>		BasicSparseMatrix2<T, R>::operator+		(	const BasicSparseMatrix2&	operand	///< 피연산자
 													) const
 {
-	return	padd(operand);
+	return	LinearExpr<BasicSparseMatrix2, 1>(1, *this) + operand;
 }
 
 /**
 * 행렬 뺄셈
-* @return 행렬 뺄셈 결과
+* 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+* @return 행렬 뺄셈 표현식
 */
-SparseMatrix2		SparseMatrix2::operator-		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+LinearExpr<BasicSparseMatrix2<T, R>, 2>		BasicSparseMatrix2<T, R>::operator-		(	const BasicSparseMatrix2&	operand	///< 피연산자
 													) const
 {
-	return	psub(operand);
+	return	LinearExpr<BasicSparseMatrix2, 1>(1, *this) - operand;
 }
 
 /**
 * 행렬 곱셈
 * @return 행렬 곱셈 결과
 */
-SparseMatrix2		SparseMatrix2::operator*		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>		BasicSparseMatrix2<T, R>::operator*		(	const BasicSparseMatrix2&	operand	///< 피연산자
 													) const
 {
 	return	pmultiply(operand);
 }
 
 /**
-* 행렬 곱셈
-* @return 행렬 곱셈 결과
+* 행렬 x 단일 값
+* 결과 행렬 대신 표현식을 돌려주며, 행렬에 대입할 때 한 번에 계산한다.
+* @return 행렬 x 단일 값 표현식
 */
-SparseMatrix2		SparseMatrix2::operator*		(	elem_t		operand	///< 피연산자
+template<class T, class R>
+LinearExpr<BasicSparseMatrix2<T, R>, 1>		BasicSparseMatrix2<T, R>::operator*		(	elem_t		operand	///< 피연산자
 													) const
 {
-	return	pmultiply(operand);
+	return	LinearExpr<BasicSparseMatrix2, 1>(operand, *this);
 }
 
 /**
 * 행렬 대입
 * @return 대입 할 행렬
 */
-const SparseMatrix2&		SparseMatrix2::operator=		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::operator=		(	const BasicSparseMatrix2&	operand	///< 피연산자
 															)
 {
 	return	pequal(operand);
 }
 
+/**
+* 행렬 이동 대입
+* 데이터를 복사하지 않고 피연산자와 맞바꾸며, 기존 데이터는 피연산자가 소멸할 때 해제된다.
+* @return 대입 된 행렬
+*/
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::operator=		(	BasicSparseMatrix2&&			operand	///< 피연산자
+																)
+{
+	swap(operand);
+
+	return	*this;
+}
+
+/**
+* 행렬 덧셈 (결과를 자신에 저장)
+* @return 덧셈 결과
+*/
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::operator+=		(	const BasicSparseMatrix2&	operand	///< 피연산자
+																)
+{
+	return	axpy(1, operand);
+}
+
+/**
+* 행렬 뺄셈 (결과를 자신에 저장)
+* @return 뺄셈 결과
+*/
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::operator-=		(	const BasicSparseMatrix2&	operand	///< 피연산자
+																)
+{
+	return	axpy(-1, operand);
+}
+
+/**
+* 행렬 x 단일 값 (결과를 자신에 저장)
+* @return 곱셈 결과
+*/
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::operator*=		(	elem_t		operand	///< 피연산자
+																)
+{
+	return	scale(operand);
+}
+
+/**
+* 표현식 계산 결과로 생성
+* 모든 항을 combine()으로 한 번에 계산한다.
+*/
+template<class T, class R>
+template<size_t N>
+BasicSparseMatrix2<T, R>::BasicSparseMatrix2		(	const LinearExpr<BasicSparseMatrix2, N>&	expr	///< 계산 할 표현식
+			)
+:mRowSize(0),
+ mColSize(0),
+ mData(NULL),
+ mPool(NULL)
+{
+	combine(N, expr.getCoef(), expr.getOperand());
+}
+
+/**
+* 표현식 대입
+* 모든 항을 combine()으로 한 번에 계산하며, 자신이 피연산자이어도 된다.
+* @return 대입 된 행렬
+*/
+template<class T, class R>
+template<size_t N>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::operator=		(	const LinearExpr<BasicSparseMatrix2, N>&	expr	///< 계산 할 표현식
+														)
+{
+	combine(N, expr.getCoef(), expr.getOperand());
+
+	return	*this;
+}
+
+/**
+* 표현식 덧셈 (결과를 자신에 저장)
+* 한 항이면 axpy(), 여러 항이면 자신을 포함한 표현식으로 계산한다.
+* @return 덧셈 결과
+*/
+template<class T, class R>
+template<size_t N>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::operator+=		(	const LinearExpr<BasicSparseMatrix2, N>&	expr	///< 더할 표현식
+														)
+{
+	if( N == 1 )
+	{
+		return	axpy(expr.getCoef()[0], *expr.getOperand()[0]);
+	}
+
+	return	operator=(*this + expr);
+}
+
+/**
+* 표현식 뺄셈 (결과를 자신에 저장)
+* 한 항이면 axpy(), 여러 항이면 자신을 포함한 표현식으로 계산한다.
+* @return 뺄셈 결과
+*/
+template<class T, class R>
+template<size_t N>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::operator-=		(	const LinearExpr<BasicSparseMatrix2, N>&	expr	///< 뺄 표현식
+														)
+{
+	if( N == 1 )
+	{
+		return	axpy(-expr.getCoef()[0], *expr.getOperand()[0]);
+	}
+
+	return	operator=(*this - expr);
+}
+
 /**
 * 행렬 비교
 * @return 비교 결과
 */
-bool	SparseMatrix2::operator==	(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+bool	BasicSparseMatrix2<T, R>::operator==	(	const BasicSparseMatrix2&	operand	///< 피연산자
 										) const
 {
 	return	pcompare(operand);
@@ -180,7 +415,8 @@ bool	SparseMatrix2::operator==	(	const SparseMatrix2&	operand	///< 피연산자
 * 행렬 객체가 유효한지 검사
 * @return 행렬 객체가 유효하면 true, 유효하지 않으면 false
 */
-bool	SparseMatrix2::isValid		(	void	)
+template<class T, class R>
+bool	BasicSparseMatrix2<T, R>::isValid		(	void	)
 {
 	bool	ret		=	false;
 
@@ -197,7 +433,8 @@ bool	SparseMatrix2::isValid		(	void	)
 * 열 크기 가져오기
 * @return 열 크기
 */
-size_t	SparseMatrix2::getRow		(	void	) const
+template<class T, class R>
+size_t	BasicSparseMatrix2<T, R>::getRow		(	void	) const
 {
 	return	mRowSize;
 }
@@ -206,7 +443,8 @@ size_t	SparseMatrix2::getRow		(	void	) const
 * 행 크기 가져오기
 * @return 행 크기
 */
-size_t	SparseMatrix2::getCol		(	void	) const
+template<class T, class R>
+size_t	BasicSparseMatrix2<T, R>::getCol		(	void	) const
 {
 	return	mColSize;
 }
@@ -215,7 +453,8 @@ size_t	SparseMatrix2::getCol		(	void	) const
 * 행렬 요소 데이터 수 가져오기
 * @return 요소 데이터 크기
 */
-size_t	SparseMatrix2::getSize		(	void	) const
+template<class T, class R>
+size_t	BasicSparseMatrix2<T, R>::getSize		(	void	) const
 {
 	size_t		sum		=	0;
 
@@ -227,6 +466,17 @@ size_t	SparseMatrix2::getSize		(	void	) const
 	return	sum;
 }
 
+/**
+* 행 노드 할당자 가져오기
+* 행렬의 행을 맞바꿀 임시 행은 이 할당자로 만들어 노드가 행렬의 저장 공간에 남도록 한다.
+* @return 행 노드 할당자
+*/
+template<class T, class R>
+typename BasicSparseMatrix2<T, R>::map_t::allocator_type	BasicSparseMatrix2<T, R>::getAllocator	(	void	) const
+{
+	return	typename map_t::allocator_type(mPool);
+}
+
 }
 
 #endif /* SPARSE_MATRIX2_H_ */
@@ -0,0 +1,276 @@
+/*
+ * thread_pool.h
+ *
+ *  Created on: 2015. 7. 20.
+ *      Author: asran
+ */
+
+#ifndef INCLUDE_THREAD_POOL_H_
+#define INCLUDE_THREAD_POOL_H_
+
+#include <stdio.h>
+#include <atomic>
+#include <exception>
+#include "matrix_typedef.h"
+
+namespace	matrix
+{
+
+/**
+ * 행렬 연산용 작업 쓰레드 풀
+ * 라이브러리 전체에서 하나의 객체를 공유하며, 작업 쓰레드는 최초 사용 시 한 번 생성되어
+ * 작업이 없을 때는 조건 변수에서 대기한다.
+ * 쓰레드 수, CPU 고정 여부, 쓰레드를 사용할 최소 작업 크기, first touch 모드는 실행 중에 바꿀 수 있으며,
+ * 최초 사용 시 환경 변수 MATRIX_NUM_THREADS, MATRIX_THREAD_AFFINITY, MATRIX_THREAD_THRESHOLD,
+ * MATRIX_FIRST_TOUCH 값으로 초기화 된다.
+ * first touch 모드에서는 작업 num을 항상 (num % 쓰레드 수)번 쓰레드 (0번은 호출한 쓰레드)가 수행하므로,
+ * 같은 행 분할을 쓰는 연산은 매번 같은 쓰레드가 같은 행을 맡는다.
+ * CPU 고정과 함께 쓰면 행렬 저장 공간을 그 행을 계산 할 쓰레드가 먼저 써서 (first touch) 해당 NUMA 노드에 둘 수 있다.
+ * CPU 고정에 실패하면 고정이 풀리므로, 실제 고정 여부는 getAffinity()로 확인한다.
+ * 설정 변경은 다른 쓰레드에서 행렬 연산을 수행하지 않을 때 해야 한다.
+ */
+class	ThreadPool
+{
+public:
+	typedef	THREAD_RETURN_TYPE(THREAD_FUNC_TYPE *Operation)(void*);
+	enum
+	{
+		DEFAULT_THRESHOLD	=	16384,		///< 기본 쓰레드 사용 최소 작업 크기 (요소 수)
+		CHUNK_PER_TASK		=	8,			///< 불규칙한 작업에서 작업 하나가 맡는 조각 수
+	};
+private:
+	struct		WorkerInfo
+	{
+		ThreadPool*			pool;
+		size_t				id;				///< 작업 쓰레드 번호
+		size_t				job;			///< 마지막으로 확인한 작업 번호
+	};
+
+	size_t					mThreadNum;		///< 동시에 계산하는 쓰레드 수 (호출한 쓰레드 포함)
+	size_t					mWorkerNum;		///< 작업 쓰레드 수 (mThreadNum - 1)
+	bool					mAffinity;		///< 작업 쓰레드 CPU 고정 여부
+	size_t					mThreshold;		///< 쓰레드를 사용할 최소 작업 크기 (요소 수)
+	bool					mFirstTouch;	///< 작업을 쓰레드에 고정 배정 (first touch 모드)
+	bool					mExit;			///< 작업 쓰레드 종료 요청
+	Operation				mFunc;			///< 현재 작업 함수
+	void**					mArgs;			///< 현재 작업 함수 인자 배열
+	THREAD_RETURN_TYPE*		mRetVal;		///< 현재 작업 결과 배열
+	size_t					mTaskNum;		///< 현재 작업 수
+	size_t					mNextTask;		///< 다음에 수행 할 작업 위치
+	size_t					mRemainTask;	///< 완료되지 않은 작업 수
+	size_t					mJob;			///< 작업 요청 번호
+	std::exception_ptr		mError;			///< 현재 작업 중 처음 발생한 예외
+	WorkerInfo*				mWorkerInfo;	///< 작업 쓰레드 별 정보
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	HANDLE*					mThread;		///< 작업 쓰레드
+	CRITICAL_SECTION		mSubmitLock;	///< 작업 요청 직렬화
+	CRITICAL_SECTION		mLock;			///< 작업 상태 보호
+	CONDITION_VARIABLE		mWorkCond;		///< 작업 도착 알림
+	CONDITION_VARIABLE		mDoneCond;		///< 작업 완료 알림
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	pthread_t*				mThread;		///< 작업 쓰레드
+	pthread_mutex_t			mSubmitLock;	///< 작업 요청 직렬화
+	pthread_mutex_t			mLock;			///< 작업 상태 보호
+	pthread_cond_t			mWorkCond;		///< 작업 도착 알림
+	pthread_cond_t			mDoneCond;		///< 작업 완료 알림
+
+#endif
+
+private:
+				ThreadPool		(	size_t		threadNum,
+										bool		affinity,
+										size_t		threshold,
+										bool		firstTouch
+									);
+	virtual		~ThreadPool		(	void	);
+				ThreadPool		(	const ThreadPool&	pool	);
+	const ThreadPool&	operator=	(	const ThreadPool&	pool	);
+public:
+	void		execute			(	Operation				func,
+									void*					args[],
+									THREAD_RETURN_TYPE		retVal[],
+									size_t					taskNum
+								);
+	void		setThreadNum	(	size_t		threadNum	);
+	void		setAffinity		(	bool		affinity	);
+	void		setThreshold	(	size_t		threshold	);
+	void		setFirstTouch	(	bool		firstTouch	);
+	inline size_t	getThreadNum	(	void	) const;
+	inline bool		getAffinity		(	void	) const;
+	inline size_t	getThreshold	(	void	) const;
+	inline bool		getFirstTouch	(	void	) const;
+	inline bool		isSerial		(	size_t		work	) const;
+	inline size_t	getTaskNum		(	size_t		rowNum	) const;
+	inline size_t	getChunkNum		(	size_t		taskNum,
+										size_t		rowNum
+									) const;
+public:
+	static ThreadPool&		getInstance		(	void	);
+	static size_t			getCoreNum		(	void	);
+	static const std::vector<size_t>&	getCpuList	(	void	);
+	template<class W>
+	static void				splitRows		(	const W		weight[],
+												size_t		rowNum,
+												size_t		partNum,
+												size_t		bound[]
+											);
+private:
+	static size_t			getEnvValue		(	const char*		name,
+												size_t			defValue
+											);
+	static std::vector<size_t>	readCpuList	(	void	);
+private:
+	void		createThreads	(	void	);
+	void		applyAffinity	(	void	);
+	void		destroyThreads	(	void	);
+	void		runTasks		(	size_t		executor	);
+	void		waitWork		(	void	);
+	void		waitDone		(	void	);
+private:
+	static THREAD_RETURN_TYPE THREAD_FUNC_TYPE	workerFunc		(	void*	pData	);
+};
+
+/**
+ * 쓰레드 수 가져오기
+ * @return 동시에 계산하는 쓰레드 수 (호출한 쓰레드 포함)
+ */
+size_t	ThreadPool::getThreadNum	(	void	) const
+{
+	return	mThreadNum;
+}
+
+/**
+ * 작업 쓰레드 CPU 고정 여부 가져오기
+ * @return CPU에 고정하면 true
+ */
+bool	ThreadPool::getAffinity		(	void	) const
+{
+	return	mAffinity;
+}
+
+/**
+ * 쓰레드를 사용할 최소 작업 크기 가져오기
+ * @return 최소 작업 크기 (요소 수)
+ */
+size_t	ThreadPool::getThreshold	(	void	) const
+{
+	return	mThreshold;
+}
+
+/**
+ * first touch 모드 여부 가져오기
+ * @return 작업을 쓰레드에 고정 배정하면 true
+ */
+bool	ThreadPool::getFirstTouch	(	void	) const
+{
+	return	mFirstTouch;
+}
+
+/**
+ * 호출한 쓰레드에서 바로 수행 할 작업인지 검사
+ * 작업 크기 (연산이 읽는 요소 수)가 최소 작업 크기보다 작거나 쓰레드가 1개이면 나누지 않는다.
+ * @return 나누지 않고 수행하면 true
+ */
+bool	ThreadPool::isSerial		(	size_t		work	///< 작업 크기 (요소 수)
+									) const
+{
+	return	( ( mThreadNum < 2 ) || ( work < mThreshold ) );
+}
+
+/**
+ * 나눌 작업 수 가져오기
+ * 쓰레드 수만큼 나누되, 작업 하나가 최소 한 행을 맡도록 행 수를 넘지 않는다.
+ * @return 작업 수 (최소 1)
+ */
+size_t	ThreadPool::getTaskNum		(	size_t		rowNum	///< 나눌 행 (범위) 수
+									) const
+{
+	return	std::max((size_t)1, std::min(mThreadNum, rowNum));
+}
+
+/**
+ * 불규칙한 작업을 나눌 조각 수 가져오기
+ * 행 별 계산량을 미리 알 수 없는 작업 (곱셈 등)은 작업 하나에 여러 조각을 배정하고,
+ * 먼저 끝난 작업이 다른 작업의 조각을 가져가도록 한다. (ChunkQueue)
+ * first touch 모드에서는 행 분할이 바뀌지 않도록 작업 하나에 한 조각만 배정한다.
+ * @return 조각 수 (작업 수 이상, 행 수 이하)
+ */
+size_t	ThreadPool::getChunkNum		(	size_t		taskNum,	///< 작업 수
+										size_t		rowNum		///< 나눌 행 수
+									) const
+{
+	if( ( taskNum < 2 ) || ( mFirstTouch == true ) )
+	{
+		return	taskNum;
+	}
+
+	return	std::max(taskNum, std::min(taskNum * CHUNK_PER_TASK, rowNum));
+}
+
+/**
+ * 행 구간 나누기
+ * 각 구간의 작업량 (weight 누적 값의 차)이 비슷하도록 행을 나누며, 구간은 최소 한 행을 가진다.
+ * 행 길이가 고르지 않은 행렬에서 같은 행 수로 나누면 긴 행을 맡은 쓰레드만 오래 걸리므로,
+ * 행 별 시작 위치 (요소 수 누적 값)를 weight로 사용하여 요소 수 기준으로 나눈다.
+ * partNum은 1 이상, 행 수 이하이어야 한다. (행이 없으면 모든 구간이 비어 있다)
+ */
+template<class W>
+void	ThreadPool::splitRows		(	const W		weight[],	///< 행 별 작업량 누적 값 (rowNum + 1 개)
+										size_t		rowNum,		///< 행 수
+										size_t		partNum,	///< 구간 수
+										size_t		bound[]		///< 구간 별 시작 행 (partNum + 1 개, 마지막은 rowNum)
+									)
+{
+	size_t		base	=	(size_t)weight[0];
+	size_t		total	=	(size_t)weight[rowNum] - base;
+
+	bound[0]		=	0;
+	bound[partNum]	=	rowNum;
+
+	for(size_t part=1;part<partNum;++part)
+	{
+		size_t		target	=	base + total / partNum * part + total % partNum * part / partNum;
+		size_t		row		=	std::lower_bound(weight, weight + rowNum, (W)target) - weight;
+
+		row		=	std::max(row, bound[part-1] + 1);
+		row		=	std::min(row, rowNum - (partNum - part));
+
+		bound[part]		=	row;
+	}
+}
+
+/**
+ * 작업 훔치기 (work stealing) 조각 큐
+ * 조각 번호를 작업 수만큼의 연속 구간으로 나누어 각 작업에 배정한다.
+ * 작업은 자기 구간의 앞에서부터 조각을 가져가고, 자기 구간이 비면 다른 작업 구간의 뒤에서 조각을 훔쳐온다.
+ * 따라서 부하가 고르면 각 작업은 연속 된 행을 처리하고, 고르지 않을 때만 조각이 다른 작업으로 옮겨간다.
+ * 구간의 (앞, 뒤) 위치는 하나의 64비트 값으로 묶어 비교 후 교환 (CAS)으로 갱신한다.
+ */
+class	ChunkQueue
+{
+private:
+	std::vector< std::atomic<uint64_t> >	mRange;		///< 작업 별 남은 조각 구간 (앞 << 32 | 뒤)
+public:
+				ChunkQueue		(	size_t		taskNum,
+									size_t		chunkNum
+								);
+public:
+	bool		pop				(	size_t		task,
+									size_t&		chunk
+								);
+private:
+	bool		popFront		(	size_t		task,
+									size_t&		chunk
+								);
+	bool		popBack			(	size_t		task,
+									size_t&		chunk
+								);
+};
+
+};
+
+#endif /* INCLUDE_THREAD_POOL_H_ */
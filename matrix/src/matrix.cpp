@@ -7,27 +7,55 @@
 
 #include "matrix.h"
 #include "matrix_error.h"
+#include "thread_pool.h"
+#include "matrix_simd.h"
 #include <string.h>
 #include <new>
 #include <math.h>
 
+// 블록 GEMM 크기 (elem_t = double 기준)
+#define	GEMM_MR					(4)			///< 마이크로 커널 행 크기 (레지스터 블록)
+#define	GEMM_NR					(8)			///< 마이크로 커널 열 크기 (레지스터 블록)
+#define	GEMM_MC					(128)		///< A 블록 행 크기 (L2 캐시)
+#define	GEMM_KC					(256)		///< 블록 깊이 (L1 캐시)
+#define	GEMM_NC					(2048)		///< B 패널 열 크기 (L3 캐시)
+#define	GEMM_THREAD_THRESHOLD	(64 * 64 * 64)	///< 쓰레드를 사용할 최소 곱셈 수
+
+#define	COMBINE_BLOCK			(512)		///< 선형 결합 블록 크기 (L1 캐시)
+
 namespace matrix
 {
 
 /**
  * 생성자
  */
-Matrix::Matrix		(	void	)
+template<class T>
+BasicMatrix<T>::BasicMatrix		(	void	)
+:mRowSize(0),
+ mColSize(0),
+mData(NULL)
+{
+}
+
+/**
+ * 이동 생성자
+ * 데이터를 복사하지 않고 가져오며, 원본은 빈 행렬이 된다.
+ */
+template<class T>
+BasicMatrix<T>::BasicMatrix		(	BasicMatrix&&		matrix		///< 이동 할 객체
+					)
 :mRowSize(0),
  mColSize(0),
 mData(NULL)
 {
+	swap(matrix);
 }
 
 /**
  * 생성자
  */
-Matrix::Matrix		(	size_t		row,	///< 행 크기
+template<class T>
+BasicMatrix<T>::BasicMatrix		(	size_t		row,	///< 행 크기
 						size_t		col		///< 열 크기
 					)
 {
@@ -37,7 +65,8 @@ Matrix::Matrix		(	size_t		row,	///< 행 크기
 /**
  * 복사 생성자
  */
-Matrix::Matrix		(	const Matrix&		matrix		///< 복사 될 객체
+template<class T>
+BasicMatrix<T>::BasicMatrix		(	const BasicMatrix&		matrix		///< 복사 될 객체
 					)
 {
 	allocElems(matrix.getRow(), matrix.getCol());
@@ -47,7 +76,8 @@ Matrix::Matrix		(	const Matrix&		matrix		///< 복사 될 객체
 /**
  * 소멸자
  */
-Matrix::~Matrix		(	void	)
+template<class T>
+BasicMatrix<T>::~BasicMatrix		(	void	)
 {
 	freeElems();
 }
@@ -56,7 +86,8 @@ Matrix::~Matrix		(	void	)
  * 행렬 요소 값 참조
  * @return 참조한 행렬 요소 값
  */
-elem_t		Matrix::getElem		(	size_t		row,	///< 참조 할 행 위치
+template<class T>
+T		BasicMatrix<T>::getElem		(	size_t		row,	///< 참조 할 행 위치
 									size_t		col		///< 참조 할 열 위치
 								) const
 {
@@ -67,7 +98,8 @@ elem_t		Matrix::getElem		(	size_t		row,	///< 참조 할 행 위치
 /**
  * 행렬 요소 값 설정
  */
-void		Matrix::setElem		(	size_t		row,	///< 설정 할 행 위치
+template<class T>
+void		BasicMatrix<T>::setElem		(	size_t		row,	///< 설정 할 행 위치
 									size_t		col,	///< 설정 할 열 위치
 									elem_t		elem	///< 설정 할 요소 값
 								)
@@ -80,23 +112,15 @@ void		Matrix::setElem		(	size_t		row,	///< 설정 할 행 위치
  * 행렬 덧셈
  * @return	행렬 덧셈 결과
  */
-Matrix		Matrix::add				(	const Matrix&	operand	///< 피연산자
+template<class T>
+BasicMatrix<T>		BasicMatrix<T>::add				(	const BasicMatrix&	operand	///< 피연산자
 									) const
 {
 	chkSameSize(operand);
 
-	Matrix	result		=	Matrix(getRow(), getCol());
+	BasicMatrix	result		=	BasicMatrix(getRow(), getCol());
 
-	for(size_t row=0;row<getRow();row++)
-	{
-		for(size_t col=0;col<getCol();col++)
-		{
-			result.setElem	(	row,
-								col,
-								getElem(row, col) + operand.getElem(row, col)
-							);
-		}
-	}
+	SimdKernel::add(mData, operand.mData, result.mData, getRow() * getCol());
 
 	return	result;
 }
@@ -105,23 +129,15 @@ Matrix		Matrix::add				(	const Matrix&	operand	///< 피연산자
  * 행렬 뺄셈
  * @return 행렬 뺄셈 결과
  */
-Matrix		Matrix::sub				(	const Matrix&	operand	///< 피연산자
+template<class T>
+BasicMatrix<T>		BasicMatrix<T>::sub				(	const BasicMatrix&	operand	///< 피연산자
 									) const
 {
 	chkSameSize(operand);
 
-	Matrix	result		=	Matrix(getRow(), getCol());
+	BasicMatrix	result		=	BasicMatrix(getRow(), getCol());
 
-	for(size_t row=0;row<getRow();row++)
-	{
-		for(size_t col=0;col<getCol();col++)
-		{
-			result.setElem	(	row,
-									col,
-									getElem(row, col) - operand.getElem(row, col)
-								);
-		}
-	}
+	SimdKernel::sub(mData, operand.mData, result.mData, getRow() * getCol());
 
 	return	result;
 }
@@ -130,29 +146,26 @@ Matrix		Matrix::sub				(	const Matrix&	operand	///< 피연산자
  * 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-Matrix		Matrix::multiply		(	const Matrix&	operand	///< 피연산자
+template<class T>
+BasicMatrix<T>		BasicMatrix<T>::multiply		(	const BasicMatrix&	operand	///< 피연산자
 									) const
 {
-	if( ( getRow() != operand.getCol() ) &&
-		( getCol() != operand.getRow() ) )
+	if( getCol() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	Matrix	result		=	Matrix(getRow(), operand.getCol());
+	BasicMatrix	result		=	BasicMatrix(getRow(), operand.getCol());
 
-	for(size_t row=0;row<result.getRow();row++)
-	{
-		for(size_t col=0;col<result.getCol();col++)
-		{
-			elem_t	 value	=	0;
-			for(size_t x=0;x<getCol();x++)
-			{
-				value	+=	getElem(row, x) * operand.getElem(x, col);
-			}
-			result.setElem(row, col, value);
-		}
-	}
+	gemm_	(	getRow(),
+				operand.getCol(),
+				getCol(),
+				mData,
+				mColSize,
+				1,
+				operand.mData,
+				result.mData
+			);
 
 	return	result;
 }
@@ -161,21 +174,13 @@ Matrix		Matrix::multiply		(	const Matrix&	operand	///< 피연산자
  * 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-Matrix		Matrix::multiply		(	elem_t		operand	///< 피연산자
+template<class T>
+BasicMatrix<T>		BasicMatrix<T>::multiply		(	elem_t		operand	///< 피연산자
 									) const
 {
-	Matrix	result		=	Matrix(getRow(), getCol());
+	BasicMatrix	result		=	BasicMatrix(getRow(), getCol());
 
-	for(size_t row=0;row<getRow();row++)
-	{
-		for(size_t col=0;col<getCol();col++)
-		{
-			result.setElem	(	row,
-									col,
-									getElem(row, col) * operand
-								);
-		}
-	}
+	SimdKernel::scale(operand, mData, result.mData, getRow() * getCol());
 
 	return	result;
 }
@@ -184,27 +189,41 @@ Matrix		Matrix::multiply		(	elem_t		operand	///< 피연산자
  * 전치 행렬 변환
  * @return 전치 행렬 변환 결과
  */
-Matrix		Matrix::transpose		(	void	) const
+template<class T>
+BasicMatrix<T>		BasicMatrix<T>::transpose		(	void	) const
 {
-	Matrix	result		=	Matrix(getCol(), getRow());
+	BasicMatrix	result		=	BasicMatrix(getCol(), getRow());
 
-	for(size_t row=0;row<getRow();row++)
-	{
-		for(size_t col=0;col<getCol();col++)
-		{
-			result.setElem	(	col,
-									row,
-									getElem(row, col)
-								);
-		}
-	}
+	SimdKernel::transpose(mData, getRow(), getCol(), result.mData);
 
 	return	result;
 }
 
-Matrix		Matrix::stmultiply		(	const Matrix&	operand	) const
+/**
+ * 앞 행렬 전치 변환 후 뒤 행렬 곱셈
+ * 전치 행렬을 만들지 않고, 블록을 채울 때 열 방향으로 읽는다.
+ * @return 행렬 곱셈 결과
+ */
+template<class T>
+BasicMatrix<T>		BasicMatrix<T>::stmultiply		(	const BasicMatrix&	operand	///< 피연산자
+									) const
 {
-	Matrix	result		=	this->transpose() * operand;
+	if( getRow() != operand.getRow() )
+	{
+		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
+	}
+
+	BasicMatrix	result		=	BasicMatrix(getCol(), operand.getCol());
+
+	gemm_	(	getCol(),
+				operand.getCol(),
+				getRow(),
+				mData,
+				1,
+				mColSize,
+				operand.mData,
+				result.mData
+			);
 
 	return	result;
 }
@@ -213,7 +232,8 @@ Matrix		Matrix::stmultiply		(	const Matrix&	operand	) const
  * 행렬 대입
  * @return 대입 할 행렬
  */
-const Matrix&		Matrix::equal			(	const Matrix&	operand	///< 피연산자
+template<class T>
+const BasicMatrix<T>&		BasicMatrix<T>::equal			(	const BasicMatrix&	operand	///< 피연산자
 											)
 {
 	try
@@ -231,32 +251,221 @@ const Matrix&		Matrix::equal			(	const Matrix&	operand	///< 피연산자
 	return	*this;
 }
 
+/**
+ * 행렬 데이터 맞바꾸기
+ */
+template<class T>
+void		BasicMatrix<T>::swap			(	BasicMatrix&		operand		///< 맞바꿀 행렬
+									)
+{
+	std::swap(mRowSize, operand.mRowSize);
+	std::swap(mColSize, operand.mColSize);
+	std::swap(mData, operand.mData);
+}
+
+/**
+ * 행렬 x 단일 값 덧셈 (this = this + alpha * operand)
+ * 임시 행렬을 만들지 않고 자신의 데이터를 갱신한다.
+ * @return		연산 결과
+ */
+template<class T>
+const BasicMatrix<T>&		BasicMatrix<T>::axpy		(	elem_t			alpha,		///< 피연산자 계수
+											const BasicMatrix&	operand		///< 피연산자
+										)
+{
+	chkSameSize(operand);
+
+	SimdKernel::axpy(alpha, operand.mData, mData, getRow() * getCol());
+
+	return	*this;
+}
+
+/**
+ * 행렬 x 단일 값 (this = alpha * this)
+ * @return		연산 결과
+ */
+template<class T>
+const BasicMatrix<T>&		BasicMatrix<T>::scale		(	elem_t		alpha	///< 곱할 값
+										)
+{
+	SimdKernel::scale(alpha, mData, mData, getRow() * getCol());
+
+	return	*this;
+}
+
+/**
+ * 행렬 x 단일 값 후 덧셈 (this = alpha * this + operand)
+ * @return		연산 결과
+ */
+template<class T>
+const BasicMatrix<T>&		BasicMatrix<T>::scale_add	(	elem_t			alpha,		///< 자신에 곱할 값
+											const BasicMatrix&	operand		///< 피연산자
+										)
+{
+	chkSameSize(operand);
+
+	SimdKernel::axpby(elem_t(1), operand.mData, alpha, mData, getRow() * getCol());
+
+	return	*this;
+}
+
+/**
+ * 선형 결합 (this = coef[0] * operand[0] + ... + coef[num-1] * operand[num-1])
+ * 요소를 블록 단위로 나누어 각 피연산자를 한 번씩만 읽고 결과를 한 번 쓰며,
+ * 블록을 모두 계산한 후 쓰므로 자신이 피연산자이어도 된다.
+ * @exception		피연산자 크기가 다르거나 메모리 할당 실패 시 예외 발생
+ */
+template<class T>
+void		BasicMatrix<T>::combine		(	size_t					num,		///< 항 수
+									const elem_t			coef[],		///< 항 별 계수
+									const BasicMatrix* const		operand[]	///< 항 별 피연산자
+								)
+{
+	for(size_t cnt=1;cnt<num;++cnt)
+	{
+		operand[0]->chkSameSize(*operand[cnt]);
+	}
+
+	if( ( getRow() != operand[0]->getRow() ) ||
+		( getCol() != operand[0]->getCol() ) )
+	{
+		freeElems();
+		allocElems(operand[0]->getRow(), operand[0]->getCol());
+	}
+
+	ThreadPool&	pool		=	ThreadPool::getInstance();
+	size_t		size		=	getRow() * getCol();
+	size_t		threadNum	=	pool.isSerial(size * num) ? 1 : pool.getTaskNum(getRow());
+
+	std::vector<CombineInfo>	combineInfo(threadNum);
+	std::vector<void*>			args(threadNum);
+
+	for(size_t cnt=0;cnt<threadNum;++cnt)
+	{
+		combineInfo[cnt].num		=	num;
+		combineInfo[cnt].coef		=	coef;
+		combineInfo[cnt].operand	=	operand;
+		combineInfo[cnt].result		=	mData;
+		combineInfo[cnt].start		=	size * cnt / threadNum;
+		combineInfo[cnt].end		=	size * (cnt + 1) / threadNum;
+
+		args[cnt]	=	&combineInfo[cnt];
+	}
+
+	// 쓰레드 풀에서 수행
+	pool.execute	(	BasicMatrix::threadCombine,
+						&args[0],
+						NULL,
+						threadNum
+					);
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x)
+ * x는 getCol() 개, y는 getRow() 개의 연속 된 요소 배열이며, 메모리를 할당하지 않는다.
+ */
+template<class T>
+void		BasicMatrix<T>::spmv		(	const elem_t	x[],	///< 입력 벡터
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	spmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y)
+ * beta가 0이면 y의 기존 값은 읽지 않는다.
+ */
+template<class T>
+void		BasicMatrix<T>::spmv		(	elem_t			alpha,	///< 행렬 x 벡터 계수
+									const elem_t	x[],	///< 입력 벡터
+									elem_t			beta,	///< 결과 벡터 계수
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	spmvRows(alpha, x, beta, y, 0, getRow());
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x, 쓰레드 사용)
+ */
+template<class T>
+void		BasicMatrix<T>::pspmv		(	const elem_t	x[],	///< 입력 벡터
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	pspmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y, 쓰레드 사용)
+ * 행 단위로 나누어 쓰레드 풀에서 수행하며, 각 쓰레드는 자기 행의 y만 쓴다.
+ */
+template<class T>
+void		BasicMatrix<T>::pspmv		(	elem_t			alpha,	///< 행렬 x 벡터 계수
+									const elem_t	x[],	///< 입력 벡터
+									elem_t			beta,	///< 결과 벡터 계수
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	ThreadPool&	pool		=	ThreadPool::getInstance();
+	size_t		threadNum	=	pool.isSerial(getRow() * getCol()) ? 1 : pool.getTaskNum(getRow());
+
+	std::vector<FuncInfo>	funcInfo(threadNum);
+	std::vector<void*>		args(threadNum);
+
+	for(size_t num=0;num<threadNum;++num)
+	{
+		funcInfo[num].matrix	=	this;
+		funcInfo[num].alpha		=	alpha;
+		funcInfo[num].vecX		=	x;
+		funcInfo[num].beta		=	beta;
+		funcInfo[num].vecY		=	y;
+		funcInfo[num].startRow	=	getRow() * num / threadNum;
+		funcInfo[num].endRow	=	getRow() * (num + 1) / threadNum;
+
+		args[num]	=	&funcInfo[num];
+	}
+
+	// 쓰레드 풀에서 수행
+	pool.execute	(	BasicMatrix::threadSpmv,
+						&args[0],
+						NULL,
+						threadNum
+					);
+}
+
 /**
  * 행렬 방정식 해 구하기
  * @return		해 행렬 리턴
  */
-Matrix		Matrix::sol_cg		(	const Matrix&	operand	///< 피연산자
+template<class T>
+BasicMatrix<T>		BasicMatrix<T>::sol_cg		(	const BasicMatrix&	operand	///< 피연산자
 									)
 {
-	Matrix		x			=	Matrix(this->getCol(), operand.getCol());
-	Matrix		r			=	operand - ( (*this) * x );
-	Matrix		p			=	r;
-	Matrix		rSold		=	r.transpose() * r;
-	Matrix		result		=	x;
-	elem_t		min			=	1;
+	BasicMatrix		x			=	BasicMatrix(this->getCol(), operand.getCol());
+
+	std::fill(x.mData, x.mData + x.getRow() * x.getCol(), elem_t(0));
+
+	BasicMatrix		r			=	operand - ( (*this) * x );
+	BasicMatrix		p			=	r;
+	BasicMatrix		ap;
+	BasicMatrix		result		=	x;
+	elem_t		rSold		=	r.stmultiply(r).getElem(0,0);
+	real_t		min			=	1;
 	bool		foundFlag	=	false;
 
 	for(size_t cnt=0;cnt<1000000;cnt++)
 	{
-		Matrix		ap			=	(*this) * p;
-		elem_t		alpha		=	rSold.getElem(0,0) / (p.transpose() * ap).getElem(0,0);
+		ap		=	(*this) * p;
 
-		x	=	x + (p * alpha);
-		r	=	r - (ap * alpha);
+		elem_t		alpha		=	rSold / p.stmultiply(ap).getElem(0,0);
 
-		Matrix		rsNew		=	r.transpose() * r;
+		x.axpy(alpha, p);
+		r.axpy(-alpha, ap);
 
-		elem_t		sqrtVal	=	sqrt(rsNew.getElem(0,0));
+		elem_t		rsNew		=	r.stmultiply(r).getElem(0,0);
+		real_t		sqrtVal		=	std::sqrt(std::abs(rsNew));
 
 		if( min > sqrtVal )
 		{
@@ -270,13 +479,13 @@ Matrix		Matrix::sol_cg		(	const Matrix&	operand	///< 피연산자
 			break;
 		}
 
-		p		=	r + ( p * (rsNew.getElem(0,0) / rSold.getElem(0,0) ) );
+		p.scale_add(rsNew / rSold, r);
 		rSold	=	rsNew;
 	}
 
 	if( foundFlag != true )
 	{
-		x	=	result;
+		x.swap(result);
 	}
 
 	return	x;
@@ -286,7 +495,8 @@ Matrix		Matrix::sol_cg		(	const Matrix&	operand	///< 피연산자
  * 행렬 데이터 공간 할당
  * @exception 메모리 할당 실패 시 에러 발생
  */
-void		Matrix::allocElems			(	size_t		row,	///< 행 크기
+template<class T>
+void		BasicMatrix<T>::allocElems			(	size_t		row,	///< 행 크기
 											size_t		col		///< 열 크기
 										)
 {
@@ -305,7 +515,8 @@ void		Matrix::allocElems			(	size_t		row,	///< 행 크기
 /**
  * 행렬 데이터 공간 할당 해제
  */
-void		Matrix::freeElems			(	void	)
+template<class T>
+void		BasicMatrix<T>::freeElems			(	void	)
 {
 	delete[]	mData;
 	mRowSize	=	0;
@@ -315,7 +526,8 @@ void		Matrix::freeElems			(	void	)
 /**
  * 행렬 데이터 복사
  */
-void		Matrix::copyElems			(	const Matrix&		matrix		///< 복사 할 행렬
+template<class T>
+void		BasicMatrix<T>::copyElems			(	const BasicMatrix&		matrix		///< 복사 할 행렬
 										)
 {
 	size_t		length		=	matrix.getRow()
@@ -329,7 +541,8 @@ void		Matrix::copyElems			(	const Matrix&		matrix		///< 복사 할 행렬
  * 같은 크기의 행렬인지 검사
  * @exception 행렬이 같은 크기가 아닐 경우 예외 발생
  */
-void		Matrix::chkSameSize		(	const Matrix&		matrix		///< 비교 할 행렬
+template<class T>
+void		BasicMatrix<T>::chkSameSize		(	const BasicMatrix&		matrix		///< 비교 할 행렬
 										) const
 {
 	if( ( getRow() != matrix.getRow() ) ||
@@ -343,7 +556,8 @@ void		Matrix::chkSameSize		(	const Matrix&		matrix		///< 비교 할 행렬
  * 행렬 요소 참조 범위 검사
  * @exception 참조 범위 밖일 경우 예외 발생
  */
-void		Matrix::chkBound			(	size_t		row,	///< 참조 할 행 위치
+template<class T>
+void		BasicMatrix<T>::chkBound			(	size_t		row,	///< 참조 할 행 위치
 											size_t		col		///< 참조 할 열 위치
 										) const
 {
@@ -354,4 +568,357 @@ void		Matrix::chkBound			(	size_t		row,	///< 참조 할 행 위치
 	}
 }
 
+/**
+ * 지정한 범위의 행에 대한 행렬 x 벡터
+ */
+template<class T>
+void		BasicMatrix<T>::spmvRows		(	elem_t			alpha,		///< 행렬 x 벡터 계수
+										const elem_t	x[],		///< 입력 벡터
+										elem_t			beta,		///< 결과 벡터 계수
+										elem_t			y[],		///< 결과 벡터
+										size_t			startRow,	///< 시작 행
+										size_t			endRow		///< 종료 행 (미포함)
+									) const
+{
+	for(size_t row=startRow;row<endRow;++row)
+	{
+		elem_t		sum		=	0;
+
+		const elem_t*	data	=	mData + row * mColSize;
+
+		for(size_t col=0;col<mColSize;++col)
+		{
+			sum		+=	data[col] * x[col];
+		}
+
+		if( beta == elem_t(0) )
+		{
+			y[row]	=	alpha * sum;
+		}
+		else
+		{
+			y[row]	=	alpha * sum + beta * y[row];
+		}
+	}
+}
+
+/**
+ * 지정한 범위의 행에 대한 행렬 x 벡터
+ * return 항상 NULL을 리턴
+ */
+template<class T>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrix<T>::threadSpmv		(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+
+	info->matrix->spmvRows	(	info->alpha,
+								info->vecX,
+								info->beta,
+								info->vecY,
+								info->startRow,
+								info->endRow
+							);
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 요소에 대한 선형 결합
+ * 블록 별로 결과를 버퍼에 누적한 후 한 번에 쓴다.
+ * return 항상 NULL을 리턴
+ */
+template<class T>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrix<T>::threadCombine	(	void*	pData	)
+{
+	CombineInfo*	info		=	(CombineInfo*)pData;
+	elem_t			buffer[COMBINE_BLOCK];
+
+	for(size_t pos=info->start;pos<info->end;pos+=COMBINE_BLOCK)
+	{
+		size_t		len		=	std::min((size_t)COMBINE_BLOCK, info->end - pos);
+
+		SimdKernel::scale(info->coef[0], info->operand[0]->mData + pos, buffer, len);
+
+		for(size_t cnt=1;cnt<info->num;++cnt)
+		{
+			SimdKernel::axpy(info->coef[cnt], info->operand[cnt]->mData + pos, buffer, len);
+		}
+
+		memcpy(info->result + pos, buffer, sizeof(elem_t) * len);
+	}
+
+	return	NULL;
+}
+
+/**
+ * 블록 행렬 곱셈 (C = A * B)
+ * A는 mc x kc 블록, B는 kc x nc 패널 단위로 연속 된 버퍼에 채운 후
+ * GEMM_MR x GEMM_NR 크기의 레지스터 블록 단위로 곱한다.
+ * A의 행을 GEMM_MR 배수로 나누어 쓰레드 풀에서 수행한다.
+ */
+template<class T>
+void		BasicMatrix<T>::gemm_		(	size_t			m,		///< 결과 행 크기
+									size_t			n,		///< 결과 열 크기
+									size_t			k,		///< 곱셈 깊이
+									const elem_t*	a,		///< A 행렬
+									size_t			rsA,	///< A 행 간격
+									size_t			csA,	///< A 열 간격
+									const elem_t*	b,		///< B 행렬 (k x n)
+									elem_t*			c		///< 결과 행렬 (m x n)
+								)
+{
+	if( ( m == 0 ) ||
+		( n == 0 ) )
+	{
+		return;
+	}
+
+	if( k == 0 )
+	{
+		std::fill(c, c + m * n, elem_t(0));
+		return;
+	}
+
+	ThreadPool&	pool		=	ThreadPool::getInstance();
+	size_t		blockNum	=	(m + GEMM_MR - 1) / GEMM_MR;
+	size_t		taskNum		=	pool.getTaskNum(blockNum);
+
+	if( m * n * k < GEMM_THREAD_THRESHOLD )
+	{
+		taskNum		=	1;
+	}
+
+	size_t		ncMax		=	std::min((size_t)GEMM_NC, n);
+	size_t		packASize	=	GEMM_MC * GEMM_KC;
+	size_t		packBSize	=	GEMM_KC * ((ncMax + GEMM_NR - 1) / GEMM_NR) * GEMM_NR;
+
+	std::vector<elem_t>		buffer;
+
+	try
+	{
+		buffer.resize(taskNum * (packASize + packBSize));
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	std::vector<GemmInfo>	info(taskNum);
+	std::vector<void*>		args(taskNum);
+
+	for(size_t num=0;num<taskNum;++num)
+	{
+		info[num].a			=	a;
+		info[num].rsA		=	rsA;
+		info[num].csA		=	csA;
+		info[num].b			=	b;
+		info[num].c			=	c;
+		info[num].n			=	n;
+		info[num].k			=	k;
+		info[num].startRow	=	std::min(m, blockNum * num / taskNum * GEMM_MR);
+		info[num].endRow	=	std::min(m, blockNum * (num + 1) / taskNum * GEMM_MR);
+		info[num].packA		=	&buffer[num * (packASize + packBSize)];
+		info[num].packB		=	info[num].packA + packASize;
+
+		args[num]	=	&info[num];
+	}
+
+	// 쓰레드 풀에서 수행
+	pool.execute	(	BasicMatrix::threadGemm,
+						&args[0],
+						NULL,
+						taskNum
+					);
+}
+
+/**
+ * A 블록 채우기
+ * GEMM_MR 행 단위로, 각 깊이 위치의 GEMM_MR 개 요소가 연속 되도록 채운다.
+ * 행 수가 GEMM_MR 배수가 아니면 남는 자리는 0으로 채운다.
+ */
+template<class T>
+void		BasicMatrix<T>::packA_		(	size_t			mc,		///< 블록 행 크기
+									size_t			kc,		///< 블록 깊이
+									const elem_t*	a,		///< 블록 시작 위치
+									size_t			rsA,	///< 행 간격
+									size_t			csA,	///< 열 간격
+									elem_t*			packed	///< 블록 버퍼
+								)
+{
+	for(size_t ir=0;ir<mc;ir+=GEMM_MR)
+	{
+		size_t		mr		=	std::min((size_t)GEMM_MR, mc - ir);
+
+		for(size_t p=0;p<kc;++p)
+		{
+			for(size_t i=0;i<mr;++i)
+			{
+				packed[i]	=	a[(ir + i) * rsA + p * csA];
+			}
+
+			for(size_t i=mr;i<GEMM_MR;++i)
+			{
+				packed[i]	=	0;
+			}
+
+			packed	+=	GEMM_MR;
+		}
+	}
+}
+
+/**
+ * B 패널 채우기
+ * GEMM_NR 열 단위로, 각 깊이 위치의 GEMM_NR 개 요소가 연속 되도록 채운다.
+ * 열 수가 GEMM_NR 배수가 아니면 남는 자리는 0으로 채운다.
+ */
+template<class T>
+void		BasicMatrix<T>::packB_		(	size_t			kc,		///< 패널 깊이
+									size_t			nc,		///< 패널 열 크기
+									const elem_t*	b,		///< 패널 시작 위치
+									size_t			ldb,	///< 행 간격
+									elem_t*			packed	///< 패널 버퍼
+								)
+{
+	for(size_t jr=0;jr<nc;jr+=GEMM_NR)
+	{
+		size_t		nr		=	std::min((size_t)GEMM_NR, nc - jr);
+
+		for(size_t p=0;p<kc;++p)
+		{
+			const elem_t*	row		=	b + p * ldb + jr;
+
+			for(size_t j=0;j<nr;++j)
+			{
+				packed[j]	=	row[j];
+			}
+
+			for(size_t j=nr;j<GEMM_NR;++j)
+			{
+				packed[j]	=	0;
+			}
+
+			packed	+=	GEMM_NR;
+		}
+	}
+}
+
+/**
+ * GEMM_MR x GEMM_NR 레지스터 블록 곱셈
+ * 결과 블록을 지역 배열에 누적한 후 한 번에 C에 쓴다.
+ */
+template<class T>
+void		BasicMatrix<T>::microKernel_	(	size_t			kc,			///< 곱셈 깊이
+										const elem_t*	a,			///< A 블록 (GEMM_MR 행)
+										const elem_t*	b,			///< B 패널 (GEMM_NR 열)
+										elem_t*			c,			///< 결과 위치
+										size_t			ldc,		///< 결과 행 간격
+										size_t			mr,			///< 실제 행 수
+										size_t			nr,			///< 실제 열 수
+										bool			accumulate	///< C 기존 값에 더할지 여부
+									)
+{
+	elem_t		ab[GEMM_MR][GEMM_NR];
+
+	for(size_t i=0;i<GEMM_MR;++i)
+	{
+		for(size_t j=0;j<GEMM_NR;++j)
+		{
+			ab[i][j]	=	0;
+		}
+	}
+
+	for(size_t p=0;p<kc;++p)
+	{
+		for(size_t i=0;i<GEMM_MR;++i)
+		{
+			elem_t		ai		=	a[i];
+
+			for(size_t j=0;j<GEMM_NR;++j)
+			{
+				ab[i][j]	+=	ai * b[j];
+			}
+		}
+
+		a	+=	GEMM_MR;
+		b	+=	GEMM_NR;
+	}
+
+	for(size_t i=0;i<mr;++i)
+	{
+		elem_t*		row		=	c + i * ldc;
+
+		if( accumulate == true )
+		{
+			for(size_t j=0;j<nr;++j)
+			{
+				row[j]	+=	ab[i][j];
+			}
+		}
+		else
+		{
+			for(size_t j=0;j<nr;++j)
+			{
+				row[j]	=	ab[i][j];
+			}
+		}
+	}
+}
+
+/**
+ * 지정한 범위의 행에 대한 블록 행렬 곱셈
+ * return 항상 NULL을 리턴
+ */
+template<class T>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrix<T>::threadGemm		(	void*	pData	)
+{
+	GemmInfo*		info	=	(GemmInfo*)pData;
+	size_t			n		=	info->n;
+	size_t			k		=	info->k;
+
+	for(size_t jc=0;jc<n;jc+=GEMM_NC)
+	{
+		size_t		nc		=	std::min((size_t)GEMM_NC, n - jc);
+
+		for(size_t pc=0;pc<k;pc+=GEMM_KC)
+		{
+			size_t		kc		=	std::min((size_t)GEMM_KC, k - pc);
+
+			packB_(kc, nc, info->b + pc * n + jc, n, info->packB);
+
+			for(size_t ic=info->startRow;ic<info->endRow;ic+=GEMM_MC)
+			{
+				size_t		mc		=	std::min((size_t)GEMM_MC, info->endRow - ic);
+
+				packA_(mc, kc, info->a + ic * info->rsA + pc * info->csA, info->rsA, info->csA, info->packA);
+
+				for(size_t jr=0;jr<nc;jr+=GEMM_NR)
+				{
+					for(size_t ir=0;ir<mc;ir+=GEMM_MR)
+					{
+						microKernel_	(	kc,
+											info->packA + ir * kc,
+											info->packB + jr * kc,
+											info->c + (ic + ir) * n + jc + jr,
+											n,
+											std::min((size_t)GEMM_MR, mc - ir),
+											std::min((size_t)GEMM_NR, nc - jr),
+											pc != 0
+										);
+					}
+				}
+			}
+		}
+	}
+
+	return	NULL;
+}
+
+/////////////////////////////
+// 요소 형식 별 명시적 인스턴스
+
+template class	BasicMatrix< float >;
+template class	BasicMatrix< double >;
+template class	BasicMatrix< std::complex<float> >;
+template class	BasicMatrix< std::complex<double> >;
+
 };
@@ -0,0 +1,302 @@
+/*
+ * matrix_arena.cpp
+ *
+ *  Created on: 2015. 9. 2.
+ *      Author: asran
+ */
+
+#include "matrix_arena.h"
+
+#include <stdlib.h>
+
+namespace matrix
+{
+
+/**
+ * 생성자
+ * 덩어리는 처음 할당할 때 만든다.
+ */
+RowArena::RowArena		(	void	)
+:mHead(NULL),
+ mCurrent(NULL),
+ mChunkSize(MIN_CHUNK_SIZE),
+ mSize(0),
+ mWaste(0)
+{
+}
+
+/**
+ * 소멸자
+ */
+RowArena::~RowArena		(	void	)
+{
+	reset();
+}
+
+/**
+ * 공간 할당
+ * 현재 덩어리에서 잘라 주고, 남은 공간이 없으면 새 덩어리를 만든다.
+ * 덩어리 크기의 1/4보다 큰 요청은 따로 덩어리를 만들어 현재 덩어리를 바꾸지 않는다.
+ * @exception 메모리 할당 실패 시 std::bad_alloc 발생
+ * @return 할당 된 공간 (ALIGN 경계)
+ */
+void*		RowArena::allocate		(	size_t		size	///< 크기 (바이트)
+									)
+{
+	size	=	( std::max(size, (size_t)1) + ALIGN - 1 ) / ALIGN * ALIGN;
+
+	while( true )
+	{
+		Chunk*		chunk	=	mCurrent.load(std::memory_order_acquire);
+
+		if( chunk != NULL )
+		{
+			size_t		pos		=	chunk->used.fetch_add(size, std::memory_order_relaxed);
+
+			if( pos + size <= chunk->size )
+			{
+				return	getData(chunk) + pos;
+			}
+		}
+
+		size_t		chunkSize	=	mChunkSize.load(std::memory_order_relaxed);
+
+		if( size > chunkSize / 4 )
+		{
+			Chunk*		single	=	createChunk(size);
+
+			single->used.store(size, std::memory_order_relaxed);
+
+			return	getData(single);
+		}
+
+		// 다른 쓰레드가 이미 새 덩어리로 바꾸었으면 그 덩어리에서 다시 시도한다.
+		if( mCurrent.load(std::memory_order_acquire) != chunk )
+		{
+			continue;
+		}
+
+		Chunk*		next	=	createChunk(chunkSize);
+
+		next->used.store(size, std::memory_order_relaxed);
+
+		if( mCurrent.compare_exchange_strong(chunk, next) == true )
+		{
+			mChunkSize.store(std::min(chunkSize * 2, (size_t)MAX_CHUNK_SIZE), std::memory_order_relaxed);
+		}
+
+		return	getData(next);
+	}
+}
+
+/**
+ * 모든 덩어리 해제
+ * 이 공간에서 할당 받은 행이 더 이상 없을 때 호출해야 한다.
+ */
+void		RowArena::reset		(	void	)
+{
+	Chunk*		chunk	=	mHead.exchange(NULL);
+
+	while( chunk != NULL )
+	{
+		Chunk*		next	=	chunk->next;
+
+		chunk->~Chunk();
+		free(chunk);
+
+		chunk	=	next;
+	}
+
+	mCurrent.store(NULL);
+	mChunkSize.store(MIN_CHUNK_SIZE);
+	mSize.store(0);
+	mWaste.store(0);
+}
+
+/**
+ * 덩어리 생성
+ * 만든 덩어리는 해제를 위해 덩어리 목록에 추가한다.
+ * @exception 메모리 할당 실패 시 std::bad_alloc 발생
+ * @return 생성 된 덩어리
+ */
+RowArena::Chunk*	RowArena::createChunk		(	size_t		size	///< 데이터 크기 (바이트)
+												)
+{
+	void*		ptr		=	malloc(getHeaderSize() + size);
+
+	if( ptr == NULL )
+	{
+		throw	std::bad_alloc();
+	}
+
+	Chunk*		chunk	=	new(ptr) Chunk;
+
+	chunk->size		=	size;
+	chunk->used.store(0, std::memory_order_relaxed);
+	chunk->next		=	mHead.load(std::memory_order_relaxed);
+
+	while( mHead.compare_exchange_weak(chunk->next, chunk) == false )
+	{
+	}
+
+	mSize.fetch_add(size, std::memory_order_relaxed);
+
+	return	chunk;
+}
+
+/**
+ * 생성자
+ * 노드 크기는 처음 할당할 때 정한다.
+ */
+NodePool::NodePool		(	void	)
+:mNodeSize(0)
+{
+	for(size_t cnt=0;cnt<STRIPE_NUM;++cnt)
+	{
+		mStripe[cnt].lock.clear();
+		mStripe[cnt].freeList	=	NULL;
+		mStripe[cnt].pos		=	NULL;
+		mStripe[cnt].end		=	NULL;
+	}
+}
+
+/**
+ * 소멸자
+ */
+NodePool::~NodePool		(	void	)
+{
+}
+
+/**
+ * 노드 할당
+ * 호출한 쓰레드 구역의 해제 된 노드를 먼저 쓰고, 없으면 묶음에서 잘라 준다.
+ * @exception 메모리 할당 실패 시 std::bad_alloc 발생
+ * @return 할당 된 공간
+ */
+void*		NodePool::allocate		(	size_t		size	///< 크기 (바이트)
+									)
+{
+	size	=	( size + RowArena::ALIGN - 1 ) / RowArena::ALIGN * RowArena::ALIGN;
+
+	if( isNode(size) == false )
+	{
+		return	::operator new(size);
+	}
+
+	Stripe&		stripe	=	mStripe[getStripe()];
+	void*		ptr		=	NULL;
+
+	while( stripe.lock.test_and_set(std::memory_order_acquire) == true )
+	{
+	}
+
+	try
+	{
+		if( stripe.freeList != NULL )
+		{
+			ptr					=	stripe.freeList;
+			stripe.freeList		=	stripe.freeList->next;
+		}
+		else
+		{
+			if( stripe.pos == stripe.end )
+			{
+				stripe.pos		=	(char*)mArena.allocate(size * BLOCK_NODE_NUM);
+				stripe.end		=	stripe.pos + size * BLOCK_NODE_NUM;
+			}
+
+			ptr				=	stripe.pos;
+			stripe.pos		+=	size;
+		}
+	}
+	catch (	std::bad_alloc&		)
+	{
+		stripe.lock.clear(std::memory_order_release);
+
+		throw;
+	}
+
+	stripe.lock.clear(std::memory_order_release);
+
+	return	ptr;
+}
+
+/**
+ * 노드 해제
+ * 호출한 쓰레드 구역의 해제 목록에 넣어 다시 쓴다.
+ */
+void		NodePool::deallocate		(	void*		ptr,	///< 해제 할 공간
+											size_t		size	///< 크기 (바이트)
+										)
+{
+	size	=	( size + RowArena::ALIGN - 1 ) / RowArena::ALIGN * RowArena::ALIGN;
+
+	if( size != mNodeSize.load(std::memory_order_relaxed) )
+	{
+		::operator delete(ptr);
+
+		return;
+	}
+
+	Stripe&		stripe	=	mStripe[getStripe()];
+	FreeNode*	node	=	(FreeNode*)ptr;
+
+	while( stripe.lock.test_and_set(std::memory_order_acquire) == true )
+	{
+	}
+
+	node->next			=	stripe.freeList;
+	stripe.freeList		=	node;
+
+	stripe.lock.clear(std::memory_order_release);
+}
+
+/**
+ * 모든 노드 해제
+ * 이 공간에서 할당 받은 노드가 더 이상 없을 때 호출해야 한다.
+ */
+void		NodePool::reset		(	void	)
+{
+	for(size_t cnt=0;cnt<STRIPE_NUM;++cnt)
+	{
+		mStripe[cnt].freeList	=	NULL;
+		mStripe[cnt].pos		=	NULL;
+		mStripe[cnt].end		=	NULL;
+	}
+
+	mArena.reset();
+}
+
+/**
+ * 노드로 관리하는 크기인지 검사
+ * 처음 요청 된 크기를 노드 크기로 정한다.
+ * @return 노드 크기이면 true
+ */
+bool		NodePool::isNode		(	size_t		size	///< 크기 (ALIGN 단위)
+									)
+{
+	size_t		nodeSize	=	mNodeSize.load(std::memory_order_relaxed);
+
+	if( ( nodeSize == 0 ) &&
+		( mNodeSize.compare_exchange_strong(nodeSize, size) == true ) )
+	{
+		return	true;
+	}
+
+	return	( nodeSize == size );
+}
+
+/**
+ * 호출한 쓰레드의 구역 번호 가져오기
+ * 쓰레드마다 처음 호출할 때 차례로 번호를 정한다.
+ * @return 구역 번호
+ */
+size_t		NodePool::getStripe		(	void	)
+{
+	static std::atomic<size_t>		sNextStripe(0);
+	static thread_local size_t		sStripe		=	sNextStripe.fetch_add(1) % STRIPE_NUM;
+
+	return	sStripe;
+}
+
+};
@@ -0,0 +1,548 @@
+/*
+ * matrix_builder.cpp
+ *
+ *  Created on: 2015. 7. 27.
+ *      Author: asran
+ */
+
+#include "matrix_builder.h"
+#include "matrix.h"
+#include "matrix_csr.h"
+#include "sparse_matrix.h"
+#include "sparse_matrix2.h"
+#include "matrix_error.h"
+#include "thread_pool.h"
+#include <string.h>
+#include <new>
+
+#define	SORT_TASK_MIN_SIZE		(4096)		///< 정렬 작업 하나가 맡을 최소 요소 수
+
+namespace matrix
+{
+
+/**
+ * 생성자
+ */
+MatrixBuilder::MatrixBuilder		(	size_t		row,	///< 행 크기
+										size_t		col		///< 열 크기
+									)
+:mRowSize(row),
+mColSize(col),
+mCompressed(false)
+{
+}
+
+/**
+ * 소멸자
+ */
+MatrixBuilder::~MatrixBuilder		(	void	)
+{
+}
+
+/**
+ * 입력 할 요소 수 만큼 공간 미리 할당
+ */
+void		MatrixBuilder::reserve		(	size_t		num		///< 요소 수
+										)
+{
+	try
+	{
+		mRow.reserve(num);
+		mCol.reserve(num);
+		mElem.reserve(num);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+}
+
+/**
+ * 요소 추가
+ * 같은 위치에 여러 번 추가하면 생성 시 값을 더한다.
+ */
+void		MatrixBuilder::addElem		(	size_t		row,	///< 행 위치
+											size_t		col,	///< 열 위치
+											elem_t		elem	///< 값
+										)
+{
+	chkBound(row, col);
+
+	try
+	{
+		mRow.push_back(row);
+		mCol.push_back(col);
+		mElem.push_back(elem);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	mCompressed		=	false;
+}
+
+/**
+ * 요소 배열 추가
+ * 같은 위치에 여러 번 추가하면 생성 시 값을 더한다.
+ */
+void		MatrixBuilder::addElems		(	const size_t	row[],	///< 행 위치 배열
+											const size_t	col[],	///< 열 위치 배열
+											const elem_t	elem[],	///< 값 배열
+											size_t			num		///< 요소 수
+										)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		chkBound(row[cnt], col[cnt]);
+	}
+
+	try
+	{
+		mRow.insert(mRow.end(), row, row + num);
+		mCol.insert(mCol.end(), col, col + num);
+		mElem.insert(mElem.end(), elem, elem + num);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	mCompressed		=	false;
+}
+
+/**
+ * 입력 된 요소 모두 제거
+ */
+void		MatrixBuilder::clear		(	void	)
+{
+	mRow.clear();
+	mCol.clear();
+	mElem.clear();
+	mOrder.clear();
+	mRowStart.clear();
+	mRowCount.clear();
+	mSortCol.clear();
+	mSortElem.clear();
+
+	mCompressed		=	false;
+}
+
+/**
+ * CSR 행렬 생성
+ * 기존 행렬 데이터는 제거되고, 빌더의 크기와 요소로 다시 채워진다.
+ */
+void		MatrixBuilder::build		(	MatrixCSR&		matrix	///< 생성 할 행렬
+										)
+{
+	compress();
+
+	matrix.freeElems();
+	matrix.allocElems(mRowSize, mColSize);
+
+	size_t		total	=	0;
+
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		total						+=	mRowCount[row];
+		matrix.mRowStart[row+1]		=	total;
+	}
+
+	matrix.reserveElems(total);
+	matrix.placeElems();
+
+	doRowFunc(MatrixBuilder::threadBuildCSR, &matrix);
+}
+
+/**
+ * 희소 행렬 생성 (Array + Vector)
+ * 기존 행렬 데이터는 제거되고, 빌더의 크기와 요소로 다시 채워진다.
+ */
+void		MatrixBuilder::build		(	SparseMatrix&	matrix	///< 생성 할 행렬
+										)
+{
+	compress();
+
+	matrix.freeElems();
+	matrix.allocElems(mRowSize, mColSize);
+
+	doRowFunc(MatrixBuilder::threadBuildSparse, &matrix);
+
+	matrix.mSorted	=	true;
+}
+
+/**
+ * 희소 행렬 생성 (Array + Map)
+ * 기존 행렬 데이터는 제거되고, 빌더의 크기와 요소로 다시 채워진다.
+ */
+void		MatrixBuilder::build		(	SparseMatrix2&	matrix	///< 생성 할 행렬
+										)
+{
+	compress();
+
+	matrix.freeElems();
+	matrix.allocElems(mRowSize, mColSize);
+
+	doRowFunc(MatrixBuilder::threadBuildSparse2, &matrix);
+}
+
+/**
+ * 행렬 생성
+ * 기존 행렬 데이터는 제거되고, 빌더의 크기와 요소로 다시 채워진다.
+ */
+void		MatrixBuilder::build		(	Matrix&		matrix	///< 생성 할 행렬
+										)
+{
+	compress();
+
+	matrix.freeElems();
+	matrix.allocElems(mRowSize, mColSize);
+
+	doRowFunc(MatrixBuilder::threadBuildMatrix, &matrix);
+}
+
+/**
+ * 입력 된 요소를 행, 열 순서로 정렬하고 같은 위치의 값을 더한다.
+ * 결과는 mRowStart / mRowCount / mSortCol / mSortElem에 저장된다.
+ */
+void		MatrixBuilder::compress		(	void	)
+{
+	if( mCompressed == true )
+	{
+		return;
+	}
+
+	size_t		num		=	mElem.size();
+
+	try
+	{
+		std::vector<size_t>		colOrder(num);
+
+		mOrder.resize(num);
+		mRowStart.assign(mRowSize + 1, 0);
+		mRowCount.assign(mRowSize, 0);
+		mSortCol.resize(num);
+		mSortElem.resize(num);
+
+		// LSD 기수 정렬 : 열 기준 정렬 후 행 기준 안정 정렬
+		sortByKey(mCol, mColSize, NULL, colOrder.data(), NULL);
+		sortByKey(mRow, mRowSize, colOrder.data(), mOrder.data(), mRowStart.data());
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	doRowFunc(MatrixBuilder::threadCompress, NULL);
+
+	std::vector<size_t>().swap(mOrder);
+
+	mCompressed		=	true;
+}
+
+/**
+ * 키 기준 병렬 안정 계수 정렬
+ * 작업 별로 키 개수를 센 뒤 (키, 작업) 순서로 기록 위치를 정하고, 각 작업이 자기 구간을 흩어 쓴다.
+ */
+void		MatrixBuilder::sortByKey		(	const std::vector<size_t>&	key,		///< 요소 별 키
+												size_t						keyRange,	///< 키 범위
+												const size_t*				src,		///< 입력 순서 (NULL이면 요소 순서)
+												size_t*						dst,		///< 출력 순서
+												size_t*						keyStart	///< 키 별 시작 위치 (NULL 가능, keyRange+1 개)
+											)
+{
+	ThreadPool&	pool		=	ThreadPool::getInstance();
+	size_t		num			=	key.size();
+	size_t		taskNum		=	pool.getThreadNum();
+
+	if( ( pool.isSerial(num) == true ) ||
+		( num < SORT_TASK_MIN_SIZE * 2 ) )
+	{
+		taskNum		=	1;
+	}
+	else
+	{
+		// 작업 별 계수 배열이 요소 수보다 커지지 않도록 한다.
+		taskNum		=	std::min(taskNum, num / SORT_TASK_MIN_SIZE);
+		taskNum		=	std::min(taskNum, 1 + num / (keyRange + 1));
+	}
+
+	std::vector<size_t>		hist(taskNum * keyRange, 0);
+	std::vector<SortInfo>	info(taskNum);
+	std::vector<void*>		args(taskNum);
+
+	for(size_t task=0;task<taskNum;++task)
+	{
+		info[task].key		=	key.data();
+		info[task].src		=	src;
+		info[task].dst		=	dst;
+		info[task].hist		=	hist.data() + task * keyRange;
+		info[task].start	=	num * task / taskNum;
+		info[task].end		=	num * (task + 1) / taskNum;
+
+		args[task]	=	&info[task];
+	}
+
+	pool.execute(MatrixBuilder::threadCount, &args[0], NULL, taskNum);
+
+	size_t		pos		=	0;
+
+	for(size_t cnt=0;cnt<keyRange;++cnt)
+	{
+		if( keyStart != NULL )
+		{
+			keyStart[cnt]	=	pos;
+		}
+
+		for(size_t task=0;task<taskNum;++task)
+		{
+			size_t		count	=	hist[task * keyRange + cnt];
+
+			hist[task * keyRange + cnt]		=	pos;
+			pos								+=	count;
+		}
+	}
+
+	if( keyStart != NULL )
+	{
+		keyStart[keyRange]	=	pos;
+	}
+
+	pool.execute(MatrixBuilder::threadScatter, &args[0], NULL, taskNum);
+}
+
+/**
+ * 행 단위 작업 수행
+ * 정렬 결과의 요소 수가 비슷하도록 행 구간을 나누어 쓰레드 풀에서 수행한다.
+ */
+void		MatrixBuilder::doRowFunc		(	Operation	func,	///< 작업 함수
+												void*		target	///< 생성 할 행렬
+											)
+{
+	ThreadPool&	pool		=	ThreadPool::getInstance();
+	size_t		total		=	mRowStart[mRowSize];
+
+	if( mRowSize == 0 )
+	{
+		return;
+	}
+
+	size_t		threadNum	=	pool.isSerial(total) ? 1 : pool.getTaskNum(mRowSize);
+
+	std::vector<RowInfo>	info(threadNum);
+	std::vector<void*>		args(threadNum);
+	std::vector<size_t>		bound(threadNum + 1);
+
+	// MatrixCSR 연산과 같은 구간으로 나누어, first touch 모드에서 같은 쓰레드가 같은 행을 채운다.
+	ThreadPool::splitRows(&mRowStart[0], mRowSize, threadNum, &bound[0]);
+
+	for(size_t num=0;num<threadNum;++num)
+	{
+		info[num].builder	=	this;
+		info[num].target	=	target;
+		info[num].startRow	=	bound[num];
+		info[num].endRow	=	bound[num+1];
+
+		args[num]	=	&info[num];
+	}
+
+	pool.execute(func, &args[0], NULL, threadNum);
+}
+
+/**
+ * 참조 범위 검사
+ * @exception 참조 범위 밖이면 에러 발생
+ */
+void		MatrixBuilder::chkBound		(	size_t		row,	///< 참조 할 행 위치
+											size_t		col		///< 참조 할 열 위치
+										) const
+{
+	if( ( row >= mRowSize ) ||
+		( col >= mColSize ) )
+	{
+		throw	matrix::ErrMsg::createErrMsg("범위를 넘어서는 참조입니다.");
+	}
+}
+
+/**
+ * 계수 정렬 키 개수 세기
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixBuilder::threadCount		(	void*	pData	)
+{
+	SortInfo*		info	=	(SortInfo*)pData;
+
+	for(size_t pos=info->start;pos<info->end;++pos)
+	{
+		size_t		idx		=	( info->src != NULL ) ? info->src[pos] : pos;
+
+		info->hist[info->key[idx]]++;
+	}
+
+	return	0;
+}
+
+/**
+ * 계수 정렬 결과 기록
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixBuilder::threadScatter		(	void*	pData	)
+{
+	SortInfo*		info	=	(SortInfo*)pData;
+
+	for(size_t pos=info->start;pos<info->end;++pos)
+	{
+		size_t		idx		=	( info->src != NULL ) ? info->src[pos] : pos;
+
+		info->dst[info->hist[info->key[idx]]++]		=	idx;
+	}
+
+	return	0;
+}
+
+/**
+ * 정렬 된 행에서 같은 열의 값을 더하고 0인 값을 제거
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixBuilder::threadCompress	(	void*	pData	)
+{
+	RowInfo*			info		=	(RowInfo*)pData;
+	MatrixBuilder*		builder		=	info->builder;
+	const size_t*		order		=	builder->mOrder.data();
+	const size_t*		col			=	builder->mCol.data();
+	const elem_t*		elem		=	builder->mElem.data();
+
+	for(size_t row=info->startRow;row<info->endRow;++row)
+	{
+		size_t		pos		=	builder->mRowStart[row];
+		size_t		end		=	builder->mRowStart[row+1];
+		size_t		out		=	pos;
+
+		while( pos < end )
+		{
+			size_t		curCol	=	col[order[pos]];
+			elem_t		sum		=	elem[order[pos]];
+
+			for(++pos;( pos < end ) && ( col[order[pos]] == curCol );++pos)
+			{
+				sum		+=	elem[order[pos]];
+			}
+
+			if( sum != 0 )
+			{
+				builder->mSortCol[out]		=	curCol;
+				builder->mSortElem[out]		=	sum;
+				out++;
+			}
+		}
+
+		builder->mRowCount[row]		=	out - builder->mRowStart[row];
+	}
+
+	return	0;
+}
+
+/**
+ * CSR 행렬 행 채우기
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixBuilder::threadBuildCSR	(	void*	pData	)
+{
+	RowInfo*			info		=	(RowInfo*)pData;
+	MatrixBuilder*		builder		=	info->builder;
+	MatrixCSR*			matrix		=	(MatrixCSR*)info->target;
+
+	for(size_t row=info->startRow;row<info->endRow;++row)
+	{
+		size_t		src		=	builder->mRowStart[row];
+		size_t		dst		=	matrix->mRowStart[row];
+
+		for(size_t cnt=0;cnt<builder->mRowCount[row];++cnt)
+		{
+			matrix->mColIdx[dst + cnt]	=	builder->mSortCol[src + cnt];
+			matrix->mValue[dst + cnt]	=	builder->mSortElem[src + cnt];
+		}
+	}
+
+	return	0;
+}
+
+/**
+ * 희소 행렬 행 채우기 (Array + Vector)
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixBuilder::threadBuildSparse	(	void*	pData	)
+{
+	RowInfo*			info		=	(RowInfo*)pData;
+	MatrixBuilder*		builder		=	info->builder;
+	SparseMatrix*		matrix		=	(SparseMatrix*)info->target;
+
+	for(size_t row=info->startRow;row<info->endRow;++row)
+	{
+		vector_node_t::row_t&	vec		=	matrix->mData[row].mVector;
+		size_t					src		=	builder->mRowStart[row];
+
+		vec.reserve(builder->mRowCount[row]);
+
+		for(size_t cnt=0;cnt<builder->mRowCount[row];++cnt)
+		{
+			vec.push_back(node_t(builder->mSortCol[src + cnt], builder->mSortElem[src + cnt]));
+		}
+	}
+
+	return	0;
+}
+
+/**
+ * 희소 행렬 행 채우기 (Array + Map)
+ * 열 순서로 정렬 되어 있으므로 맵 끝 위치를 힌트로 삽입한다.
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixBuilder::threadBuildSparse2	(	void*	pData	)
+{
+	RowInfo*			info		=	(RowInfo*)pData;
+	MatrixBuilder*		builder		=	info->builder;
+	SparseMatrix2*		matrix		=	(SparseMatrix2*)info->target;
+
+	for(size_t row=info->startRow;row<info->endRow;++row)
+	{
+		SparseMatrix2::map_t&	map		=	matrix->mData[row].mMap;
+		size_t						src		=	builder->mRowStart[row];
+
+		for(size_t cnt=0;cnt<builder->mRowCount[row];++cnt)
+		{
+			map.insert(map.end(), std::make_pair(builder->mSortCol[src + cnt], builder->mSortElem[src + cnt]));
+		}
+	}
+
+	return	0;
+}
+
+/**
+ * 행렬 행 채우기
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixBuilder::threadBuildMatrix	(	void*	pData	)
+{
+	RowInfo*			info		=	(RowInfo*)pData;
+	MatrixBuilder*		builder		=	info->builder;
+	Matrix*				matrix		=	(Matrix*)info->target;
+	size_t				colSize		=	builder->mColSize;
+
+	for(size_t row=info->startRow;row<info->endRow;++row)
+	{
+		elem_t*		data	=	matrix->mData + row * colSize;
+		size_t		src		=	builder->mRowStart[row];
+
+		memset(data, 0, sizeof(elem_t) * colSize);
+
+		for(size_t cnt=0;cnt<builder->mRowCount[row];++cnt)
+		{
+			data[builder->mSortCol[src + cnt]]	=	builder->mSortElem[src + cnt];
+		}
+	}
+
+	return	0;
+}
+
+};
@@ -0,0 +1,459 @@
+/*
+ * matrix_csc.cpp
+ *
+ *  Created on: 2015. 8. 26.
+ *      Author: asran
+ */
+
+#include "matrix_csc.h"
+#include "matrix_csr.h"
+#include "matrix_simd.h"
+#include "matrix_error.h"
+#include "thread_pool.h"
+
+namespace matrix
+{
+
+/**
+ * 생성자
+ */
+template<class T, class I>
+BasicMatrixCSC<T, I>::BasicMatrixCSC		(	void	)
+:mRowSize(0),
+mColSize(0),
+mColStart(NULL),
+mRowIdx(NULL),
+mValue(NULL)
+{
+}
+
+/**
+ * 생성자 (빈 행렬)
+ */
+template<class T, class I>
+BasicMatrixCSC<T, I>::BasicMatrixCSC		(	size_t		row,	///< 행 크기
+												size_t		col		///< 열 크기
+											)
+:mRowSize(0),
+mColSize(0),
+mColStart(NULL),
+mRowIdx(NULL),
+mValue(NULL)
+{
+	allocElems(row, col, 0);
+}
+
+/**
+ * 복사 생성자
+ */
+template<class T, class I>
+BasicMatrixCSC<T, I>::BasicMatrixCSC		(	const BasicMatrixCSC&		matrix		///< 복사 될 객체
+											)
+:mRowSize(0),
+mColSize(0),
+mColStart(NULL),
+mRowIdx(NULL),
+mValue(NULL)
+{
+	size_t		size	=	matrix.getSize();
+
+	allocElems(matrix.getRow(), matrix.getCol(), size);
+
+	memcpy(mColStart, matrix.mColStart, sizeof(index_t) * (mColSize + 1));
+
+	if( size != 0 )
+	{
+		memcpy(mRowIdx, matrix.mRowIdx, sizeof(index_t) * size);
+		memcpy(mValue, matrix.mValue, sizeof(elem_t) * size);
+	}
+}
+
+/**
+ * 이동 생성자
+ * 데이터를 복사하지 않고 가져오며, 원본은 빈 행렬이 된다.
+ */
+template<class T, class I>
+BasicMatrixCSC<T, I>::BasicMatrixCSC		(	BasicMatrixCSC&&			matrix		///< 이동 할 객체
+											)
+:mRowSize(0),
+mColSize(0),
+mColStart(NULL),
+mRowIdx(NULL),
+mValue(NULL)
+{
+	swap(matrix);
+}
+
+/**
+ * 생성자 (MatrixCSR 변환)
+ * 계수 정렬로 요소를 열 별로 옮기며, 각 열의 요소는 행 순서가 된다.
+ */
+template<class T, class I>
+BasicMatrixCSC<T, I>::BasicMatrixCSC		(	const BasicMatrixCSR<T, I>&	matrix		///< 변환 할 행렬
+											)
+:mRowSize(0),
+mColSize(0),
+mColStart(NULL),
+mRowIdx(NULL),
+mValue(NULL)
+{
+	allocElems(matrix.getRow(), matrix.getCol(), matrix.getSize());
+
+	transposeArrays	(	matrix.getRow(),
+						matrix.getCol(),
+						matrix.getRowStart(),
+						matrix.getColIdx(),
+						matrix.getValue(),
+						mColStart,
+						mRowIdx,
+						mValue,
+						true
+					);
+}
+
+/**
+ * 소멸자
+ */
+template<class T, class I>
+BasicMatrixCSC<T, I>::~BasicMatrixCSC		(	void	)
+{
+	freeElems();
+}
+
+/**
+ * 행렬 요소 값 참조
+ * 열의 요소는 행 순서로 정렬되어 있으므로 이진 탐색한다.
+ * @return		참조한 행렬 요소 값
+ */
+template<class T, class I>
+T		BasicMatrixCSC<T, I>::getElem		(	size_t		row,	///< 참조 할 행 위치
+												size_t		col		///< 참조 할 열 위치
+											) const
+{
+	chkBound(row, col);
+
+	elem_t				value	=	0;
+	const index_t*		start	=	mRowIdx + mColStart[col];
+	const index_t*		end		=	mRowIdx + mColStart[col+1];
+	const index_t*		pos		=	std::lower_bound(start, end, (index_t)row);
+
+	if( ( pos != end ) && ( *pos == row ) )
+	{
+		value	=	mValue[pos - mRowIdx];
+	}
+
+	return	value;
+}
+
+/**
+ * 전치 행렬 (MatrixCSR)
+ * 열 별 배열이 곧 전치 행렬의 행 별 배열이므로 재배치 없이 복사만 한다.
+ * @return		전치 행렬
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>	BasicMatrixCSC<T, I>::transpose		(	void	) const
+{
+	return	BasicMatrixCSR<T, I>(getCol(), getRow(), mColStart, mRowIdx, mValue);
+}
+
+/**
+ * 행렬 맞바꾸기
+ * 데이터를 복사하지 않고 두 행렬의 내용을 교환한다.
+ */
+template<class T, class I>
+void		BasicMatrixCSC<T, I>::swap		(	BasicMatrixCSC&		operand		///< 맞바꿀 행렬
+											)
+{
+	std::swap(mRowSize, operand.mRowSize);
+	std::swap(mColSize, operand.mColSize);
+	std::swap(mColStart, operand.mColStart);
+	std::swap(mRowIdx, operand.mRowIdx);
+	std::swap(mValue, operand.mValue);
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x)
+ * 열 별로 x 값 한 개를 곱해 y에 흩어 더한다.
+ */
+template<class T, class I>
+void		BasicMatrixCSC<T, I>::spmv		(	const elem_t	x[],	///< 입력 벡터 (열 크기)
+												elem_t			y[]		///< 결과 벡터 (행 크기)
+											) const
+{
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		y[row]	=	0;
+	}
+
+	for(size_t col=0;col<mColSize;++col)
+	{
+		elem_t		value	=	x[col];
+
+		for(size_t cnt=mColStart[col];cnt<mColStart[col+1];++cnt)
+		{
+			y[mRowIdx[cnt]]		+=	mValue[cnt] * value;
+		}
+	}
+}
+
+/**
+ * 전치 행렬 x 벡터 (y = A^T * x)
+ * 열 별 내적으로 계산하므로 전치 행렬을 만들지 않는다.
+ */
+template<class T, class I>
+void		BasicMatrixCSC<T, I>::tspmv		(	const elem_t	x[],	///< 입력 벡터 (행 크기)
+												elem_t			y[]		///< 결과 벡터 (열 크기)
+											) const
+{
+	for(size_t col=0;col<mColSize;++col)
+	{
+		elem_t		sum		=	0;
+
+		for(size_t cnt=mColStart[col];cnt<mColStart[col+1];++cnt)
+		{
+			sum		+=	mValue[cnt] * x[mRowIdx[cnt]];
+		}
+
+		y[col]	=	sum;
+	}
+}
+
+/**
+ * 압축 배열 전치 (CSR <-> CSC)
+ * row x col 행렬의 (start, idx, value) 배열을 전치 행렬의 배열로 옮긴다.
+ * 1. 쓰레드 별로 맡은 행의 열 별 요소 수를 센다.
+ * 2. 열 순서, 쓰레드 순서로 누적하여 결과 시작 위치와 쓰레드 별 기록 위치를 정한다.
+ * 3. 쓰레드 별로 맡은 행의 요소를 기록 위치에 옮긴다.
+ * 쓰레드는 행 순서로 나누므로 결과의 각 행 (입력의 열) 안에서 위치는 오름차순이 된다.
+ * 결과 배열은 호출하는 쪽에서 할당하며, outStart는 col + 1 개, outIdx / outValue는 요소 수만큼 필요하다.
+ * useThread가 false이거나 요소 수가 쓰레드 풀의 최소 작업 크기보다 작으면 호출한 쓰레드에서 바로 수행한다.
+ * @exception		메모리 할당 실패 시 에러 발생
+ */
+template<class T, class I>
+void		BasicMatrixCSC<T, I>::transposeArrays	(	size_t			row,		///< 입력 행 크기
+														size_t			col,		///< 입력 열 크기
+														const index_t	start[],	///< 입력 행 별 시작 위치 (row + 1 개)
+														const index_t	idx[],		///< 입력 열 위치
+														const elem_t	value[],	///< 입력 요소 값
+														index_t			outStart[],	///< 결과 행 별 시작 위치 (col + 1 개)
+														index_t			outIdx[],	///< 결과 열 위치
+														elem_t			outValue[],	///< 결과 요소 값
+														bool			useThread	///< 쓰레드 풀 사용 여부
+													)
+{
+	ThreadPool&				pool		=	ThreadPool::getInstance();
+	size_t					threadNum	=	1;
+	TransposeInfo			info		=	{row, col, start, idx, value, outIdx, outValue};
+	std::vector<FuncInfo>	funcInfo;
+	std::vector<void*>		args;
+	std::vector<index_t>	count;
+
+	if( ( useThread == true ) &&
+		( pool.isSerial(start[row]) == false ) )
+	{
+		threadNum	=	pool.getTaskNum(row);
+	}
+
+	try
+	{
+		funcInfo.resize(threadNum);
+		args.resize(threadNum);
+		count.assign(threadNum * col, 0);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	size_t		threadPerRow	=	row / threadNum;
+	size_t		rowMod			=	row % threadNum;
+
+	for(size_t num=0;num<threadNum;num++)
+	{
+		funcInfo[num].info			=	&info;
+		funcInfo[num].count			=	count.data() + num * col;
+		funcInfo[num].startRow		=	num * threadPerRow;
+		funcInfo[num].endRow		=	funcInfo[num].startRow + threadPerRow;
+
+		args[num]		=	&funcInfo[num];
+	}
+
+	funcInfo[threadNum-1].endRow	+=	rowMod;
+
+	// 1. 쓰레드 별 열 요소 수
+	if( threadNum == 1 )
+	{
+		threadCount(args[0]);
+	}
+	else
+	{
+		pool.execute	(	BasicMatrixCSC::threadCount,
+							&args[0],
+							NULL,
+							threadNum
+						);
+	}
+
+	// 2. 결과 시작 위치와 쓰레드 별 기록 위치
+	size_t		pos		=	0;
+
+	for(size_t cnt=0;cnt<col;++cnt)
+	{
+		outStart[cnt]	=	pos;
+
+		for(size_t num=0;num<threadNum;num++)
+		{
+			size_t		size	=	funcInfo[num].count[cnt];
+
+			funcInfo[num].count[cnt]	=	pos;
+			pos		+=	size;
+		}
+	}
+
+	outStart[col]	=	pos;
+
+	// 3. 요소 옮기기
+	if( threadNum == 1 )
+	{
+		threadScatter(args[0]);
+	}
+	else
+	{
+		pool.execute	(	BasicMatrixCSC::threadScatter,
+							&args[0],
+							NULL,
+							threadNum
+						);
+	}
+}
+
+/**
+ * 행렬 데이터 공간 할당
+ * 배열은 SIMD_ALIGN 경계에 맞춰 할당하며, 열 별 시작 위치는 0으로 초기화한다.
+ * @exception		메모리 할당 실패 또는 행 크기 / 요소 수가 위치 형식 범위를 넘을 경우 에러 발생
+ */
+template<class T, class I>
+void		BasicMatrixCSC<T, I>::allocElems		(	size_t		row,	///< 행 크기
+														size_t		col,	///< 열 크기
+														size_t		size	///< 요소 수
+													)
+{
+	if( row > std::numeric_limits<index_t>::max() )
+	{
+		throw matrix::ErrMsg::createErrMsg("행 크기가 위치 형식 범위를 넘습니다.");
+	}
+
+	if( size > std::numeric_limits<index_t>::max() )
+	{
+		throw matrix::ErrMsg::createErrMsg("요소 수가 위치 형식 범위를 넘습니다.");
+	}
+
+	freeElems();
+
+	try
+	{
+		mRowSize	=	row;
+		mColSize	=	col;
+		mColStart	=	(index_t*)SimdKernel::allocAligned(sizeof(index_t) * (col + 1));
+		mRowIdx		=	(index_t*)SimdKernel::allocAligned(sizeof(index_t) * size);
+		mValue		=	(elem_t*)SimdKernel::allocAligned(sizeof(elem_t) * size);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		freeElems();
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	memset(mColStart, 0, sizeof(index_t) * (col + 1));
+}
+
+/**
+ * 행렬 데이터 공간 할당 해제
+ */
+template<class T, class I>
+void		BasicMatrixCSC<T, I>::freeElems		(	void	)
+{
+	SimdKernel::freeAligned(mColStart);
+	SimdKernel::freeAligned(mRowIdx);
+	SimdKernel::freeAligned(mValue);
+
+	mRowSize	=	0;
+	mColSize	=	0;
+	mColStart	=	NULL;
+	mRowIdx		=	NULL;
+	mValue		=	NULL;
+}
+
+/**
+ * 행렬 요소 참조 범위 검사
+ * @exception		참조 범위 밖일 경우 예외 발생
+ */
+template<class T, class I>
+void		BasicMatrixCSC<T, I>::chkBound		(	size_t		row,	///< 참조 할 행 위치
+													size_t		col		///< 참조 할 열 위치
+												) const
+{
+	if( ( row >= mRowSize ) ||
+		( col >= mColSize ) )
+	{
+		throw	matrix::ErrMsg::createErrMsg("범위를 넘어서는 참조입니다.");
+	}
+}
+
+/**
+ * 지정한 범위의 행에 대한 열 별 요소 수 계산
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSC<T, I>::threadCount		(	void*	pData	)
+{
+	FuncInfo*				funcInfo	=	(FuncInfo*)pData;
+	const TransposeInfo&	info		=	*funcInfo->info;
+	index_t*				count		=	funcInfo->count;
+
+	for(size_t cnt=info.start[funcInfo->startRow];cnt<info.start[funcInfo->endRow];++cnt)
+	{
+		count[info.idx[cnt]]++;
+	}
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 행의 요소를 전치 위치로 옮김
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSC<T, I>::threadScatter		(	void*	pData	)
+{
+	FuncInfo*				funcInfo	=	(FuncInfo*)pData;
+	const TransposeInfo&	info		=	*funcInfo->info;
+	index_t*				pos			=	funcInfo->count;
+
+	for(size_t row=funcInfo->startRow;row<funcInfo->endRow;++row)
+	{
+		for(size_t cnt=info.start[row];cnt<info.start[row+1];++cnt)
+		{
+			index_t		dst		=	pos[info.idx[cnt]]++;
+
+			info.outIdx[dst]		=	(index_t)row;
+			info.outValue[dst]		=	info.value[cnt];
+		}
+	}
+
+	return	NULL;
+}
+
+/////////////////////////////
+// 요소 / 위치 형식 별 명시적 인스턴스
+
+template class	BasicMatrixCSC< float, uint32_t >;
+template class	BasicMatrixCSC< float, uint64_t >;
+template class	BasicMatrixCSC< double, uint32_t >;
+template class	BasicMatrixCSC< double, uint64_t >;
+template class	BasicMatrixCSC< std::complex<float>, uint32_t >;
+template class	BasicMatrixCSC< std::complex<float>, uint64_t >;
+template class	BasicMatrixCSC< std::complex<double>, uint32_t >;
+template class	BasicMatrixCSC< std::complex<double>, uint64_t >;
+
+};
@@ -6,44 +6,49 @@
  */
 
 #include "matrix_csr.h"
+#include "matrix.h"
+#include "sparse_matrix.h"
+#include "sparse_matrix2.h"
 #include "matrix_error.h"
+#include "thread_pool.h"
+#include "matrix_pcg.h"
+#include "matrix_file.h"
+#include "matrix_sell.h"
+#include "matrix_csc.h"
 #include <math.h>
 
-#define	THREAD_FUNC_THRESHOLD	(1)
-#define	THREAD_NUM					(4)
-
 namespace matrix
 {
 
-typedef	void*(*Operation)(void*);
-
-struct		FuncInfo
-{
-	MatrixCSR::OpInfo		opInfo;
-	Operation				func;
-	size_t					startCol;
-	size_t					endCol;
-};
-
 /**
  * 생성자
  */
-MatrixCSR::MatrixCSR			(	void	)
+template<class T, class I>
+BasicMatrixCSR<T, I>::BasicMatrixCSR			(	void	)
 :mColSize(0),
 mRowSize(0),
-mRowStart(NULL)
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
 {
 }
 
 /**
  * 생성자
  */
-MatrixCSR::MatrixCSR			(	size_t		row,	///< 행 크기
+template<class T, class I>
+BasicMatrixCSR<T, I>::BasicMatrixCSR			(	size_t		row,	///< 행 크기
 									size_t		col		///< 열 크기
 								)
 :mColSize(0),
 mRowSize(0),
-mRowStart(NULL)
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
 {
 	allocElems(row, col);
 }
@@ -51,20 +56,243 @@ mRowStart(NULL)
 /**
  * 복사 생성자
  */
-MatrixCSR::MatrixCSR			(	const MatrixCSR&		matrix		///< 복사 될 객체
+template<class T, class I>
+BasicMatrixCSR<T, I>::BasicMatrixCSR			(	const BasicMatrixCSR&		matrix		///< 복사 될 객체
 								)
 :mColSize(0),
 mRowSize(0),
-mRowStart(NULL)
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
 {
 	allocElems(matrix.getRow(), matrix.getCol());
 	copyElems(matrix);
 }
 
+/**
+ * 이동 생성자
+ * 데이터를 복사하지 않고 가져오며, 원본은 빈 행렬이 된다.
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>::BasicMatrixCSR			(	BasicMatrixCSR&&				matrix		///< 이동 할 객체
+								)
+:mColSize(0),
+mRowSize(0),
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
+{
+	swap(matrix);
+}
+
+/**
+ * 생성자 (CSR 배열 복사)
+ * 외부 코드의 CSR 배열을 복사하여 행렬을 만든다.
+ * @exception		메모리 할당 실패 또는 배열 형식이 올바르지 않을 경우 에러 발생
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>::BasicMatrixCSR			(	size_t			row,		///< 행 크기
+									size_t			col,		///< 열 크기
+									const index_t	rowStart[],	///< 행 별 시작 위치 (row + 1 개)
+									const index_t	colIdx[],	///< 요소 열 위치
+									const elem_t	value[]		///< 요소 값
+								)
+:mColSize(0),
+mRowSize(0),
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
+{
+	allocElems(row, col);
+
+	if( rowStart[0] != 0 )
+	{
+		freeElems();
+		throw matrix::ErrMsg::createErrMsg("CSR 배열 형식이 올바르지 않습니다.");
+	}
+
+	for(size_t cnt=0;cnt<row;++cnt)
+	{
+		if( rowStart[cnt] > rowStart[cnt+1] )
+		{
+			freeElems();
+			throw matrix::ErrMsg::createErrMsg("CSR 배열 형식이 올바르지 않습니다.");
+		}
+	}
+
+	size_t		size	=	rowStart[row];
+
+	for(size_t cnt=0;cnt<size;++cnt)
+	{
+		if( colIdx[cnt] >= col )
+		{
+			freeElems();
+			throw matrix::ErrMsg::createErrMsg("CSR 배열 형식이 올바르지 않습니다.");
+		}
+	}
+
+	reserveElems(size);
+
+	memcpy(mRowStart, rowStart, sizeof(index_t) * (row + 1));
+
+	placeElems();
+
+	if( size != 0 )
+	{
+		memcpy(mColIdx, colIdx, sizeof(index_t) * size);
+		memcpy(mValue, value, sizeof(elem_t) * size);
+	}
+}
+
+/**
+ * 생성자 (Matrix 변환)
+ * 0이 아닌 요소만 저장한다.
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>::BasicMatrixCSR			(	const BasicMatrix<T>&		matrix		///< 변환 할 행렬
+								)
+:mColSize(0),
+mRowSize(0),
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
+{
+	allocElems(matrix.getRow(), matrix.getCol());
+
+	const elem_t*	data	=	matrix.mData;
+	size_t			size	=	0;
+
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		for(size_t col=0;col<mColSize;++col)
+		{
+			if( data[row * mColSize + col] != elem_t(0) )
+			{
+				size++;
+			}
+		}
+
+		if( size > std::numeric_limits<index_t>::max() )
+		{
+			freeElems();
+			throw matrix::ErrMsg::createErrMsg("요소 수가 위치 형식 범위를 넘습니다.");
+		}
+
+		mRowStart[row+1]	=	size;
+	}
+
+	reserveElems(size);
+	placeElems();
+
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		size_t		pos		=	mRowStart[row];
+
+		for(size_t col=0;col<mColSize;++col)
+		{
+			if( data[row * mColSize + col] != elem_t(0) )
+			{
+				mColIdx[pos]	=	col;
+				mValue[pos]		=	data[row * mColSize + col];
+				pos++;
+			}
+		}
+	}
+}
+
+/**
+ * 생성자 (SparseMatrix 변환)
+ * 각 행은 열 순서로 정렬 된 상태로 복사한다.
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>::BasicMatrixCSR			(	const BasicSparseMatrix<T, I>&	matrix		///< 변환 할 행렬
+								)
+:mColSize(0),
+mRowSize(0),
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
+{
+	allocElems(matrix.getRow(), matrix.getCol());
+
+	matrix.chkSorted();
+
+	size_t		size	=	0;
+
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		size	+=	matrix.mData[row].mVector.size();
+
+		if( size > std::numeric_limits<index_t>::max() )
+		{
+			freeElems();
+			throw matrix::ErrMsg::createErrMsg("요소 수가 위치 형식 범위를 넘습니다.");
+		}
+
+		mRowStart[row+1]	=	size;
+	}
+
+	reserveElems(size);
+	placeElems();
+
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		const typename BasicSparseMatrix<T, I>::row_t&	vec		=	matrix.mData[row].mVector;
+		size_t		pos		=	mRowStart[row];
+
+		for(size_t cnt=0;cnt<vec.size();++cnt)
+		{
+			mColIdx[pos + cnt]	=	vec[cnt].mCol;
+			mValue[pos + cnt]	=	vec[cnt].mElem;
+		}
+	}
+}
+
+/**
+ * 생성자 (MatrixCSC 변환)
+ * 계수 정렬로 요소를 행 별로 옮기며, 각 행의 요소는 열 순서가 된다.
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>::BasicMatrixCSR			(	const BasicMatrixCSC<T, I>&		matrix		///< 변환 할 행렬
+								)
+:mColSize(0),
+mRowSize(0),
+mRowStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mCapacity(0),
+mMapping(NULL)
+{
+	allocElems(matrix.getRow(), matrix.getCol());
+	reserveElems(matrix.getSize());
+
+	BasicMatrixCSC<T, I>::transposeArrays	(	matrix.getCol(),
+												matrix.getRow(),
+												matrix.getColStart(),
+												matrix.getRowIdx(),
+												matrix.getValue(),
+												mRowStart,
+												mColIdx,
+												mValue,
+												true
+											);
+}
+
 /**
  * 소멸자
  */
-MatrixCSR::~MatrixCSR		(	void	)
+template<class T, class I>
+BasicMatrixCSR<T, I>::~BasicMatrixCSR		(	void	)
 {
 	freeElems();
 }
@@ -73,7 +301,8 @@ MatrixCSR::~MatrixCSR		(	void	)
  * 행렬 요소 값 참조
  * @return		참조한 행렬 요소 값
  */
-elem_t		MatrixCSR::getElem		(	size_t		row,	///< 참조 할 행 위치
+template<class T, class I>
+T		BasicMatrixCSR<T, I>::getElem		(	size_t		row,	///< 참조 할 행 위치
 										size_t		col		///< 참조 할 열 위치
 									) const
 {
@@ -85,9 +314,9 @@ elem_t		MatrixCSR::getElem		(	size_t		row,	///< 참조 할 행 위치
 
 	for(size_t cnt=start;cnt<end;cnt++)
 	{
-		if( mData[cnt].mCol == col )
+		if( mColIdx[cnt] == col )
 		{
-			value	=	mData[cnt].mElem;
+			value	=	mValue[cnt];
 			break;
 		}
 	}
@@ -98,7 +327,8 @@ elem_t		MatrixCSR::getElem		(	size_t		row,	///< 참조 할 행 위치
 /**
  * 행렬 요소 값 설정
  */
-void		MatrixCSR::setElem		(	size_t		row,	///< 설정 할 행 위치
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::setElem		(	size_t		row,	///< 설정 할 행 위치
 										size_t		col,	///< 설정 할 열 위치
 										elem_t		elem	///< 설정 할 요소 값
 									)
@@ -106,22 +336,35 @@ void		MatrixCSR::setElem		(	size_t		row,	///< 설정 할 행 위치
 	//chkBound(col, row);
 
 	bool	found	=	false;
+
+	// 파일에 매핑 된 데이터는 수정 전에 복사한다.
+	detach();
+
 	size_t	start	=	mRowStart[row];
 	size_t	end		=	mRowStart[row+1];
 
 	for(size_t cnt=start;cnt<end;++cnt)
 	{
-		if( mData[cnt].mCol == col )
+		if( mColIdx[cnt] == col )
 		{
-			mData[cnt].mElem	=	elem;
+			mValue[cnt]	=	elem;
 			found	=	true;
 		}
 	}
 
-	if( found == false && elem != 0 )
+	if( found == false && elem != elem_t(0) )
 	{
-		elem_vector_itor	itor	=	mData.begin() + end;
-		mData.insert(itor, node_t(col, elem));
+		size_t	size	=	getSize();
+
+		if( size == mCapacity )
+		{
+			reserveElems( ( mCapacity < 16 ) ? 16 : mCapacity * 2 );
+		}
+
+		memmove(mColIdx + end + 1, mColIdx + end, sizeof(index_t) * (size - end));
+		memmove(mValue + end + 1, mValue + end, sizeof(elem_t) * (size - end));
+		mColIdx[end]	=	col;
+		mValue[end]		=	elem;
 
 		for(size_t cnt=row+1;cnt<mRowSize+1;++cnt)
 		{
@@ -132,41 +375,45 @@ void		MatrixCSR::setElem		(	size_t		row,	///< 설정 할 행 위치
 
 /**
  * 행렬 덧셈
+ * 선형 결합 (this + operand)으로 계산하므로 결과 행은 열 순서로 정렬 된다.
  * @return		행렬 덧셈 결과
  */
-MatrixCSR		MatrixCSR::add		(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::add		(	const BasicMatrixCSR&	operand	///< 피연산자
 										) const
 {
-	chkSameSize(operand);
+	const elem_t				coef[2]		=	{1, 1};
+	const BasicMatrixCSR* const	terms[2]	=	{this, &operand};
+	BasicMatrixCSR				result;
 
-	MatrixCSR				result		=	MatrixCSR(getRow(), getCol());
-	const std::vector<node_t>&	vec			=	operand.mData;
+	result.combineElems(2, coef, terms, false);
 
-	result.equal(*this);
+	return	result;
+}
 
-	for(size_t row=0;row<operand.getRow();++row)
-	{
-		size_t	start	=	operand.mRowStart[row];
-		size_t	end		=	operand.mRowStart[row+1];
+/**
+ * 쓰레드 행렬 덧셈
+ * @return		행렬 덧셈 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::padd		(	const BasicMatrixCSR&	operand	///< 피연산자
+										) const
+{
+	const elem_t				coef[2]		=	{1, 1};
+	const BasicMatrixCSR* const	terms[2]	=	{this, &operand};
+	BasicMatrixCSR				result;
 
-		for(size_t cnt=start;cnt<end;++cnt)
-		{
-			result.setElem	(	row,
-									vec[cnt].mCol,
-									result.getElem(row, vec[cnt].mCol) + vec[cnt].mElem
-								);
-		}
-	}
+	result.combineElems(2, coef, terms, true);
 
 	return	result;
 }
 
-//MatrixCSR		MatrixCSR::add		(	const MatrixCSR&	operand	///< 피연산자
+//BasicMatrixCSR		BasicMatrixCSR::add		(	const BasicMatrixCSR&	operand	///< 피연산자
 //										) const
 //{
 //	chkSameSize(operand);
 //
-//	MatrixCSR				result		=	MatrixCSR(getRow(), getCol());
+//	BasicMatrixCSR				result		=	BasicMatrixCSR(getRow(), getCol());
 //	const std::vector<node_t>&	vec			=	operand.mData;
 //
 //	result.mData.reserve(mData.size());
@@ -179,8 +426,8 @@ MatrixCSR		MatrixCSR::add		(	const MatrixCSR&	operand	///< 피연산자
 //		for(size_t cnt=start;cnt<end;++cnt)
 //		{
 //			result.setElem	(	row,
-//								mData[cnt].mCol,
-//								mData[cnt].mElem
+//								mColIdx[cnt],
+//								mValue[cnt]
 //							);
 //		}
 //
@@ -201,41 +448,45 @@ MatrixCSR		MatrixCSR::add		(	const MatrixCSR&	operand	///< 피연산자
 
 /**
  * 행렬 뺄셈
+ * 선형 결합 (this - operand)으로 계산하므로 결과 행은 열 순서로 정렬 된다.
  * @return		행렬 뺄셈 결과
  */
-MatrixCSR		MatrixCSR::sub		(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::sub		(	const BasicMatrixCSR&	operand	///< 피연산자
 									) const
 {
-	chkSameSize(operand);
+	const elem_t				coef[2]		=	{1, -1};
+	const BasicMatrixCSR* const	terms[2]	=	{this, &operand};
+	BasicMatrixCSR				result;
 
-	MatrixCSR				result		=	MatrixCSR(getRow(), getCol());
-	const std::vector<node_t>&	vec			=	operand.mData;
+	result.combineElems(2, coef, terms, false);
 
-	result.equal(*this);
+	return	result;
+}
 
-	for(size_t row=0;row<operand.getRow();++row)
-	{
-		size_t	start	=	operand.mRowStart[row];
-		size_t	end		=	operand.mRowStart[row+1];
+/**
+ * 쓰레드 행렬 뺄셈
+ * @return		행렬 뺄셈 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::psub		(	const BasicMatrixCSR&	operand	///< 피연산자
+									) const
+{
+	const elem_t				coef[2]		=	{1, -1};
+	const BasicMatrixCSR* const	terms[2]	=	{this, &operand};
+	BasicMatrixCSR				result;
 
-		for(size_t cnt=start;cnt<end;++cnt)
-		{
-			result.setElem	(	row,
-									vec[cnt].mCol,
-									result.getElem(row, vec[cnt].mCol) - vec[cnt].mElem
-								);
-		}
-	}
+	result.combineElems(2, coef, terms, true);
 
 	return	result;
 }
 
-//MatrixCSR		MatrixCSR::sub		(	const MatrixCSR&	operand	///< 피연산자
+//BasicMatrixCSR		BasicMatrixCSR::sub		(	const BasicMatrixCSR&	operand	///< 피연산자
 //									) const
 //{
 //	chkSameSize(operand);
 //
-//	MatrixCSR				result		=	MatrixCSR(getRow(), getCol());
+//	BasicMatrixCSR				result		=	BasicMatrixCSR(getRow(), getCol());
 //	const std::vector<node_t>&	vec			=	operand.mData;
 //
 //	result.mData.reserve(mData.size());
@@ -248,8 +499,8 @@ MatrixCSR		MatrixCSR::sub		(	const MatrixCSR&	operand	///< 피연산자
 //		for(size_t cnt=start;cnt<end;++cnt)
 //		{
 //			result.setElem	(	row,
-//								mData[cnt].mCol,
-//								mData[cnt].mElem
+//								mColIdx[cnt],
+//								mValue[cnt]
 //							);
 //		}
 //
@@ -272,36 +523,83 @@ MatrixCSR		MatrixCSR::sub		(	const MatrixCSR&	operand	///< 피연산자
  * 행렬 곱셈
  * @return		행렬 곱셈 결과
  */
-MatrixCSR		MatrixCSR::multiply	(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::multiply	(	const BasicMatrixCSR&	operand	///< 피연산자
+										) const
+{
+	return	multiplyElems(operand, false);
+}
+
+/**
+ * 쓰레드 행렬 곱셈
+ * @return		행렬 곱셈 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::pmultiply	(	const BasicMatrixCSR&	operand	///< 피연산자
 										) const
 {
-	if( ( getRow() != operand.getCol() ) &&
-		( getCol() != operand.getRow() ) )
+	return	multiplyElems(operand, true);
+}
+
+/**
+ * 행렬 곱셈 계산
+ * 결과 행 별 요소 수를 먼저 계산하여 결과 공간을 한 번에 할당한 후(symbolic),
+ * 쓰레드 별 누적 배열을 사용하여 각 행의 값을 계산한다(numeric).
+ * @return		행렬 곱셈 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::multiplyElems	(	const BasicMatrixCSR&	operand,	///< 피연산자
+														bool					useThread	///< 쓰레드 풀 사용 여부
+													) const
+{
+	if( getCol() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	MatrixCSR				result		=	MatrixCSR(getRow(), operand.getCol());
-	const std::vector<node_t>&	vec			=	operand.mData;
+	BasicMatrixCSR			result		=	BasicMatrixCSR(getRow(), operand.getCol());
+	std::vector<size_t>	rowSize(getRow(), 0);
+	OpInfo				info;
+
+	info.operandA	=	this;
+	info.operandB	=	&operand;
+	info.result		=	&result;
+	info.rowSize	=	rowSize.data();
 
+	// 1. 결과 행 별 요소 수 계산
+	doThreadFunc(FUNC_MULTIPLY_SYMBOLIC, info, useThread, getSize());
+
+	result.mRowStart[0]	=	0;
 	for(size_t row=0;row<getRow();++row)
 	{
-		size_t	start	=	mRowStart[row];
-		size_t	end		=	mRowStart[row+1];
+		result.mRowStart[row+1]	=	result.mRowStart[row] + rowSize[row];
+	}
 
-		for(size_t cnt=start;cnt<end;++cnt)
+	result.reserveElems(result.mRowStart[getRow()]);
+
+	// 2. 결과 값 계산
+	doThreadFunc(FUNC_MULTIPLY_NUMERIC, info, useThread, getSize());
+
+	// 계산 결과가 0이 되어 제외 된 요소가 있으면 빈 공간 제거
+	if( std::accumulate(rowSize.begin(), rowSize.end(), (size_t)0) != result.getSize() )
+	{
+		size_t		pos		=	0;
+
+		for(size_t row=0;row<getRow();++row)
 		{
-			size_t	start2	=	operand.mRowStart[mData[cnt].mCol];
-			size_t	end2	=	operand.mRowStart[mData[cnt].mCol+1];
+			size_t		start	=	result.mRowStart[row];
 
-			for(size_t cnt2=start2;cnt2<end2;++cnt2)
+			result.mRowStart[row]	=	pos;
+
+			for(size_t cnt=0;cnt<rowSize[row];++cnt)
 			{
-				result.setElem	(	row,
-									vec[cnt2].mCol,
-									result.getElem(row, vec[cnt2].mCol) + (mData[cnt].mElem * vec[cnt2].mElem)
-								);
+				result.mColIdx[pos]		=	result.mColIdx[start + cnt];
+				result.mValue[pos]		=	result.mValue[start + cnt];
+				pos++;
 			}
 		}
+
+		result.mRowStart[getRow()]	=	pos;
 	}
 
 	return	result;
@@ -309,135 +607,177 @@ MatrixCSR		MatrixCSR::multiply	(	const MatrixCSR&	operand	///< 피연산자
 
 
 /**
- * 행렬 곱셈
+ * 행렬 x 단일 값
  * @return		행렬 곱셈 결과
  */
-MatrixCSR		MatrixCSR::multiply	(	elem_t		operand	///< 피연산자
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::multiply	(	elem_t		operand	///< 피연산자
 										) const
 {
-	MatrixCSR	result		=	MatrixCSR(getRow(), getCol());
+	return	scaleElems(operand, false);
+}
 
-	for(size_t row=0;row<getRow();++row)
-	{
-		size_t		start	=	mRowStart[row];
-		size_t		end		=	mRowStart[row+1];
+/**
+ * 쓰레드 행렬 x 단일 값
+ * @return		행렬 곱셈 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::pmultiply	(	elem_t		operand	///< 피연산자
+										) const
+{
+	return	scaleElems(operand, true);
+}
 
-		for(size_t cnt=start;cnt!=end;++cnt)
-		{
-			result.setElem	(	row,
-								mData[cnt].mCol,
-								mData[cnt].mElem * operand
-							);
-		}
+/**
+ * 행렬 x 단일 값 계산
+ * 요소 위치는 그대로 복사하고 값만 곱하며, 0을 곱하면 요소가 없는 행렬이 된다.
+ * @return		행렬 곱셈 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::scaleElems	(	elem_t		operand,	///< 피연산자
+														bool		useThread	///< 쓰레드 풀 사용 여부
+													) const
+{
+	BasicMatrixCSR	result		=	BasicMatrixCSR(getRow(), getCol());
+
+	if( operand == elem_t(0) )
+	{
+		return	result;
 	}
 
+	OpInfo			info;
+
+	result.reserveElems(getSize());
+	memcpy(result.mRowStart, mRowStart, sizeof(index_t) * (getRow() + 1));
+
+	info.operandA		=	this;
+	info.elemOperandB	=	operand;
+	info.result			=	&result;
+
+	doThreadFunc(FUNC_ELEM_MUL, info, useThread, getSize());
+
 	return	result;
 }
 
-MatrixCSR		MatrixCSR::transpose	(	void	) const
+/**
+ * 전치 행렬
+ * @return		전치 행렬
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::transpose	(	void	) const
+{
+	return	transposeElems(false);
+}
+
+/**
+ * 쓰레드 전치 행렬
+ * @return		전치 행렬
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::ptranspose	(	void	) const
 {
-	MatrixCSR	result		=	MatrixCSR(getCol(), getRow());
+	return	transposeElems(true);
+}
 
-	for(size_t row=0;row<getRow();++row)
-	{
-		size_t		start	=	mRowStart[row];
-		size_t		end		=	mRowStart[row+1];
+/**
+ * 전치 행렬 계산
+ * 계수 정렬로 요소를 열 별로 옮겨 O(요소 수)에 만든다.
+ * @return		전치 행렬
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::transposeElems	(	bool		useThread	///< 쓰레드 풀 사용 여부
+															) const
+{
+	BasicMatrixCSR	result		=	BasicMatrixCSR(getCol(), getRow());
 
-		for(size_t cnt=start;cnt!=end;++cnt)
-		{
-			result.setElem	(	mData[cnt].mCol,
-									row,
-									mData[cnt].mElem
-								);
-		}
-	}
+	result.reserveElems(getSize());
+
+	BasicMatrixCSC<T, I>::transposeArrays	(	getRow(),
+												getCol(),
+												mRowStart,
+												mColIdx,
+												mValue,
+												result.mRowStart,
+												result.mColIdx,
+												result.mValue,
+												useThread
+											);
 
 	return	result;
 }
 
 /**
- * 전치 행렬 변환 후 곱셈
+ * 뒤 행렬 전치 변환 후 앞 행렬 곱셈 (A * B^T)
+ * 뒤 행렬의 열 접근 형식 (전치 행렬)을 계수 정렬로 만든 후 행렬 곱셈을 한다.
  * @return		행렬 곱셈 결과
  */
-MatrixCSR		MatrixCSR::tmultiply		(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::tmultiply		(	const BasicMatrixCSR&	operand	///< 피연산자
 											) const
 {
-	if( ( getRow() != operand.getRow() ) &&
-		( getCol() != operand.getCol() ) )
+	if( getCol() != operand.getCol() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	MatrixCSR				result		=	MatrixCSR(getRow(), operand.getRow());
-	const std::vector<node_t>&	vec			=	operand.mData;
+	return	multiplyElems(operand.transposeElems(false), false);
+}
 
-	for(size_t row=0;row<getRow();++row)
+/**
+ * 쓰레드 뒤 행렬 전치 변환 후 앞 행렬 곱셈 (A * B^T)
+ * @return		행렬 곱셈 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::ptmultiply	(	const BasicMatrixCSR&	operand	///< 피연산자
+											) const
+{
+	if( getCol() != operand.getCol() )
 	{
-		size_t		start	=	mRowStart[row];
-		size_t		end		=	mRowStart[row+1];
-
-		for(size_t cnt=start;cnt!=end;++cnt)
-		{
-			size_t		start2	=	operand.mRowStart[row];
-			size_t		end2	=	operand.mRowStart[row+1];
-
-			for(size_t cnt2=start2;cnt2!=end2;++cnt2)
-			{
-				result.setElem	(	mData[cnt].mCol,
-									vec[cnt2].mCol,
-									result.getElem(mData[cnt].mCol, vec[cnt2].mCol) + (mData[cnt].mElem * vec[cnt2].mElem)
-								);
-			}
-		}
+		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	return	result;
+	return	multiplyElems(operand.transposeElems(true), true);
 }
 
 /**
- * 전치 행렬 변환 후 곱셈
+ * 앞 행렬 전치 변환 후 뒤 행렬 곱셈 (A^T * B)
+ * 앞 행렬의 열 접근 형식 (전치 행렬)을 계수 정렬로 만든 후 행렬 곱셈을 한다.
  * @return		행렬 곱셈 결과
  */
-MatrixCSR		MatrixCSR::stmultiply	(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::stmultiply	(	const BasicMatrixCSR&	operand	///< 피연산자
 											) const
 {
-	if( ( getRow() != operand.getRow() ) &&
-		( getCol() != operand.getCol() ) )
+	if( getRow() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	MatrixCSR				result		=	MatrixCSR(getCol(), operand.getCol());
-	const std::vector<node_t>&	vec			=	operand.mData;
+	return	transposeElems(false).multiplyElems(operand, false);
+}
 
-	for(size_t row=0;row<getRow();++row)
+/**
+ * 쓰레드 앞 행렬 전치 변환 후 뒤 행렬 곱셈 (A^T * B)
+ * @return		행렬 곱셈 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>		BasicMatrixCSR<T, I>::pstmultiply	(	const BasicMatrixCSR&	operand	///< 피연산자
+											) const
+{
+	if( getRow() != operand.getRow() )
 	{
-		size_t		start	=	mRowStart[row];
-		size_t		end		=	mRowStart[row+1];
-
-		for(size_t cnt=start;cnt!=end;++cnt)
-		{
-			size_t		start2	=	operand.mRowStart[row];
-			size_t		end2	=	operand.mRowStart[row+1];
-
-			for(size_t cnt2=start2;cnt2!=end2;++cnt2)
-			{
-				result.setElem	(	mData[cnt].mCol,
-									vec[cnt2].mCol,
-									result.getElem(mData[cnt].mCol, vec[cnt2].mCol) + (mData[cnt].mElem * vec[cnt2].mElem)
-								);
-			}
-		}
+		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	return	result;
+	return	transposeElems(true).multiplyElems(operand, true);
 }
 
 /**
  * 행렬 대입
  * @return		대입 할 행렬
  */
-const MatrixCSR&		MatrixCSR::equal		(	const MatrixCSR&	operand	///< 피연산자
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::equal		(	const BasicMatrixCSR&	operand	///< 피연산자
 												)
 {
 	try
@@ -456,68 +796,422 @@ const MatrixCSR&		MatrixCSR::equal		(	const MatrixCSR&	operand	///< 피연산자
 }
 
 /**
- * 행렬 비교 연산
- * @return		두 행렬이 일치하면 true, 비 일치하면 false
+ * 쓰레드 행렬 대입
+ * @return		대입 할 행렬
  */
-bool			MatrixCSR::compare			(	const MatrixCSR&	operand
-												) const
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::pequal		(	const BasicMatrixCSR&	operand	///< 피연산자
+												)
 {
-	bool	ret		=	true;
-
-	if( getSize() == operand.getSize() )
+	try
 	{
-		for(size_t row=0;row<getRow();++row)
-		{
-			size_t	start	=	mRowStart[row];
-			size_t	end		=	mRowStart[row+1];
+		chkSameSize(operand);
+		pcopyElems(operand);
+	}
+	catch( ErrMsg*	)
+	{
+		freeElems();
+		allocElems(operand.getRow(), operand.getCol());
+		pcopyElems(operand);
+	}
+
+	return	*this;
+}
+
+/**
+ * 행렬 데이터 맞바꾸기
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::swap		(	BasicMatrixCSR&		operand		///< 맞바꿀 행렬
+								)
+{
+	std::swap(mColSize, operand.mColSize);
+	std::swap(mRowSize, operand.mRowSize);
+	std::swap(mRowStart, operand.mRowStart);
+	std::swap(mColIdx, operand.mColIdx);
+	std::swap(mValue, operand.mValue);
+	std::swap(mCapacity, operand.mCapacity);
+	std::swap(mMapping, operand.mMapping);
+}
+
+/**
+ * 행렬 x 단일 값 덧셈 (this = this + alpha * operand)
+ * 이미 있는 위치의 요소는 그 자리에서 갱신하고, 새 요소가 생긴 경우에만
+ * 요소 배열을 늘린 후 뒤 행부터 옮기며 새 요소를 행 끝에 붙인다.
+ * @return		연산 결과
+ * @exception		행렬 크기가 다르거나 메모리 할당 실패 시 예외 발생
+ */
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::axpy		(	elem_t				alpha,		///< 피연산자 계수
+												const BasicMatrixCSR&	operand		///< 피연산자
+											)
+{
+	chkSameSize(operand);
+
+	if( ( alpha == elem_t(0) ) ||
+		( operand.getSize() == 0 ) )
+	{
+		return	*this;
+	}
+
+	detach();
+
+	std::vector<size_t>		marker;		// 열 별 현재 행 요소 위치
+	std::vector<size_t>		addNum;		// 행 별 새 요소 수
+
+	try
+	{
+		marker.assign(getCol(), (size_t)-1);
+		addNum.assign(getRow(), 0);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	size_t		total	=	0;
+
+	// 1. 같은 위치의 요소를 갱신하고, 행 별 새 요소 수를 센다.
+	for(size_t row=0;row<getRow();++row)
+	{
+		size_t		start	=	mRowStart[row];
+		size_t		end		=	mRowStart[row+1];
+
+		for(size_t cnt=start;cnt<end;++cnt)
+		{
+			marker[mColIdx[cnt]]	=	cnt;
+		}
+
+		for(size_t cnt=operand.mRowStart[row];cnt<operand.mRowStart[row+1];++cnt)
+		{
+			size_t		pos		=	marker[operand.mColIdx[cnt]];
+			elem_t		val		=	alpha * operand.mValue[cnt];
+
+			if( ( pos >= start ) &&
+				( pos < end ) )
+			{
+				mValue[pos]	+=	val;
+			}
+			else if( val != elem_t(0) )
+			{
+				addNum[row]++;
+			}
+		}
+
+		total	+=	addNum[row];
+	}
+
+	if( total == 0 )
+	{
+		return	*this;
+	}
+
+	// 2. 뒤 행부터 새 위치로 옮기고 새 요소를 행 끝에 붙인다.
+	reserveElems(getSize() + total);
+
+	marker.assign(getCol(), (size_t)-1);
+
+	size_t		shift	=	total;
+
+	for(size_t row=getRow();row-->0;)
+	{
+		size_t		before	=	shift - addNum[row];
+		size_t		start	=	mRowStart[row] + before;
+		size_t		end		=	mRowStart[row+1] + before;
+		size_t		pos		=	end;
+
+		if( before != 0 )
+		{
+			memmove(&mColIdx[start], &mColIdx[mRowStart[row]], sizeof(index_t) * (end - start));
+			memmove(&mValue[start], &mValue[mRowStart[row]], sizeof(elem_t) * (end - start));
+		}
 
+		if( addNum[row] != 0 )
+		{
 			for(size_t cnt=start;cnt<end;++cnt)
 			{
-				elem_t	val		=	operand.getElem(row, mData[cnt].mCol);
-				if( mData[cnt].mElem != val )
+				marker[mColIdx[cnt]]	=	cnt;
+			}
+
+			for(size_t cnt=operand.mRowStart[row];cnt<operand.mRowStart[row+1];++cnt)
+			{
+				size_t		col		=	operand.mColIdx[cnt];
+				elem_t		val		=	alpha * operand.mValue[cnt];
+
+				if( ( ( marker[col] < start ) || ( marker[col] >= end ) ) &&
+					( val != elem_t(0) ) )
 				{
-					ret		=	false;
-					break;
+					mColIdx[pos]	=	col;
+					mValue[pos]		=	val;
+					pos++;
 				}
 			}
+		}
+
+		mRowStart[row+1]	=	pos;
+		shift				=	before;
+	}
+
+	return	*this;
+}
+
+/**
+ * 행렬 x 단일 값 (this = alpha * this)
+ * @return		연산 결과
+ */
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::scale		(	elem_t		alpha	///< 곱할 값
+												)
+{
+	detach();
+
+	if( alpha == elem_t(0) )
+	{
+		// 요소 배열은 그대로 두고 모든 행을 비운다.
+		memset(mRowStart, 0, sizeof(index_t) * (getRow() + 1));
+	}
+	else
+	{
+		SimdKernel::scale(alpha, mValue, mValue, getSize());
+	}
+
+	return	*this;
+}
+
+/**
+ * 행렬 x 단일 값 후 덧셈 (this = alpha * this + operand)
+ * @return		연산 결과
+ */
+template<class T, class I>
+const BasicMatrixCSR<T, I>&		BasicMatrixCSR<T, I>::scale_add	(	elem_t				alpha,		///< 자신에 곱할 값
+													const BasicMatrixCSR&	operand		///< 피연산자
+												)
+{
+	chkSameSize(operand);
+
+	scale(alpha);
+
+	return	axpy(1, operand);
+}
+
+/**
+ * 선형 결합 (this = coef[0] * operand[0] + ... + coef[num-1] * operand[num-1])
+ * 행 별 결과 요소 수를 먼저 계산하여 한 번에 할당한 후, 모든 항을 한 번에 누적하여 채운다.
+ * 새 배열에 계산한 후 맞바꾸므로 자신이 피연산자이어도 된다.
+ * @exception		피연산자 크기가 다르거나 메모리 할당 실패 시 예외 발생
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::combine		(	size_t						num,		///< 항 수
+										const elem_t				coef[],		///< 항 별 계수
+										const BasicMatrixCSR* const		operand[]	///< 항 별 피연산자
+									)
+{
+	combineElems(num, coef, operand, true);
+}
+
+/**
+ * 선형 결합 계산
+ * @exception		피연산자 크기가 다르거나 메모리 할당 실패 시 예외 발생
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::combineElems	(	size_t						num,		///< 항 수
+											const elem_t				coef[],		///< 항 별 계수
+											const BasicMatrixCSR* const	operand[],	///< 항 별 피연산자
+											bool						useThread	///< 쓰레드 풀 사용 여부
+										)
+{
+	for(size_t cnt=1;cnt<num;++cnt)
+	{
+		operand[0]->chkSameSize(*operand[cnt]);
+	}
+
+	BasicMatrixCSR			result		=	BasicMatrixCSR(operand[0]->getRow(), operand[0]->getCol());
+	std::vector<size_t>	rowSize(result.getRow(), 0);
+	OpInfo				info;
+	size_t				work		=	0;
+
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		work	+=	operand[cnt]->getSize();
+	}
+
+	info.termNum	=	num;
+	info.coef		=	coef;
+	info.terms		=	operand;
+	info.result		=	&result;
+	info.rowSize	=	rowSize.data();
+
+	// 1. 결과 행 별 요소 수 계산
+	result.doThreadFunc(FUNC_COMBINE_SYMBOLIC, info, useThread, work);
+
+	result.mRowStart[0]	=	0;
+	for(size_t row=0;row<result.getRow();++row)
+	{
+		result.mRowStart[row+1]	=	result.mRowStart[row] + rowSize[row];
+	}
+
+	result.reserveElems(result.mRowStart[result.getRow()]);
+
+	// 2. 결과 값 계산
+	result.doThreadFunc(FUNC_COMBINE_NUMERIC, info, useThread, work);
+
+	// 계산 결과가 0이 되어 제외 된 요소가 있으면 빈 공간 제거
+	if( std::accumulate(rowSize.begin(), rowSize.end(), (size_t)0) != result.getSize() )
+	{
+		size_t		pos		=	0;
+
+		for(size_t row=0;row<result.getRow();++row)
+		{
+			size_t		start	=	result.mRowStart[row];
+
+			result.mRowStart[row]	=	pos;
 
-			if( ret == false )
+			for(size_t cnt=0;cnt<rowSize[row];++cnt)
 			{
-				break;
+				result.mColIdx[pos]		=	result.mColIdx[start + cnt];
+				result.mValue[pos]		=	result.mValue[start + cnt];
+				pos++;
 			}
 		}
+
+		result.mRowStart[result.getRow()]	=	pos;
 	}
-	else
+
+	swap(result);
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x)
+ * x는 getCol() 개, y는 getRow() 개의 연속 된 요소 배열이며, 메모리를 할당하지 않는다.
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::spmv		(	const elem_t	x[],	///< 입력 벡터
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	spmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y)
+ * beta가 0이면 y의 기존 값은 읽지 않는다.
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::spmv		(	elem_t			alpha,	///< 행렬 x 벡터 계수
+									const elem_t	x[],	///< 입력 벡터
+									elem_t			beta,	///< 결과 벡터 계수
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	spmvRows(alpha, x, beta, y, 0, getRow());
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x, 쓰레드 사용)
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::pspmv		(	const elem_t	x[],	///< 입력 벡터
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	pspmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y, 쓰레드 사용)
+ * 행 단위로 나누어 쓰레드 풀에서 수행하며, 각 쓰레드는 자기 행의 y만 쓴다.
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::pspmv		(	elem_t			alpha,	///< 행렬 x 벡터 계수
+									const elem_t	x[],	///< 입력 벡터
+									elem_t			beta,	///< 결과 벡터 계수
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	OpInfo		info;
+
+	info.operandA		=	this;
+	info.elemOperandB	=	alpha;
+	info.vecX			=	x;
+	info.vecY			=	y;
+	info.beta			=	beta;
+
+	doThreadFunc(FUNC_SPMV, info, true, getSize());
+}
+
+/**
+ * 행렬 비교 연산
+ * @return		두 행렬이 일치하면 true, 비 일치하면 false
+ */
+template<class T, class I>
+bool			BasicMatrixCSR<T, I>::compare			(	const BasicMatrixCSR&	operand	///< 피연산자
+												) const
+{
+	return	compareElems(operand, false);
+}
+
+/**
+ * 쓰레드 행렬 비교 연산
+ * @return		두 행렬이 일치하면 true, 비 일치하면 false
+ */
+template<class T, class I>
+bool			BasicMatrixCSR<T, I>::pcompare			(	const BasicMatrixCSR&	operand	///< 피연산자
+												) const
+{
+	return	compareElems(operand, true);
+}
+
+/**
+ * 행렬 비교 계산
+ * 크기와 요소 수가 같으면 행 별로 요소 값을 비교한다. (행 안의 요소 순서는 달라도 된다.)
+ * @return		두 행렬이 일치하면 true, 비 일치하면 false
+ */
+template<class T, class I>
+bool			BasicMatrixCSR<T, I>::compareElems		(	const BasicMatrixCSR&	operand,	///< 피연산자
+														bool					useThread	///< 쓰레드 풀 사용 여부
+													) const
+{
+	if( ( getRow() != operand.getRow() ) ||
+		( getCol() != operand.getCol() ) ||
+		( getSize() != operand.getSize() ) )
 	{
-		ret		=	false;
+		return	false;
 	}
 
-	return	ret;
+	OpInfo		info;
+
+	info.operandA		=	this;
+	info.operandB		=	&operand;
+
+	doThreadFunc(FUNC_COMPARE, info, useThread, getSize());
+
+	return	(info.retVal == 0)?(false):(true);
 }
 
-MatrixCSR	MatrixCSR::sol_cg	(	const MatrixCSR&	operand	)
+template<class T, class I>
+BasicMatrixCSR<T, I>	BasicMatrixCSR<T, I>::sol_cg	(	const BasicMatrixCSR&	operand	)
 {
-	MatrixCSR		x			=	MatrixCSR(this->getCol(), operand.getCol());
-	MatrixCSR		r			=	operand - ( (*this) * x );
-	MatrixCSR		p			=	r;
-	MatrixCSR		rSold		=	r.stmultiply(r);
-	MatrixCSR		result		=	x;
-	elem_t		min			=	1000;
+	BasicMatrixCSR		x			=	BasicMatrixCSR(this->getCol(), operand.getCol());
+	BasicMatrixCSR		r			=	operand - ( (*this) * x );
+	BasicMatrixCSR		p			=	r;
+	BasicMatrixCSR		ap;
+	BasicMatrixCSR		result		=	x;
+	elem_t		rSold		=	r.stmultiply(r).getElem(0,0);
+	real_t		min			=	1000;
 	bool		foundFlag	=	false;
 
 	for(size_t cnt=0;cnt<32;cnt++)
 	{
-		MatrixCSR	ap		=	(*this) * p;
+		ap		=	(*this) * p;
 
 		elem_t			ptval	=	(p.stmultiply(ap)).getElem(0,0);
-		elem_t			alpha	=	rSold.getElem(0,0) / ptval;
+		elem_t			alpha	=	rSold / ptval;
 
-		x	=	x + (p * alpha);
-		r	=	r - (ap * alpha);
+		x.axpy(alpha, p);
+		r.axpy(-alpha, ap);
 
-		MatrixCSR	rsNew	=	r.stmultiply(r);
-
-		elem_t		sqrtVal	=	sqrt(rsNew.getElem(0,0));
+		elem_t		rsNew	=	r.stmultiply(r).getElem(0,0);
+		real_t		sqrtVal	=	std::sqrt(std::abs(rsNew));
 
 		if( min > sqrtVal )
 		{
@@ -531,33 +1225,137 @@ MatrixCSR	MatrixCSR::sol_cg	(	const MatrixCSR&	operand	)
 			break;
 		}
 
-		p		=	r + ( p * (rsNew.getElem(0,0) / rSold.getElem(0,0) ) );
+		p.scale_add(rsNew / rSold, r);
 		rSold	=	rsNew;
 	}
 
 	if( foundFlag != true )
 	{
-		x	=	result;
+		x.swap(result);
 	}
 
 	return	x;
 }
 
+/**
+ * 전처리 켤레 기울기법으로 행렬 방정식 해 계산
+ * 0 벡터에서 시작하여 상대 잔차가 1e-8 보다 작아지거나 행 크기 만큼 반복할 때까지 계산한다.
+ * @return 해 계산 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>	BasicMatrixCSR<T, I>::sol_pcg	(	const BasicMatrixCSR&		operand,	///< 우변 행렬 (n x 1)
+									const BasicPreconditioner<T, I>&	precond		///< 전처리기
+								) const
+{
+	real_t	rangeResult		=	0.0;
+
+	return	sol_pcg	(	operand,
+						precond,
+						(uint32_t)std::max(getRow(), (size_t)32),
+						1e-8,
+						rangeResult
+					);
+}
+
+/**
+ * 전처리 켤레 기울기법으로 행렬 방정식 해 계산
+ * 우변과 해를 연속 된 배열로 옮겨 sol_pcg 템플릿으로 계산한다.
+ * 채운 요소가 적으면 반복 중의 행렬 x 벡터는 MatrixSELL로 변환하여 계산한다.
+ * @return 해 계산 결과
+ */
+template<class T, class I>
+BasicMatrixCSR<T, I>	BasicMatrixCSR<T, I>::sol_pcg	(	const BasicMatrixCSR&		operand,		///< 우변 행렬 (n x 1)
+									const BasicPreconditioner<T, I>&	precond,		///< 전처리기
+									uint32_t				iteration,		///< 최대 반복 횟수
+									real_t					limit,			///< 상대 잔차 한계
+									real_t&					rangeResult		///< 마지막 상대 잔차
+								) const
+{
+	if( ( operand.getRow() != getRow() ) ||
+		( operand.getCol() != 1 ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
+	}
+
+	std::vector<elem_t>		b;
+	std::vector<elem_t>		x;
+
+	try
+	{
+		b.assign(getRow(), 0);
+		x.assign(getRow(), 0);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	for(size_t row=0;row<operand.getRow();++row)
+	{
+		for(size_t cnt=operand.mRowStart[row];cnt<operand.mRowStart[row+1];++cnt)
+		{
+			b[row]	=	operand.mValue[cnt];
+		}
+	}
+
+	// 채운 요소가 25% 이하이면 SELL-C-sigma 형식으로 변환하여 벡터 명령으로 반복 계산
+	BasicMatrixSELL<T, I>	sell(*this);
+
+	if( sell.getPaddedSize() * 4 <= getSize() * 5 )
+	{
+		matrix::sol_pcg(sell, precond, b.data(), x.data(), iteration, limit, rangeResult);
+	}
+	else
+	{
+		matrix::sol_pcg(*this, precond, b.data(), x.data(), iteration, limit, rangeResult);
+	}
+
+	BasicMatrixCSR	result	=	BasicMatrixCSR(getRow(), 1);
+	size_t		pos		=	0;
+
+	result.reserveElems(getRow());
+
+	for(size_t row=0;row<getRow();++row)
+	{
+		if( x[row] != elem_t(0) )
+		{
+			result.mColIdx[pos]		=	0;
+			result.mValue[pos]		=	x[row];
+			pos++;
+		}
+
+		result.mRowStart[row+1]		=	pos;
+	}
+
+	return	result;
+}
+
 /**
  * 행렬 데이터 공간 할당
- * @exception		메모리 할당 실패 시 에러 발생
+ * @exception		메모리 할당 실패 또는 열 크기가 위치 형식 범위를 넘을 경우 에러 발생
  */
-void		MatrixCSR::allocElems		(	size_t		row,	///< 행 크기
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::allocElems		(	size_t		row,	///< 행 크기
 											size_t		col		///< 열 크기
 										)
 {
+	if( col > std::numeric_limits<index_t>::max() )
+	{
+		throw matrix::ErrMsg::createErrMsg("열 크기가 위치 형식 범위를 넘습니다.");
+	}
+
 	try
 	{
 		mRowSize	=	row;
 		mColSize	=	col;
 
-		mRowStart	=	new size_t[row+1];
-		memset(mRowStart, 0, sizeof(size_t) * (row+1));
+		mRowStart	=	allocArray<index_t>(row+1);
+		memset(mRowStart, 0, sizeof(index_t) * (row+1));
+
+		mColIdx		=	NULL;
+		mValue		=	NULL;
+		mCapacity	=	0;
+		mMapping	=	NULL;
 	}
 	catch (	std::bad_alloc&	exception		)
 	{
@@ -568,45 +1366,254 @@ void		MatrixCSR::allocElems		(	size_t		row,	///< 행 크기
 /**
  * 행렬 데이터 공간 할당 해제
  */
-void		MatrixCSR::freeElems		(	void	)
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::freeElems		(	void	)
 {
-	delete[]	mRowStart;
+	if( mMapping != NULL )
+	{
+		// 매핑 된 파일의 메모리는 해제하지 않는다.
+		delete	mMapping;
+	}
+	else
+	{
+		freeArray(mRowStart);
+		freeArray(mColIdx);
+		freeArray(mValue);
+	}
+
+	mRowStart	=	NULL;
+	mColIdx		=	NULL;
+	mValue		=	NULL;
+	mCapacity	=	0;
+	mMapping	=	NULL;
 	mRowSize	=	0;
 	mColSize	=	0;
 }
 
 /**
- * 행렬 데이터 복사
+ * 요소 배열 공간 확보
+ * 기존 요소는 유지되며, 요청한 크기가 현재 할당 크기 이하이면 아무 것도 하지 않는다.
+ * 행 별 시작 위치도 index_t 형식이므로 요소 수는 index_t 범위 안이어야 한다.
+ * @exception		메모리 할당 실패 또는 위치 형식 범위를 넘을 경우 에러 발생
  */
-void		MatrixCSR::copyElems		(	const MatrixCSR&		matrix		///< 복사 할 행렬
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::reserveElems		(	size_t		capacity	///< 확보 할 요소 수
 										)
 {
-	memcpy(mRowStart, matrix.mRowStart, sizeof(size_t) * (mRowSize + 1));
-	mData	=	matrix.mData;
-}
+	detach();
 
+	if( capacity <= mCapacity )
+	{
+		return;
+	}
 
-/**
- * 같은 크기의 행렬인지 검사
- * @exception		행렬이 같은 크기가 아닐 경우 예외 발생
- */
-void		MatrixCSR::chkSameSize	(	const MatrixCSR&		matrix		///< 비교 할 행렬
-										) const
-{
-	if( ( getRow() != matrix.getRow() ) ||
-		( getCol() != matrix.getCol() ) )
+	if( capacity > std::numeric_limits<index_t>::max() )
 	{
-		throw matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
+		throw matrix::ErrMsg::createErrMsg("요소 수가 위치 형식 범위를 넘습니다.");
 	}
-}
 
-/**
- * 행렬 요소 참조 범위 검사
- * @exception		참조 범위 밖일 경우 예외 발생
- */
-void		MatrixCSR::chkBound		(	size_t		row,	///< 참조 할 행 위치
-										size_t		col		///< 참조 할 열 위치
-									) const
+	index_t*	colIdx	=	NULL;
+	elem_t*		value	=	NULL;
+	size_t		size	=	std::min(getSize(), mCapacity);
+
+	try
+	{
+		colIdx	=	allocArray<index_t>(capacity);
+		value	=	allocArray<elem_t>(capacity);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		freeArray(colIdx);
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	if( size != 0 )
+	{
+		memcpy(colIdx, mColIdx, sizeof(index_t) * size);
+		memcpy(value, mValue, sizeof(elem_t) * size);
+	}
+
+	freeArray(mColIdx);
+	freeArray(mValue);
+
+	mColIdx		=	colIdx;
+	mValue		=	value;
+	mCapacity	=	capacity;
+}
+
+/**
+ * 파일에 매핑 된 데이터를 직접 할당한 메모리로 복사
+ * 매핑 된 데이터가 아니면 아무 것도 하지 않는다.
+ * @exception		메모리 할당 실패 시 에러 발생
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::detach		(	void	)
+{
+	if( mMapping == NULL )
+	{
+		return;
+	}
+
+	size_t		size		=	getSize();
+	index_t*	rowStart	=	NULL;
+	index_t*	colIdx		=	NULL;
+	elem_t*		value		=	NULL;
+
+	try
+	{
+		rowStart	=	allocArray<index_t>(mRowSize+1);
+		colIdx		=	allocArray<index_t>(size);
+		value		=	allocArray<elem_t>(size);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		freeArray(rowStart);
+		freeArray(colIdx);
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	memcpy(rowStart, mRowStart, sizeof(index_t) * (mRowSize + 1));
+	memcpy(colIdx, mColIdx, sizeof(index_t) * size);
+	memcpy(value, mValue, sizeof(elem_t) * size);
+
+	delete	mMapping;
+
+	mMapping	=	NULL;
+	mRowStart	=	rowStart;
+	mColIdx		=	colIdx;
+	mValue		=	value;
+	mCapacity	=	size;
+}
+
+/**
+ * SIMD_ALIGN 바이트 경계에 정렬 된 배열 할당
+ * 요소 배열은 memcpy로만 옮기므로 생성자를 호출하지 않는다.
+ * @return		할당한 배열
+ * @exception		메모리 할당 실패 시 std::bad_alloc 발생
+ */
+template<class T, class I>
+template<class U>
+U*		BasicMatrixCSR<T, I>::allocArray		(	size_t		num		///< 요소 수
+											)
+{
+	return	(U*)SimdKernel::allocAligned(sizeof(U) * num);
+}
+
+/**
+ * allocArray로 할당한 배열 해제 (NULL 가능)
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::freeArray		(	void*		ptr		///< 해제 할 배열
+											)
+{
+	SimdKernel::freeAligned(ptr);
+}
+
+/**
+ * 요소 배열 배치
+ * 쓰레드 풀이 first touch 모드일 때, 행 별 시작 위치를 정한 후 요소를 채우기 전에 호출한다.
+ * 연산과 같은 행 분할로 각 쓰레드가 맡은 행의 요소 배열을 먼저 써서,
+ * 그 쓰레드가 실행되는 NUMA 노드의 메모리에 배치되도록 한다.
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::placeElems		(	void	)
+{
+	if( ThreadPool::getInstance().getFirstTouch() == false )
+	{
+		return;
+	}
+
+	OpInfo		info;
+
+	info.result		=	this;
+
+	doThreadFunc(FUNC_TOUCH, info, true, getSize());
+}
+
+/**
+ * 행렬 데이터 복사
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::copyElems		(	const BasicMatrixCSR&		matrix		///< 복사 할 행렬
+										)
+{
+	if( mMapping != NULL )
+	{
+		size_t		row		=	mRowSize;
+		size_t		col		=	mColSize;
+
+		freeElems();
+		allocElems(row, col);
+	}
+
+	size_t		size	=	matrix.getSize();
+
+	reserveElems(size);
+
+	memcpy(mRowStart, matrix.mRowStart, sizeof(index_t) * (mRowSize + 1));
+
+	placeElems();
+
+	if( size != 0 )
+	{
+		memcpy(mColIdx, matrix.mColIdx, sizeof(index_t) * size);
+		memcpy(mValue, matrix.mValue, sizeof(elem_t) * size);
+	}
+}
+
+/**
+ * 쓰레드 행렬 데이터 복사
+ * 행 별 시작 위치를 복사한 후, 요소 배열은 행 범위로 나누어 쓰레드 풀에서 복사한다.
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::pcopyElems		(	const BasicMatrixCSR&		matrix		///< 복사 할 행렬
+										)
+{
+	if( mMapping != NULL )
+	{
+		size_t		row		=	mRowSize;
+		size_t		col		=	mColSize;
+
+		freeElems();
+		allocElems(row, col);
+	}
+
+	OpInfo		info;
+
+	reserveElems(matrix.getSize());
+
+	memcpy(mRowStart, matrix.mRowStart, sizeof(index_t) * (mRowSize + 1));
+
+	info.operandA	=	&matrix;
+	info.result		=	this;
+
+	matrix.doThreadFunc(FUNC_COPY, info, true, matrix.getSize());
+}
+
+
+/**
+ * 같은 크기의 행렬인지 검사
+ * @exception		행렬이 같은 크기가 아닐 경우 예외 발생
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::chkSameSize	(	const BasicMatrixCSR&		matrix		///< 비교 할 행렬
+										) const
+{
+	if( ( getRow() != matrix.getRow() ) ||
+		( getCol() != matrix.getCol() ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
+	}
+}
+
+/**
+ * 행렬 요소 참조 범위 검사
+ * @exception		참조 범위 밖일 경우 예외 발생
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::chkBound		(	size_t		row,	///< 참조 할 행 위치
+										size_t		col		///< 참조 할 열 위치
+									) const
 {
 	if( ( row >= mRowSize ) ||
 		( col >= mColSize ) )
@@ -615,4 +1622,587 @@ void		MatrixCSR::chkBound		(	size_t		row,	///< 참조 할 행 위치
 	}
 }
 
+/**
+ * 지정한 범위의 행에 대한 행렬 x 벡터
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::spmvRows		(	elem_t			alpha,		///< 행렬 x 벡터 계수
+										const elem_t	x[],		///< 입력 벡터
+										elem_t			beta,		///< 결과 벡터 계수
+										elem_t			y[],		///< 결과 벡터
+										size_t			startRow,	///< 시작 행
+										size_t			endRow		///< 종료 행 (미포함)
+									) const
+{
+	for(size_t row=startRow;row<endRow;++row)
+	{
+		elem_t		sum		=	0;
+
+		for(size_t cnt=mRowStart[row];cnt<mRowStart[row+1];++cnt)
+		{
+			sum		+=	mValue[cnt] * x[mColIdx[cnt]];
+		}
+
+		if( beta == elem_t(0) )
+		{
+			y[row]	=	alpha * sum;
+		}
+		else
+		{
+			y[row]	=	alpha * sum + beta * y[row];
+		}
+	}
+}
+
+/**
+ * 쓰레드 연산 시작
+ * useThread가 false이거나 작업 크기가 쓰레드 풀의 최소 작업 크기보다 작으면 호출한 쓰레드에서 바로 수행한다.
+ * 행 구간은 요소 수가 비슷하도록 나눈다.
+ * first touch 모드에서 요소 배열을 쓰는 연산은 결과 행렬 자신의 행 별 시작 위치로 나누어,
+ * 요소 배열을 처음 쓴 쓰레드가 이후 같은 행렬을 읽는 연산에서도 같은 행을 맡도록 한다.
+ * 행 별 계산량이 피연산자 B에 따라 달라지는 곱셈은 구간을 조각으로 더 잘게 나누어 작업 훔치기로 수행한다.
+ */
+template<class T, class I>
+void		BasicMatrixCSR<T, I>::doThreadFunc		(	FuncKind	kind,		///< 연산 종류
+											OpInfo&		info,		///< 연산 참조 데이터
+											bool		useThread,	///< 쓰레드 풀 사용 여부
+											size_t		work		///< 작업 크기 (연산이 읽는 요소 수)
+										) const
+{
+	ThreadPool&				pool		=	ThreadPool::getInstance();
+	FuncInfo				orgFuncInfo	=	FuncInfo();
+	size_t					threadNum	=	1;
+	const index_t*			rowStart	=	mRowStart;
+	bool					useChunk	=	false;
+
+	orgFuncInfo.opInfo	=	info;
+
+	switch( kind )
+	{
+	case FUNC_ELEM_MUL:
+		orgFuncInfo.func	=	BasicMatrixCSR::threadElemMul;
+		break;
+	case FUNC_COPY:
+		orgFuncInfo.func	=	BasicMatrixCSR::threadCopy;
+		break;
+	case FUNC_COMPARE:
+		orgFuncInfo.func	=	BasicMatrixCSR::threadCompare;
+		break;
+	case FUNC_MULTIPLY_SYMBOLIC:
+		orgFuncInfo.func	=	BasicMatrixCSR::threadMultiplySymbolic;
+		useChunk			=	true;
+		break;
+	case FUNC_MULTIPLY_NUMERIC:
+		// 결과 행 별 요소 수가 계산량에 더 가깝다.
+		orgFuncInfo.func	=	BasicMatrixCSR::threadMultiplyNumeric;
+		rowStart			=	info.result->mRowStart;
+		useChunk			=	true;
+		break;
+	case FUNC_SPMV:
+		orgFuncInfo.func	=	BasicMatrixCSR::threadSpmv;
+		break;
+	case FUNC_COMBINE_SYMBOLIC:
+		orgFuncInfo.func	=	BasicMatrixCSR::threadCombineSymbolic;
+		break;
+	case FUNC_COMBINE_NUMERIC:
+		orgFuncInfo.func	=	BasicMatrixCSR::threadCombineNumeric;
+		break;
+	case FUNC_TOUCH:
+		orgFuncInfo.func	=	BasicMatrixCSR::threadTouch;
+		break;
+	default:
+		break;
+	}
+
+	info.retVal		=	(THREAD_RETURN_TYPE)TRUE;
+
+	if( getRow() == 0 )
+	{
+		return;
+	}
+
+	if( ( useThread == true ) &&
+		( pool.isSerial(work) == false ) )
+	{
+		threadNum	=	pool.getTaskNum(getRow());
+	}
+
+	// 선형 결합은 결과 행렬의 행 별 시작 위치가 아직 없으므로 모든 항의 행 별 시작 위치를 더해서 사용한다.
+	// first touch 모드의 값 계산은 결과 요소 배열을 처음 쓰므로 결과 행렬 자신의 행 별 시작 위치로 나눈다.
+	std::vector<index_t>	termStart;
+
+	if( ( ( kind == FUNC_COMBINE_SYMBOLIC ) ||
+		  ( ( kind == FUNC_COMBINE_NUMERIC ) && ( pool.getFirstTouch() == false ) ) ) &&
+		( threadNum > 1 ) )
+	{
+		termStart.assign(getRow() + 1, 0);
+
+		for(size_t cnt=0;cnt<info.termNum;++cnt)
+		{
+			for(size_t row=0;row<=getRow();++row)
+			{
+				termStart[row]	+=	info.terms[cnt]->mRowStart[row];
+			}
+		}
+
+		rowStart	=	termStart.data();
+	}
+
+	size_t							chunkNum	=	useChunk ? pool.getChunkNum(threadNum, getRow()) : threadNum;
+	std::vector<size_t>				bound(chunkNum + 1);
+	std::vector<FuncInfo>			funcInfo(threadNum);
+	std::vector<void*>				args(threadNum);
+	std::vector<THREAD_RETURN_TYPE>	retVal(threadNum);
+
+	ThreadPool::splitRows(rowStart, getRow(), chunkNum, &bound[0]);
+
+	ChunkQueue						queue(threadNum, chunkNum);
+
+	for(size_t num=0;num<threadNum;num++)
+	{
+		funcInfo[num]	=	orgFuncInfo;
+
+		funcInfo[num].startCol	=	bound[num];
+		funcInfo[num].endCol	=	bound[num+1] - 1;
+
+		if( useChunk == true )
+		{
+			funcInfo[num].queue			=	&queue;
+			funcInfo[num].chunkStart	=	&bound[0];
+			funcInfo[num].task			=	num;
+		}
+
+		args[num]		=	&funcInfo[num];
+	}
+
+	if( threadNum == 1 )
+	{
+		retVal[0]	=	threadFunc(args[0]);
+	}
+	else
+	{
+		// 쓰레드 풀에서 수행
+		pool.execute	(	BasicMatrixCSR::threadFunc,
+							&args[0],
+							&retVal[0],
+							threadNum
+						);
+	}
+
+	if( kind == FUNC_COMPARE )
+	{
+		for(size_t num=0;num<threadNum;num++)
+		{
+			info.retVal	=	(THREAD_RETURN_TYPE)((unsigned long)info.retVal & (unsigned long)retVal[num]);
+		}
+	}
+}
+
+/**
+ * 작업 쓰레드 함수
+ * 조각 큐가 있으면 남은 조각이 없을 때까지 조각을 가져와 그 행 구간을 수행한다.
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadFunc		(	void*	pData	)
+{
+	FuncInfo*	info	=	(FuncInfo*)pData;
+	size_t		chunk	=	0;
+
+	if( info->queue == NULL )
+	{
+		return	info->func(info);
+	}
+
+	while( info->queue->pop(info->task, chunk) == true )
+	{
+		info->startCol	=	info->chunkStart[chunk];
+		info->endCol	=	info->chunkStart[chunk+1] - 1;
+
+		info->func(info);
+	}
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 행에 대한 행렬 x 단일 값
+ * 결과 행렬의 행 별 시작 위치는 미리 복사되어 있어야 한다.
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadElemMul		(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+
+	const BasicMatrixCSR&	operandA	=	*info->opInfo.operandA;
+	elem_t				operandB	=	info->opInfo.elemOperandB;
+	BasicMatrixCSR&			result		=	*info->opInfo.result;
+
+	for(size_t cnt=operandA.mRowStart[info->startCol];cnt<operandA.mRowStart[info->endCol+1];++cnt)
+	{
+		result.mColIdx[cnt]		=	operandA.mColIdx[cnt];
+		result.mValue[cnt]		=	operandA.mValue[cnt] * operandB;
+	}
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 행의 요소 배열 복사
+ * 결과 행렬의 행 별 시작 위치는 미리 복사되어 있어야 한다.
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadCopy		(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+
+	const BasicMatrixCSR&	operandA	=	*info->opInfo.operandA;
+	BasicMatrixCSR&			result		=	*info->opInfo.result;
+	size_t				start		=	operandA.mRowStart[info->startCol];
+	size_t				size		=	operandA.mRowStart[info->endCol+1] - start;
+
+	if( size != 0 )
+	{
+		memcpy(result.mColIdx + start, operandA.mColIdx + start, sizeof(index_t) * size);
+		memcpy(result.mValue + start, operandA.mValue + start, sizeof(elem_t) * size);
+	}
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 행의 요소 배열 first touch
+ * 행 별 시작 위치는 미리 정해져 있어야 한다.
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadTouch		(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+
+	BasicMatrixCSR&			result		=	*info->opInfo.result;
+	size_t				start		=	result.mRowStart[info->startCol];
+	size_t				size		=	result.mRowStart[info->endCol+1] - start;
+
+	if( size != 0 )
+	{
+		std::fill_n(result.mColIdx + start, size, index_t(0));
+		std::fill_n(result.mValue + start, size, elem_t(0));
+	}
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 행에 대한 비교
+ * 뒤 행렬 행의 요소 위치를 열 별로 기록한 후, 앞 행렬 행의 각 요소와 같은 열의 값을 비교한다.
+ * return 모든 요소가 같으면 TRUE, 아니면 FALSE
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadCompare		(	void*	pData	)
+{
+	bool			flag		=	true;
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	size_t			start		=	info->startCol;
+	size_t			end			=	info->endCol;
+
+	const BasicMatrixCSR&	operandA	=	*info->opInfo.operandA;
+	const BasicMatrixCSR&	operandB	=	*info->opInfo.operandB;
+
+	// 열 별 뒤 행렬 요소 위치 (현재 행 범위 밖이면 없는 요소)
+	std::vector<size_t>	marker(operandA.getCol(), (size_t)-1);
+
+	for(size_t row=start;( row <= end ) && ( flag == true );++row)
+	{
+		size_t		startB	=	operandB.mRowStart[row];
+		size_t		endB	=	operandB.mRowStart[row+1];
+
+		for(size_t cnt=startB;cnt<endB;++cnt)
+		{
+			marker[operandB.mColIdx[cnt]]	=	cnt;
+		}
+
+		for(size_t cnt=operandA.mRowStart[row];cnt<operandA.mRowStart[row+1];++cnt)
+		{
+			size_t		pos		=	marker[operandA.mColIdx[cnt]];
+			elem_t		val		=	( ( pos >= startB ) && ( pos < endB ) ) ? operandB.mValue[pos] : elem_t(0);
+
+			if( operandA.mValue[cnt] != val )
+			{
+				flag	=	false;
+				break;
+			}
+		}
+	}
+
+	return	(THREAD_RETURN_TYPE)flag;
+}
+
+/**
+ * 지정한 범위의 행에 대한 곱셈 결과 요소 수 계산
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadMultiplySymbolic	(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	size_t			start		=	info->startCol;
+	size_t			end			=	info->endCol;
+
+	const BasicMatrixCSR&	operandA	=	*info->opInfo.operandA;
+	const BasicMatrixCSR&	operandB	=	*info->opInfo.operandB;
+	size_t*				rowSize		=	info->opInfo.rowSize;
+
+	// 열 별로 마지막으로 방문한 행을 기록하여 중복 열을 한 번만 센다.
+	std::vector<size_t>&	marker		=	info->marker;
+
+	if( marker.empty() == true )
+	{
+		marker.assign(operandB.getCol(), (size_t)-1);
+	}
+
+	for(size_t row=start;row<=end;++row)
+	{
+		size_t		count	=	0;
+
+		for(size_t cnt=operandA.mRowStart[row];cnt<operandA.mRowStart[row+1];++cnt)
+		{
+			size_t		rowB	=	operandA.mColIdx[cnt];
+
+			for(size_t cnt2=operandB.mRowStart[rowB];cnt2<operandB.mRowStart[rowB+1];++cnt2)
+			{
+				size_t		col		=	operandB.mColIdx[cnt2];
+
+				if( marker[col] != row )
+				{
+					marker[col]		=	row;
+					count++;
+				}
+			}
+		}
+
+		rowSize[row]	=	count;
+	}
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 행에 대한 곱셈 결과 값 계산
+ * 결과 행은 열 순서로 정렬하여 저장하고, 0이 된 요소는 제외한 후 실제 요소 수를 기록한다.
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadMultiplyNumeric	(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	size_t			start		=	info->startCol;
+	size_t			end			=	info->endCol;
+
+	const BasicMatrixCSR&	operandA	=	*info->opInfo.operandA;
+	const BasicMatrixCSR&	operandB	=	*info->opInfo.operandB;
+	BasicMatrixCSR&			result		=	*info->opInfo.result;
+	size_t*				rowSize		=	info->opInfo.rowSize;
+
+	// 작업 별 누적 배열
+	std::vector<elem_t>&	accum		=	info->accum;
+	std::vector<size_t>&	marker		=	info->marker;
+	std::vector<size_t>		cols;
+
+	if( marker.empty() == true )
+	{
+		accum.assign(operandB.getCol(), elem_t(0));
+		marker.assign(operandB.getCol(), (size_t)-1);
+	}
+
+	for(size_t row=start;row<=end;++row)
+	{
+		cols.clear();
+
+		for(size_t cnt=operandA.mRowStart[row];cnt<operandA.mRowStart[row+1];++cnt)
+		{
+			size_t		rowB	=	operandA.mColIdx[cnt];
+			elem_t		valA	=	operandA.mValue[cnt];
+
+			for(size_t cnt2=operandB.mRowStart[rowB];cnt2<operandB.mRowStart[rowB+1];++cnt2)
+			{
+				size_t		col		=	operandB.mColIdx[cnt2];
+
+				if( marker[col] != row )
+				{
+					marker[col]		=	row;
+					accum[col]		=	valA * operandB.mValue[cnt2];
+					cols.push_back(col);
+				}
+				else
+				{
+					accum[col]		+=	valA * operandB.mValue[cnt2];
+				}
+			}
+		}
+
+		std::sort(cols.begin(), cols.end());
+
+		size_t		pos		=	result.mRowStart[row];
+
+		for(size_t cnt=0;cnt<cols.size();++cnt)
+		{
+			if( accum[cols[cnt]] != elem_t(0) )
+			{
+				result.mColIdx[pos]		=	cols[cnt];
+				result.mValue[pos]		=	accum[cols[cnt]];
+				pos++;
+			}
+		}
+
+		rowSize[row]	=	pos - result.mRowStart[row];
+	}
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 행에 대한 행렬 x 벡터
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadSpmv		(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	const BasicMatrixCSR::OpInfo&	opInfo	=	info->opInfo;
+
+	opInfo.operandA->spmvRows	(	opInfo.elemOperandB,
+									opInfo.vecX,
+									opInfo.beta,
+									opInfo.vecY,
+									info->startCol,
+									info->endCol + 1
+								);
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 행에 대한 선형 결합 결과 요소 수 계산
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadCombineSymbolic	(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	size_t			start		=	info->startCol;
+	size_t			end			=	info->endCol;
+
+	const BasicMatrixCSR::OpInfo&	opInfo	=	info->opInfo;
+	size_t*						rowSize	=	opInfo.rowSize;
+
+	// 열 별로 마지막으로 방문한 행을 기록하여 중복 열을 한 번만 센다.
+	std::vector<size_t>	marker(opInfo.result->getCol(), (size_t)-1);
+
+	for(size_t row=start;row<=end;++row)
+	{
+		size_t		count	=	0;
+
+		for(size_t num=0;num<opInfo.termNum;++num)
+		{
+			const BasicMatrixCSR&	operand		=	*opInfo.terms[num];
+
+			for(size_t cnt=operand.mRowStart[row];cnt<operand.mRowStart[row+1];++cnt)
+			{
+				size_t		col		=	operand.mColIdx[cnt];
+
+				if( marker[col] != row )
+				{
+					marker[col]		=	row;
+					count++;
+				}
+			}
+		}
+
+		rowSize[row]	=	count;
+	}
+
+	return	NULL;
+}
+
+/**
+ * 지정한 범위의 행에 대한 선형 결합 결과 값 계산
+ * 결과 행은 열 순서로 정렬하여 저장하고, 0이 된 요소는 제외한 후 실제 요소 수를 기록한다.
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixCSR<T, I>::threadCombineNumeric	(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	size_t			start		=	info->startCol;
+	size_t			end			=	info->endCol;
+
+	const BasicMatrixCSR::OpInfo&	opInfo	=	info->opInfo;
+	BasicMatrixCSR&					result	=	*opInfo.result;
+	size_t*						rowSize	=	opInfo.rowSize;
+
+	// 쓰레드 별 누적 배열
+	std::vector<elem_t>	accum(result.getCol(), 0);
+	std::vector<size_t>	marker(result.getCol(), (size_t)-1);
+	std::vector<size_t>	cols;
+
+	for(size_t row=start;row<=end;++row)
+	{
+		cols.clear();
+
+		for(size_t num=0;num<opInfo.termNum;++num)
+		{
+			const BasicMatrixCSR&	operand		=	*opInfo.terms[num];
+			elem_t				coef		=	opInfo.coef[num];
+
+			for(size_t cnt=operand.mRowStart[row];cnt<operand.mRowStart[row+1];++cnt)
+			{
+				size_t		col		=	operand.mColIdx[cnt];
+
+				if( marker[col] != row )
+				{
+					marker[col]		=	row;
+					accum[col]		=	coef * operand.mValue[cnt];
+					cols.push_back(col);
+				}
+				else
+				{
+					accum[col]		+=	coef * operand.mValue[cnt];
+				}
+			}
+		}
+
+		std::sort(cols.begin(), cols.end());
+
+		size_t		pos		=	result.mRowStart[row];
+
+		for(size_t cnt=0;cnt<cols.size();++cnt)
+		{
+			if( accum[cols[cnt]] != elem_t(0) )
+			{
+				result.mColIdx[pos]		=	cols[cnt];
+				result.mValue[pos]		=	accum[cols[cnt]];
+				pos++;
+			}
+		}
+
+		rowSize[row]	=	pos - result.mRowStart[row];
+	}
+
+	return	NULL;
+}
+
+/////////////////////////////
+// 요소 / 위치 형식 별 명시적 인스턴스
+
+template class	BasicMatrixCSR< float, uint32_t >;
+template class	BasicMatrixCSR< float, uint64_t >;
+template class	BasicMatrixCSR< double, uint32_t >;
+template class	BasicMatrixCSR< double, uint64_t >;
+template class	BasicMatrixCSR< std::complex<float>, uint32_t >;
+template class	BasicMatrixCSR< std::complex<float>, uint64_t >;
+template class	BasicMatrixCSR< std::complex<double>, uint32_t >;
+template class	BasicMatrixCSR< std::complex<double>, uint64_t >;
+
 }
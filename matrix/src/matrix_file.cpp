@@ -0,0 +1,1576 @@
+/*
+ * matrix_file.cpp
+ *
+ *  Created on: 2015. 8. 12.
+ *      Author: asran
+ */
+
+#include "matrix_file.h"
+#include "matrix.h"
+#include "matrix_csr.h"
+#include "sparse_matrix.h"
+#include "sparse_matrix2.h"
+#include "matrix_builder.h"
+#include "matrix_error.h"
+#include "thread_pool.h"
+#include <string>
+#include <stdlib.h>
+#include <ctype.h>
+
+#if(PLATFORM == PLATFORM_LINUX)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define	CSR_FILE_MAGIC			("MTXCSR")
+#define	CSR_FILE_VERSION		(1)
+#define	CSR_FILE_BYTE_ORDER	(0x01020304)
+#define	CSR_FILE_ALIGN			(64)
+#define	TEXT_CHUNK_SIZE		(1 << 20)
+#define	MTX_TASK_NUM			(32)			///< Matrix Market 파일 최대 구간 수
+#define	MTX_CHUNK_MIN_SIZE		(1 << 20)		///< Matrix Market 파일 최소 구간 크기
+#define	MTX_TOKEN_MAX			(128)			///< 값 하나의 최대 길이
+#define	MTX_WRITE_BUFFER_SIZE	(1 << 20)
+
+namespace matrix
+{
+
+/**
+ * 정렬 경계로 올림
+ * @return 올림 한 위치
+ */
+static uint64_t		alignOffset		(	uint64_t	offset	)
+{
+	return	( offset + CSR_FILE_ALIGN - 1 ) / CSR_FILE_ALIGN * CSR_FILE_ALIGN;
+}
+
+/// 빠른 실수 변환에 사용하는 10의 거듭제곱 (double로 정확히 표현되는 범위)
+static const double	sPow10[]	=
+{
+	1e0,	1e1,	1e2,	1e3,	1e4,	1e5,	1e6,	1e7,
+	1e8,	1e9,	1e10,	1e11,	1e12,	1e13,	1e14,	1e15,
+	1e16,	1e17,	1e18,	1e19,	1e20,	1e21,	1e22,
+};
+
+/**
+ * 줄 끝 찾기
+ * @return 줄 바꿈 문자 위치, 없으면 end
+ */
+static const char*	findLineEnd		(	const char*		pos,	///< 검색 시작 위치
+										const char*		end		///< 검색 종료 위치
+									)
+{
+	const char*		found	=	(const char*)memchr(pos, '\n', end - pos);
+
+	return	( found != NULL ) ? found : end;
+}
+
+/**
+ * 줄 안의 공백 건너뛰기
+ * @return 공백이 아닌 첫 위치
+ */
+static const char*	skipSpace		(	const char*		pos,	///< 시작 위치
+										const char*		end		///< 줄 끝 위치
+									)
+{
+	while( ( pos < end ) &&
+		   ( ( *pos == ' ' ) || ( *pos == '\t' ) || ( *pos == '\r' ) ) )
+	{
+		pos++;
+	}
+
+	return	pos;
+}
+
+/**
+ * 값 구분 위치인지 검사
+ * @return 줄 끝이거나 공백이면 true
+ */
+static bool		isDelimiter		(	const char*		pos,	///< 검사 할 위치
+									const char*		end		///< 줄 끝 위치
+								)
+{
+	return	( pos == end ) || ( *pos == ' ' ) || ( *pos == '\t' ) || ( *pos == '\r' );
+}
+
+/**
+ * 10진 정수 해석
+ * @return 성공하면 true
+ */
+static bool		parseIndex		(	const char*&	pos,	///< 해석 위치 (해석 후 다음 위치)
+									const char*		end,	///< 줄 끝 위치
+									size_t&			value	///< 해석 결과
+								)
+{
+	const char*		start	=	pos		=	skipSpace(pos, end);
+
+	value	=	0;
+
+	while( ( pos < end ) &&
+		   ( *pos >= '0' ) && ( *pos <= '9' ) )
+	{
+		if( value > ( (size_t)-1 - 9 ) / 10 )
+		{
+			return	false;
+		}
+
+		value	=	value * 10 + (size_t)( *pos - '0' );
+		pos++;
+	}
+
+	return	( pos != start ) && isDelimiter(pos, end);
+}
+
+/**
+ * 실수 해석
+ * 지역 설정에 관계 없이 해석하며, 유효 숫자가 19자리 이하이고 지수가 작은 일반적인 값은
+ * 정수 가수와 10의 거듭제곱 한 번의 곱/나눗셈으로 정확히 변환한다.
+ * 그 밖의 값 (긴 가수, 큰 지수, inf, nan)은 strtod로 변환한다.
+ * @return 성공하면 true
+ */
+static bool		parseElem		(	const char*&	pos,	///< 해석 위치 (해석 후 다음 위치)
+									const char*		end,	///< 줄 끝 위치
+									elem_t&			value	///< 해석 결과
+								)
+{
+	const char*		start		=	pos		=	skipSpace(pos, end);
+	const char*		tokenEnd	=	start;
+
+	while( isDelimiter(tokenEnd, end) == false )
+	{
+		tokenEnd++;
+	}
+
+	if( tokenEnd == start )
+	{
+		return	false;
+	}
+
+	bool		negative	=	false;
+	bool		digit		=	false;
+	uint64_t	mantissa	=	0;
+	int			digitNum	=	0;
+	int			exponent	=	0;
+
+	if( ( *pos == '-' ) || ( *pos == '+' ) )
+	{
+		negative	=	( *pos == '-' );
+		pos++;
+	}
+
+	for(;( pos < tokenEnd ) && ( *pos >= '0' ) && ( *pos <= '9' );++pos)
+	{
+		digit	=	true;
+
+		if( digitNum < 19 )
+		{
+			mantissa	=	mantissa * 10 + (uint64_t)( *pos - '0' );
+			digitNum	+=	( mantissa != 0 ) ? 1 : 0;
+		}
+		else
+		{
+			exponent++;
+		}
+	}
+
+	if( ( pos < tokenEnd ) && ( *pos == '.' ) )
+	{
+		for(++pos;( pos < tokenEnd ) && ( *pos >= '0' ) && ( *pos <= '9' );++pos)
+		{
+			digit	=	true;
+
+			if( digitNum < 19 )
+			{
+				mantissa	=	mantissa * 10 + (uint64_t)( *pos - '0' );
+				digitNum	+=	( mantissa != 0 ) ? 1 : 0;
+				exponent--;
+			}
+		}
+	}
+
+	if( ( digit == true ) &&
+		( pos < tokenEnd ) &&
+		( ( *pos == 'e' ) || ( *pos == 'E' ) ) )
+	{
+		bool		negativeExp	=	false;
+		int			exp			=	0;
+
+		pos++;
+
+		if( ( pos < tokenEnd ) &&
+			( ( *pos == '-' ) || ( *pos == '+' ) ) )
+		{
+			negativeExp		=	( *pos == '-' );
+			pos++;
+		}
+
+		digit	=	false;
+
+		for(;( pos < tokenEnd ) && ( *pos >= '0' ) && ( *pos <= '9' );++pos)
+		{
+			digit	=	true;
+
+			if( exp < 10000 )
+			{
+				exp		=	exp * 10 + ( *pos - '0' );
+			}
+		}
+
+		exponent	+=	( negativeExp == true ) ? -exp : exp;
+	}
+
+	if( ( digit == true ) &&
+		( pos == tokenEnd ) &&
+		( mantissa < ( (uint64_t)1 << 53 ) ) &&
+		( ( mantissa == 0 ) || ( ( exponent >= -22 ) && ( exponent <= 22 ) ) ) )
+	{
+		value	=	(elem_t)mantissa;
+
+		if( exponent < 0 )
+		{
+			value	/=	sPow10[-exponent];
+		}
+		else if( mantissa != 0 )
+		{
+			value	*=	sPow10[exponent];
+		}
+
+		value	=	( negative == true ) ? -value : value;
+		return	true;
+	}
+
+	// 빠른 변환을 할 수 없는 값
+	char	token[MTX_TOKEN_MAX];
+	char*	next		=	NULL;
+	size_t	length		=	tokenEnd - start;
+
+	if( length >= MTX_TOKEN_MAX )
+	{
+		return	false;
+	}
+
+	memcpy(token, start, length);
+	token[length]	=	'\0';
+
+	value	=	strtod(token, &next);
+	pos		=	tokenEnd;
+
+	return	( next == token + length );
+}
+
+/**
+ * 생성자
+ * 파일 전체를 읽기 전용으로 매핑한다.
+ * @exception 파일 열기 또는 매핑 실패 시 예외 발생
+ */
+MappedFile::MappedFile		(	const char	fileName[]	///< 매핑 할 파일 이름
+							)
+:mAddr(NULL),
+ mSize(0)
+{
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	LARGE_INTEGER	size;
+
+	mFile	=	::CreateFileA	(	fileName,
+									GENERIC_READ,
+									FILE_SHARE_READ,
+									NULL,
+									OPEN_EXISTING,
+									FILE_ATTRIBUTE_NORMAL,
+									NULL
+								);
+
+	if( mFile == INVALID_HANDLE_VALUE )
+	{
+		throw matrix::ErrMsg::createErrMsg("파일 열기 실패");
+	}
+
+	if( ( ::GetFileSizeEx(mFile, &size) == FALSE ) ||
+		( size.QuadPart == 0 ) )
+	{
+		::CloseHandle(mFile);
+		throw matrix::ErrMsg::createErrMsg("파일 크기가 올바르지 않습니다.");
+	}
+
+	mSize	=	(size_t)size.QuadPart;
+	mMap	=	::CreateFileMappingA(mFile, NULL, PAGE_READONLY, 0, 0, NULL);
+
+	if( mMap == NULL )
+	{
+		::CloseHandle(mFile);
+		throw matrix::ErrMsg::createErrMsg("파일 매핑 실패");
+	}
+
+	mAddr	=	(const char*)::MapViewOfFile(mMap, FILE_MAP_READ, 0, 0, 0);
+
+	if( mAddr == NULL )
+	{
+		::CloseHandle(mMap);
+		::CloseHandle(mFile);
+		throw matrix::ErrMsg::createErrMsg("파일 매핑 실패");
+	}
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	struct stat		info;
+	int				file	=	::open(fileName, O_RDONLY);
+
+	if( file < 0 )
+	{
+		throw matrix::ErrMsg::createErrMsg("파일 열기 실패");
+	}
+
+	if( ( ::fstat(file, &info) != 0 ) ||
+		( info.st_size == 0 ) )
+	{
+		::close(file);
+		throw matrix::ErrMsg::createErrMsg("파일 크기가 올바르지 않습니다.");
+	}
+
+	mSize	=	(size_t)info.st_size;
+
+	void*	addr	=	::mmap(NULL, mSize, PROT_READ, MAP_PRIVATE, file, 0);
+
+	// 매핑은 파일 디스크립터를 닫아도 유지된다.
+	::close(file);
+
+	if( addr == MAP_FAILED )
+	{
+		throw matrix::ErrMsg::createErrMsg("파일 매핑 실패");
+	}
+
+	mAddr	=	(const char*)addr;
+
+#endif
+}
+
+/**
+ * 소멸자
+ */
+MappedFile::~MappedFile		(	void	)
+{
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	::UnmapViewOfFile(mAddr);
+	::CloseHandle(mMap);
+	::CloseHandle(mFile);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	::munmap((void*)mAddr, mSize);
+
+#endif
+}
+
+/**
+ * CSR 행렬을 이진 파일로 저장
+ * @exception 파일 쓰기 실패 시 예외 발생
+ */
+void		MatrixFile::saveCSR		(	const MatrixCSR&	matrix,		///< 저장 할 행렬
+										const char			fileName[]	///< 파일 이름
+									)
+{
+	if( matrix.mRowStart == NULL )
+	{
+		throw matrix::ErrMsg::createErrMsg("행렬이 비어 있습니다.");
+	}
+
+	writeCSR	(	fileName,
+					matrix.getRow(),
+					matrix.getCol(),
+					matrix.mRowStart,
+					matrix.mColIdx,
+					matrix.mValue
+				);
+}
+
+/**
+ * 이진 CSR 파일을 매핑하여 행렬로 사용
+ * 요소 배열을 복사하지 않고 매핑 된 파일을 그대로 참조하며, 행렬을 수정하면 그 때 복사한다.
+ * 기존 행렬 데이터는 제거된다.
+ * @exception 파일 형식이 올바르지 않거나 매핑 실패 시 예외 발생
+ */
+void		MatrixFile::loadCSR		(	MatrixCSR&		matrix,		///< 읽은 데이터를 가질 행렬
+										const char		fileName[]	///< 파일 이름
+									)
+{
+	MappedFile*		mapping		=	NULL;
+	CSRHeader		header;
+
+	try
+	{
+		mapping		=	new MappedFile(fileName);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	const char*		addr	=	mapping->getAddr();
+
+	try
+	{
+		if( mapping->getSize() < sizeof(CSRHeader) )
+		{
+			throw matrix::ErrMsg::createErrMsg("CSR 파일 형식이 올바르지 않습니다.");
+		}
+
+		memcpy(&header, addr, sizeof(CSRHeader));
+		chkHeader(header, mapping->getSize());
+
+		const char*		rowStart	=	addr + header.rowStartOffset;
+
+		// 행 별 시작 위치가 요소 배열 범위 안에 있는지 확인
+		if( ( readIndex(rowStart, header.indexSize, 0) != 0 ) ||
+			( readIndex(rowStart, header.indexSize, header.rowSize) != header.elemSize ) )
+		{
+			throw matrix::ErrMsg::createErrMsg("CSR 파일 형식이 올바르지 않습니다.");
+		}
+
+		for(size_t row=0;row<header.rowSize;++row)
+		{
+			if( readIndex(rowStart, header.indexSize, row) > readIndex(rowStart, header.indexSize, row+1) )
+			{
+				throw matrix::ErrMsg::createErrMsg("CSR 파일 형식이 올바르지 않습니다.");
+			}
+		}
+
+		if( ( header.colSize > std::numeric_limits<index_t>::max() ) ||
+			( header.elemSize > std::numeric_limits<index_t>::max() ) )
+		{
+			throw matrix::ErrMsg::createErrMsg("현재 환경에서 사용할 수 없는 CSR 파일입니다.");
+		}
+
+		// 매핑을 그대로 쓰는 경우 열 위치를 복사하며 검사하지 않으므로 따로 검사한다.
+		if( header.indexSize == sizeof(index_t) )
+		{
+			chkColIdx	(	(const index_t*)(addr + header.colIdxOffset),
+							(size_t)header.elemSize,
+							header.colSize
+						);
+		}
+	}
+	catch( ErrMsg*	)
+	{
+		delete	mapping;
+		throw;
+	}
+
+	matrix.freeElems();
+
+	if( header.indexSize == sizeof(index_t) )
+	{
+		matrix.mRowSize		=	(size_t)header.rowSize;
+		matrix.mColSize		=	(size_t)header.colSize;
+		matrix.mRowStart	=	(index_t*)(addr + header.rowStartOffset);
+		matrix.mColIdx		=	(index_t*)(addr + header.colIdxOffset);
+		matrix.mValue		=	(elem_t*)(addr + header.valueOffset);
+		matrix.mCapacity	=	(size_t)header.elemSize;
+		matrix.mMapping		=	mapping;
+
+		return;
+	}
+
+	// 위치 형식 크기가 다른 파일은 index_t 배열로 변환하여 복사한다.
+	try
+	{
+		const char*		rowStart	=	addr + header.rowStartOffset;
+		const char*		colIdx		=	addr + header.colIdxOffset;
+		size_t			size		=	(size_t)header.elemSize;
+
+		matrix.allocElems((size_t)header.rowSize, (size_t)header.colSize);
+		matrix.reserveElems(size);
+
+		for(size_t row=0;row<=header.rowSize;++row)
+		{
+			matrix.mRowStart[row]	=	(index_t)readIndex(rowStart, header.indexSize, row);
+		}
+
+		for(size_t pos=0;pos<size;++pos)
+		{
+			uint64_t	col		=	readIndex(colIdx, header.indexSize, pos);
+
+			if( col >= header.colSize )
+			{
+				throw matrix::ErrMsg::createErrMsg("CSR 파일 형식이 올바르지 않습니다.");
+			}
+
+			matrix.mColIdx[pos]		=	(index_t)col;
+		}
+
+		if( size != 0 )
+		{
+			memcpy(matrix.mValue, addr + header.valueOffset, sizeof(elem_t) * size);
+		}
+	}
+	catch( ErrMsg*	)
+	{
+		delete	mapping;
+		matrix.freeElems();
+		throw;
+	}
+
+	delete	mapping;
+}
+
+/**
+ * 텍스트 행렬 파일을 이진 CSR 파일로 변환
+ * 텍스트 파일은 공백으로 구분 된 row x col 개의 값을 행 순서로 가지며, 0이 아닌 값만 저장한다.
+ * @exception 파일 읽기/쓰기 실패 또는 데이터가 올바르지 않을 경우 예외 발생
+ */
+void		MatrixFile::convertText		(	const char		textFileName[],		///< 텍스트 파일 이름
+											size_t			row,				///< 행 크기
+											size_t			col,				///< 열 크기
+											const char		csrFileName[]		///< 이진 CSR 파일 이름
+										)
+{
+	std::vector<index_t>	rowStart;
+	std::vector<index_t>	colIdx;
+	std::vector<elem_t>		value;
+	std::vector<char>		buffer;
+
+	if( col > std::numeric_limits<index_t>::max() )
+	{
+		throw matrix::ErrMsg::createErrMsg("열 크기가 위치 형식 범위를 넘습니다.");
+	}
+
+	try
+	{
+		rowStart.assign(row + 1, 0);
+		buffer.resize(TEXT_CHUNK_SIZE + 1);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	FILE*	file	=	fopen(textFileName, "r");
+
+	if( file == NULL )
+	{
+		throw matrix::ErrMsg::createErrMsg("파일 열기 실패");
+	}
+
+	size_t		total	=	row * col;
+	size_t		count	=	0;
+	size_t		remain	=	0;
+	bool		done	=	false;
+
+	try
+	{
+		// 일정 크기씩 읽어 값을 해석하고, 끝에서 잘린 값은 다음 읽기로 넘긴다.
+		while( ( count < total ) &&
+			   ( done == false ) )
+		{
+			size_t		readSize	=	fread(&buffer[remain], 1, TEXT_CHUNK_SIZE - remain, file);
+			size_t		length		=	remain + readSize;
+			size_t		end			=	length;
+
+			done	=	( readSize < TEXT_CHUNK_SIZE - remain );
+
+			if( done == false )
+			{
+				while( ( end > 0 ) &&
+					   ( isspace((unsigned char)buffer[end-1]) == 0 ) )
+				{
+					end--;
+				}
+
+				if( end == 0 )
+				{
+					throw matrix::ErrMsg::createErrMsg("텍스트 파일 형식이 올바르지 않습니다.");
+				}
+			}
+
+			char	saved	=	buffer[end];
+			char*	pos		=	&buffer[0];
+
+			buffer[end]		=	'\0';
+
+			while( count < total )
+			{
+				char*	next	=	NULL;
+				elem_t	elem	=	strtod(pos, &next);
+
+				if( next == pos )
+				{
+					break;
+				}
+
+				if( elem != 0 )
+				{
+					if( colIdx.size() == std::numeric_limits<index_t>::max() )
+					{
+						throw matrix::ErrMsg::createErrMsg("요소 수가 위치 형식 범위를 넘습니다.");
+					}
+
+					colIdx.push_back(count % col);
+					value.push_back(elem);
+				}
+
+				pos		=	next;
+				count++;
+
+				if( ( count % col ) == 0 )
+				{
+					rowStart[count / col]	=	colIdx.size();
+				}
+			}
+
+			while( isspace((unsigned char)*pos) != 0 )
+			{
+				pos++;
+			}
+
+			if( ( *pos != '\0' ) &&
+				( count < total ) )
+			{
+				throw matrix::ErrMsg::createErrMsg("텍스트 파일 형식이 올바르지 않습니다.");
+			}
+
+			buffer[end]		=	saved;
+			remain			=	length - end;
+			memmove(&buffer[0], &buffer[end], remain);
+		}
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		fclose(file);
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+	catch( ErrMsg*	)
+	{
+		fclose(file);
+		throw;
+	}
+
+	fclose(file);
+
+	if( count < total )
+	{
+		throw matrix::ErrMsg::createErrMsg("텍스트 파일의 데이터가 부족합니다.");
+	}
+
+	writeCSR(csrFileName, row, col, rowStart.data(), colIdx.data(), value.data());
+}
+
+/**
+ * 이진 CSR 파일인지 검사
+ * @return 파일 식별자가 일치하면 true, 아니면 false
+ */
+bool		MatrixFile::isCSRFile		(	const char		fileName[]	///< 파일 이름
+										)
+{
+	bool		ret		=	false;
+	CSRHeader	header;
+	FILE*		file	=	fopen(fileName, "rb");
+
+	if( file != NULL )
+	{
+		if( fread(&header, sizeof(CSRHeader), 1, file) == 1 )
+		{
+			ret		=	( memcmp(header.magic, CSR_FILE_MAGIC, sizeof(CSR_FILE_MAGIC)) == 0 );
+		}
+
+		fclose(file);
+	}
+
+	return	ret;
+}
+
+/**
+ * 이진 CSR 파일 쓰기
+ * @exception 파일 쓰기 실패 시 예외 발생
+ */
+void		MatrixFile::writeCSR		(	const char		fileName[],		///< 파일 이름
+											size_t			row,			///< 행 크기
+											size_t			col,			///< 열 크기
+											const index_t	rowStart[],		///< 행 별 시작 위치
+											const index_t	colIdx[],		///< 요소 열 위치
+											const elem_t	value[]			///< 요소 값
+										)
+{
+	CSRHeader	header;
+	size_t		size	=	rowStart[row];
+
+	memset(&header, 0, sizeof(CSRHeader));
+	memcpy(header.magic, CSR_FILE_MAGIC, sizeof(CSR_FILE_MAGIC));
+
+	header.version			=	CSR_FILE_VERSION;
+	header.headerSize		=	sizeof(CSRHeader);
+	header.byteOrder		=	CSR_FILE_BYTE_ORDER;
+	header.indexSize		=	sizeof(index_t);
+	header.valueSize		=	sizeof(elem_t);
+	header.align			=	CSR_FILE_ALIGN;
+	header.rowSize			=	row;
+	header.colSize			=	col;
+	header.elemSize			=	size;
+	header.rowStartOffset	=	alignOffset(sizeof(CSRHeader));
+	header.colIdxOffset		=	alignOffset(header.rowStartOffset + sizeof(index_t) * (row + 1));
+	header.valueOffset		=	alignOffset(header.colIdxOffset + sizeof(index_t) * size);
+	header.fileSize			=	header.valueOffset + sizeof(elem_t) * size;
+
+	FILE*	file	=	fopen(fileName, "wb");
+
+	if( file == NULL )
+	{
+		throw matrix::ErrMsg::createErrMsg("파일 열기 실패");
+	}
+
+	try
+	{
+		uint64_t	pos		=	0;
+
+		writeBlock(file, &header, sizeof(CSRHeader), 0, pos);
+		writeBlock(file, rowStart, sizeof(index_t) * (row + 1), header.rowStartOffset, pos);
+		writeBlock(file, colIdx, sizeof(index_t) * size, header.colIdxOffset, pos);
+		writeBlock(file, value, sizeof(elem_t) * size, header.valueOffset, pos);
+	}
+	catch( ErrMsg*	)
+	{
+		fclose(file);
+		throw;
+	}
+
+	if( fclose(file) != 0 )
+	{
+		throw matrix::ErrMsg::createErrMsg("파일 쓰기 실패");
+	}
+}
+
+/**
+ * 지정한 위치까지 0으로 채운 후 데이터 쓰기
+ * @exception 파일 쓰기 실패 시 예외 발생
+ */
+void		MatrixFile::writeBlock		(	FILE*			file,		///< 파일
+											const void*		data,		///< 쓸 데이터
+											size_t			size,		///< 쓸 데이터 크기
+											uint64_t		offset,		///< 쓸 위치
+											uint64_t&		pos			///< 현재 파일 위치
+										)
+{
+	static const char	padding[CSR_FILE_ALIGN]	=	{0, };
+
+	if( offset > pos )
+	{
+		if( fwrite(padding, 1, offset - pos, file) != offset - pos )
+		{
+			throw matrix::ErrMsg::createErrMsg("파일 쓰기 실패");
+		}
+
+		pos		=	offset;
+	}
+
+	if( ( size != 0 ) &&
+		( fwrite(data, 1, size, file) != size ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("파일 쓰기 실패");
+	}
+
+	pos		+=	size;
+}
+
+/**
+ * 이진 CSR 파일 헤더 검사
+ * 매핑하여 바로 사용할 수 있도록 형식 크기, 바이트 순서, 배열 위치와 정렬을 확인한다.
+ * 위치 형식은 4 / 8 바이트를 허용하며, index_t와 크기가 다르면 loadCSR에서 변환하여 복사한다.
+
+ * @exception 헤더가 올바르지 않거나 현재 환경에서 사용할 수 없는 형식이면 예외 발생
+ */
+void		MatrixFile::chkHeader		(	const CSRHeader&	header,		///< 파일 헤더
+											size_t				fileSize	///< 파일 크기
+										)
+{
+	if( ( memcmp(header.magic, CSR_FILE_MAGIC, sizeof(CSR_FILE_MAGIC)) != 0 ) ||
+		( header.headerSize != sizeof(CSRHeader) ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("CSR 파일 형식이 올바르지 않습니다.");
+	}
+
+	if( header.version != CSR_FILE_VERSION )
+	{
+		throw matrix::ErrMsg::createErrMsg("지원하지 않는 CSR 파일 버전입니다.");
+	}
+
+	if( ( header.byteOrder != CSR_FILE_BYTE_ORDER ) ||
+		( ( header.indexSize != sizeof(uint32_t) ) && ( header.indexSize != sizeof(uint64_t) ) ) ||
+		( header.valueSize != sizeof(elem_t) ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("현재 환경에서 사용할 수 없는 CSR 파일입니다.");
+	}
+
+	if( ( header.fileSize != fileSize ) ||
+		( ( header.rowStartOffset % CSR_FILE_ALIGN ) != 0 ) ||
+		( ( header.colIdxOffset % CSR_FILE_ALIGN ) != 0 ) ||
+		( ( header.valueOffset % CSR_FILE_ALIGN ) != 0 ) ||
+		( header.rowStartOffset < sizeof(CSRHeader) ) ||
+		( header.rowSize >= header.fileSize / header.indexSize ) ||
+		( header.elemSize > header.fileSize / header.indexSize ) ||
+		( header.colIdxOffset < header.rowStartOffset + header.indexSize * (header.rowSize + 1) ) ||
+		( header.valueOffset < header.colIdxOffset + header.indexSize * header.elemSize ) ||
+		( header.fileSize < header.valueOffset + sizeof(elem_t) * header.elemSize ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("CSR 파일 형식이 올바르지 않습니다.");
+	}
+}
+
+/**
+ * 매핑 된 열 위치 배열 검사
+ * 요소 수가 쓰레드 풀의 최소 작업 크기 이상이면 구간을 나누어 동시에 검사한다.
+ * @exception 열 크기를 넘는 열 위치가 있을 경우 예외 발생
+ */
+void		MatrixFile::chkColIdx		(	const index_t	colIdx[],	///< 열 위치 배열
+											size_t			size,		///< 요소 수
+											uint64_t		colSize		///< 열 크기
+										)
+{
+	ThreadPool&					pool		=	ThreadPool::getInstance();
+	size_t						taskNum		=	pool.isSerial(size) ? 1 : pool.getTaskNum(size);
+	std::vector<ColIdxChunk>	chunk(taskNum);
+	std::vector<void*>			args(taskNum);
+
+	for(size_t num=0;num<taskNum;++num)
+	{
+		chunk[num].colIdx		=	colIdx;
+		chunk[num].start		=	size * num / taskNum;
+		chunk[num].end			=	size * (num + 1) / taskNum;
+		chunk[num].colSize		=	colSize;
+		chunk[num].valid		=	true;
+		args[num]				=	&chunk[num];
+	}
+
+	pool.execute(MatrixFile::threadChkColIdx, args.data(), NULL, taskNum);
+
+	for(size_t num=0;num<taskNum;++num)
+	{
+		if( chunk[num].valid == false )
+		{
+			throw matrix::ErrMsg::createErrMsg("CSR 파일 형식이 올바르지 않습니다.");
+		}
+	}
+}
+
+/**
+ * 이진 CSR 파일의 위치 배열 값 읽기
+ * @return 위치 값
+ */
+uint64_t	MatrixFile::readIndex		(	const char*		addr,		///< 위치 배열 주소
+											uint32_t		indexSize,	///< 위치 형식 크기 (4 / 8)
+											size_t			pos			///< 읽을 위치
+										)
+{
+	if( indexSize == sizeof(uint32_t) )
+	{
+		return	((const uint32_t*)addr)[pos];
+	}
+
+	return	((const uint64_t*)addr)[pos];
+}
+
+/**
+ * Matrix Market 파일 읽기
+ * 기존 행렬 데이터는 제거되고, 파일의 크기와 요소로 다시 채워진다.
+ * @exception 파일 읽기 실패 또는 지원하지 않는 형식일 경우 예외 발생
+ */
+void		MatrixFile::readMtx		(	Matrix&			matrix,		///< 읽은 데이터를 가질 행렬
+										const char		fileName[]	///< 파일 이름
+									)
+{
+	MappedFile		file(fileName);
+	MtxHeader		header;
+
+	readMtxHeader(file, header);
+
+	MatrixBuilder	builder(header.rowSize, header.colSize);
+
+	parseMtx(file, header, builder);
+	builder.build(matrix);
+}
+
+/**
+ * Matrix Market 파일 읽기
+ * 기존 행렬 데이터는 제거되고, 파일의 크기와 요소로 다시 채워진다.
+ * @exception 파일 읽기 실패 또는 지원하지 않는 형식일 경우 예외 발생
+ */
+void		MatrixFile::readMtx		(	MatrixCSR&		matrix,		///< 읽은 데이터를 가질 행렬
+										const char		fileName[]	///< 파일 이름
+									)
+{
+	MappedFile		file(fileName);
+	MtxHeader		header;
+
+	readMtxHeader(file, header);
+
+	MatrixBuilder	builder(header.rowSize, header.colSize);
+
+	parseMtx(file, header, builder);
+	builder.build(matrix);
+}
+
+/**
+ * Matrix Market 파일 읽기
+ * 기존 행렬 데이터는 제거되고, 파일의 크기와 요소로 다시 채워진다.
+ * @exception 파일 읽기 실패 또는 지원하지 않는 형식일 경우 예외 발생
+ */
+void		MatrixFile::readMtx		(	SparseMatrix&	matrix,		///< 읽은 데이터를 가질 행렬
+										const char		fileName[]	///< 파일 이름
+									)
+{
+	MappedFile		file(fileName);
+	MtxHeader		header;
+
+	readMtxHeader(file, header);
+
+	MatrixBuilder	builder(header.rowSize, header.colSize);
+
+	parseMtx(file, header, builder);
+	builder.build(matrix);
+}
+
+/**
+ * Matrix Market 파일 읽기
+ * 기존 행렬 데이터는 제거되고, 파일의 크기와 요소로 다시 채워진다.
+ * @exception 파일 읽기 실패 또는 지원하지 않는 형식일 경우 예외 발생
+ */
+void		MatrixFile::readMtx		(	SparseMatrix2&	matrix,		///< 읽은 데이터를 가질 행렬
+										const char		fileName[]	///< 파일 이름
+									)
+{
+	MappedFile		file(fileName);
+	MtxHeader		header;
+
+	readMtxHeader(file, header);
+
+	MatrixBuilder	builder(header.rowSize, header.colSize);
+
+	parseMtx(file, header, builder);
+	builder.build(matrix);
+}
+
+/**
+ * Matrix Market 파일 쓰기 (array real general)
+ * @exception 파일 쓰기 실패 시 예외 발생
+ */
+void		MatrixFile::writeMtx		(	const Matrix&		matrix,		///< 저장 할 행렬
+											const char			fileName[]	///< 파일 이름
+										)
+{
+	size_t		rowSize		=	matrix.getRow();
+	size_t		colSize		=	matrix.getCol();
+	FILE*		file		=	openMtx(fileName, MTX_ARRAY, rowSize, colSize, rowSize * colSize);
+
+	for(size_t col=0;col<colSize;++col)
+	{
+		for(size_t row=0;row<rowSize;++row)
+		{
+			fprintf(file, "%.17g\n", matrix.mData[row * colSize + col]);
+		}
+	}
+
+	closeMtx(file);
+}
+
+/**
+ * Matrix Market 파일 쓰기 (coordinate real general)
+ * @exception 파일 쓰기 실패 시 예외 발생
+ */
+void		MatrixFile::writeMtx		(	const MatrixCSR&	matrix,		///< 저장 할 행렬
+											const char			fileName[]	///< 파일 이름
+										)
+{
+	size_t		size	=	0;
+
+	for(size_t cnt=0;cnt<matrix.getSize();++cnt)
+	{
+		size	+=	( matrix.mValue[cnt] != 0 ) ? 1 : 0;
+	}
+
+	FILE*		file	=	openMtx(fileName, MTX_COORDINATE, matrix.getRow(), matrix.getCol(), size);
+
+	for(size_t row=0;row<matrix.getRow();++row)
+	{
+		for(size_t cnt=matrix.mRowStart[row];cnt<matrix.mRowStart[row+1];++cnt)
+		{
+			if( matrix.mValue[cnt] != 0 )
+			{
+				fprintf	(	file,
+							"%llu %llu %.17g\n",
+							(unsigned long long)(row + 1),
+							(unsigned long long)(matrix.mColIdx[cnt] + 1),
+							matrix.mValue[cnt]
+						);
+			}
+		}
+	}
+
+	closeMtx(file);
+}
+
+/**
+ * Matrix Market 파일 쓰기 (coordinate real general)
+ * @exception 파일 쓰기 실패 시 예외 발생
+ */
+void		MatrixFile::writeMtx		(	const SparseMatrix&		matrix,		///< 저장 할 행렬
+											const char				fileName[]	///< 파일 이름
+										)
+{
+	size_t		size	=	0;
+
+	matrix.chkSorted();
+
+	for(size_t row=0;row<matrix.getRow();++row)
+	{
+		const SparseMatrix::row_t&	vec		=	matrix.mData[row].mVector;
+
+		for(size_t cnt=0;cnt<vec.size();++cnt)
+		{
+			size	+=	( vec[cnt].mElem != 0 ) ? 1 : 0;
+		}
+	}
+
+	FILE*		file	=	openMtx(fileName, MTX_COORDINATE, matrix.getRow(), matrix.getCol(), size);
+
+	for(size_t row=0;row<matrix.getRow();++row)
+	{
+		const SparseMatrix::row_t&	vec		=	matrix.mData[row].mVector;
+
+		for(size_t cnt=0;cnt<vec.size();++cnt)
+		{
+			if( vec[cnt].mElem != 0 )
+			{
+				fprintf	(	file,
+							"%llu %llu %.17g\n",
+							(unsigned long long)(row + 1),
+							(unsigned long long)(vec[cnt].mCol + 1),
+							vec[cnt].mElem
+						);
+			}
+		}
+	}
+
+	closeMtx(file);
+}
+
+/**
+ * Matrix Market 파일 쓰기 (coordinate real general)
+ * @exception 파일 쓰기 실패 시 예외 발생
+ */
+void		MatrixFile::writeMtx		(	const SparseMatrix2&	matrix,		///< 저장 할 행렬
+											const char				fileName[]	///< 파일 이름
+										)
+{
+	size_t		size	=	0;
+
+	for(size_t row=0;row<matrix.getRow();++row)
+	{
+		const SparseMatrix2::map_t&		map		=	matrix.mData[row].mMap;
+
+		for(elem_map_itor itor=map.begin();itor!=map.end();++itor)
+		{
+			size	+=	( itor->second != 0 ) ? 1 : 0;
+		}
+	}
+
+	FILE*		file	=	openMtx(fileName, MTX_COORDINATE, matrix.getRow(), matrix.getCol(), size);
+
+	for(size_t row=0;row<matrix.getRow();++row)
+	{
+		const SparseMatrix2::map_t&		map		=	matrix.mData[row].mMap;
+
+		for(elem_map_itor itor=map.begin();itor!=map.end();++itor)
+		{
+			if( itor->second != 0 )
+			{
+				fprintf	(	file,
+							"%llu %llu %.17g\n",
+							(unsigned long long)(row + 1),
+							(unsigned long long)(itor->first + 1),
+							itor->second
+						);
+			}
+		}
+	}
+
+	closeMtx(file);
+}
+
+/**
+ * Matrix Market 파일 머리 (배너, 설명, 크기) 해석
+ * @exception 지원하지 않는 형식이거나 머리가 올바르지 않을 경우 예외 발생
+ */
+void		MatrixFile::readMtxHeader	(	const MappedFile&	file,		///< 매핑 된 파일
+											MtxHeader&			header		///< 해석 결과
+										)
+{
+	const char*		addr		=	file.getAddr();
+	const char*		end			=	addr + file.getSize();
+	const char*		lineEnd		=	findLineEnd(addr, end);
+	std::string		banner(addr, lineEnd);
+	char			word[5][32];
+
+	std::transform(banner.begin(), banner.end(), banner.begin(), ::tolower);
+
+	if( ( sscanf(banner.c_str(), "%31s %31s %31s %31s %31s", word[0], word[1], word[2], word[3], word[4]) != 5 ) ||
+		( strcmp(word[0], "%%matrixmarket") != 0 ) ||
+		( strcmp(word[1], "matrix") != 0 ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("Matrix Market 파일 형식이 올바르지 않습니다.");
+	}
+
+	if( strcmp(word[2], "coordinate") == 0 )
+	{
+		header.format	=	MTX_COORDINATE;
+	}
+	else if( strcmp(word[2], "array") == 0 )
+	{
+		header.format	=	MTX_ARRAY;
+	}
+	else
+	{
+		throw matrix::ErrMsg::createErrMsg("지원하지 않는 Matrix Market 형식입니다.");
+	}
+
+	if( ( strcmp(word[3], "real") == 0 ) ||
+		( strcmp(word[3], "double") == 0 ) )
+	{
+		header.field	=	MTX_REAL;
+	}
+	else if( strcmp(word[3], "integer") == 0 )
+	{
+		header.field	=	MTX_INTEGER;
+	}
+	else if( ( strcmp(word[3], "pattern") == 0 ) &&
+			 ( header.format == MTX_COORDINATE ) )
+	{
+		header.field	=	MTX_PATTERN;
+	}
+	else
+	{
+		throw matrix::ErrMsg::createErrMsg("지원하지 않는 Matrix Market 값 형식입니다.");
+	}
+
+	if( strcmp(word[4], "general") == 0 )
+	{
+		header.symmetry		=	MTX_GENERAL;
+	}
+	else if( strcmp(word[4], "symmetric") == 0 )
+	{
+		header.symmetry		=	MTX_SYMMETRIC;
+	}
+	else if( strcmp(word[4], "skew-symmetric") == 0 )
+	{
+		header.symmetry		=	MTX_SKEW_SYMMETRIC;
+	}
+	else
+	{
+		throw matrix::ErrMsg::createErrMsg("지원하지 않는 Matrix Market 대칭 형식입니다.");
+	}
+
+	// 설명 줄과 빈 줄을 건너뛰고 크기 줄 해석
+	const char*		pos		=	lineEnd;
+
+	while( pos < end )
+	{
+		pos			=	pos + 1;
+		lineEnd		=	findLineEnd(pos, end);
+
+		const char*		text	=	skipSpace(pos, lineEnd);
+
+		if( ( text == lineEnd ) ||
+			( *text == '%' ) )
+		{
+			pos		=	lineEnd;
+			continue;
+		}
+
+		bool	ret		=	parseIndex(text, lineEnd, header.rowSize) &&
+							parseIndex(text, lineEnd, header.colSize);
+
+		if( header.format == MTX_COORDINATE )
+		{
+			ret		=	ret && parseIndex(text, lineEnd, header.entrySize);
+		}
+		else if( header.symmetry == MTX_GENERAL )
+		{
+			header.entrySize	=	header.rowSize * header.colSize;
+		}
+		else if( header.symmetry == MTX_SYMMETRIC )
+		{
+			header.entrySize	=	header.rowSize * (header.rowSize + 1) / 2;
+		}
+		else
+		{
+			header.entrySize	=	header.rowSize * (header.rowSize - 1) / 2;
+		}
+
+		if( ( ret == false ) ||
+			( skipSpace(text, lineEnd) != lineEnd ) ||
+			( header.rowSize == 0 ) ||
+			( header.colSize == 0 ) ||
+			( ( header.symmetry != MTX_GENERAL ) && ( header.rowSize != header.colSize ) ) )
+		{
+			throw matrix::ErrMsg::createErrMsg("Matrix Market 파일 크기 정보가 올바르지 않습니다.");
+		}
+
+		header.dataOffset	=	( lineEnd < end ) ? ( lineEnd + 1 - addr ) : ( lineEnd - addr );
+		return;
+	}
+
+	throw matrix::ErrMsg::createErrMsg("Matrix Market 파일 크기 정보가 없습니다.");
+}
+
+/**
+ * Matrix Market 파일 값 목록 해석
+ * 1. 값 목록을 줄 경계에 맞춰 구간으로 나누고 구간 별 값 수를 센다.
+ * 2. 구간 별 빌더 기록 위치를 정한 후 각 구간을 동시에 해석하여 빌더 요소 배열에 바로 쓴다.
+ * 3. 0 값이나 대각 요소로 인해 비어 있는 공간을 제거한다.
+ * @exception 값 목록이 올바르지 않거나 메모리 할당 실패 시 예외 발생
+ */
+void		MatrixFile::parseMtx		(	const MappedFile&	file,		///< 매핑 된 파일
+											const MtxHeader&	header,		///< 파일 머리
+											MatrixBuilder&		builder		///< 요소를 채울 빌더
+										)
+{
+	const char*		data		=	file.getAddr() + header.dataOffset;
+	const char*		end			=	file.getAddr() + file.getSize();
+	size_t			dataSize	=	end - data;
+	size_t			chunkNum	=	dataSize / MTX_CHUNK_MIN_SIZE;
+	size_t			base		=	builder.getSize();
+	size_t			total		=	0;
+	size_t			entryNum	=	0;
+
+	chunkNum	=	std::max((size_t)1, std::min(chunkNum, (size_t)MTX_TASK_NUM));
+
+	std::vector<MtxChunk>	chunk;
+	std::vector<void*>		args;
+
+	try
+	{
+		chunk.resize(chunkNum);
+		args.resize(chunkNum);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	for(size_t cnt=0;cnt<chunkNum;++cnt)
+	{
+		const char*		start	=	data + dataSize / chunkNum * cnt;
+
+		if( cnt != 0 )
+		{
+			start	=	findLineEnd(start - 1, end);
+			start	=	( start < end ) ? start + 1 : end;
+			chunk[cnt-1].end	=	start;
+		}
+
+		chunk[cnt].header		=	&header;
+		chunk[cnt].builder		=	&builder;
+		chunk[cnt].start		=	start;
+		chunk[cnt].end			=	end;
+		chunk[cnt].entryNum		=	0;
+		chunk[cnt].elemNum		=	0;
+		chunk[cnt].error		=	NULL;
+		args[cnt]				=	&chunk[cnt];
+	}
+
+	// 1. 구간 별 값 수 계산
+	ThreadPool::getInstance().execute(MatrixFile::threadCountMtx, args.data(), NULL, chunkNum);
+
+	for(size_t cnt=0;cnt<chunkNum;++cnt)
+	{
+		chunk[cnt].firstEntry	=	entryNum;
+		chunk[cnt].offset		=	base + total;
+
+		entryNum	+=	chunk[cnt].entryNum;
+		total		+=	chunk[cnt].entryNum * ( ( header.symmetry == MTX_GENERAL ) ? 1 : 2 );
+	}
+
+	if( entryNum != header.entrySize )
+	{
+		throw matrix::ErrMsg::createErrMsg("Matrix Market 파일의 값 수가 올바르지 않습니다.");
+	}
+
+	try
+	{
+		builder.mRow.resize(base + total);
+		builder.mCol.resize(base + total);
+		builder.mElem.resize(base + total);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	builder.mCompressed		=	false;
+
+	// 2. 구간 별 해석
+	ThreadPool::getInstance().execute(MatrixFile::threadParseMtx, args.data(), NULL, chunkNum);
+
+	size_t		pos		=	base;
+
+	for(size_t cnt=0;cnt<chunkNum;++cnt)
+	{
+		if( chunk[cnt].error != NULL )
+		{
+			builder.mRow.resize(base);
+			builder.mCol.resize(base);
+			builder.mElem.resize(base);
+			throw matrix::ErrMsg::createErrMsg(chunk[cnt].error);
+		}
+
+		// 3. 빈 공간 제거
+		if( pos != chunk[cnt].offset )
+		{
+			std::copy	(	builder.mRow.begin() + chunk[cnt].offset,
+							builder.mRow.begin() + chunk[cnt].offset + chunk[cnt].elemNum,
+							builder.mRow.begin() + pos
+						);
+			std::copy	(	builder.mCol.begin() + chunk[cnt].offset,
+							builder.mCol.begin() + chunk[cnt].offset + chunk[cnt].elemNum,
+							builder.mCol.begin() + pos
+						);
+			std::copy	(	builder.mElem.begin() + chunk[cnt].offset,
+							builder.mElem.begin() + chunk[cnt].offset + chunk[cnt].elemNum,
+							builder.mElem.begin() + pos
+						);
+		}
+
+		pos		+=	chunk[cnt].elemNum;
+	}
+
+	builder.mRow.resize(pos);
+	builder.mCol.resize(pos);
+	builder.mElem.resize(pos);
+}
+
+/**
+ * Matrix Market 파일 열기 및 머리 쓰기
+ * @return 열린 파일
+ * @exception 파일 열기 실패 시 예외 발생
+ */
+FILE*		MatrixFile::openMtx		(	const char		fileName[],		///< 파일 이름
+										MtxFormat		format,			///< 저장 형식
+										size_t			row,			///< 행 크기
+										size_t			col,			///< 열 크기
+										size_t			size			///< 값 수
+									)
+{
+	FILE*	file	=	fopen(fileName, "w");
+
+	if( file == NULL )
+	{
+		throw matrix::ErrMsg::createErrMsg("파일 열기 실패");
+	}
+
+	setvbuf(file, NULL, _IOFBF, MTX_WRITE_BUFFER_SIZE);
+
+	if( format == MTX_COORDINATE )
+	{
+		fprintf(file, "%%%%MatrixMarket matrix coordinate real general\n");
+		fprintf(file, "%llu %llu %llu\n", (unsigned long long)row, (unsigned long long)col, (unsigned long long)size);
+	}
+	else
+	{
+		fprintf(file, "%%%%MatrixMarket matrix array real general\n");
+		fprintf(file, "%llu %llu\n", (unsigned long long)row, (unsigned long long)col);
+	}
+
+	return	file;
+}
+
+/**
+ * Matrix Market 파일 닫기
+ * @exception 파일 쓰기 실패 시 예외 발생
+ */
+void		MatrixFile::closeMtx		(	FILE*		file	///< 닫을 파일
+										)
+{
+	bool	error	=	( ferror(file) != 0 );
+
+	if( ( fclose(file) != 0 ) ||
+		( error == true ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("파일 쓰기 실패");
+	}
+}
+
+/**
+ * 구간의 값 수 계산 (빈 줄과 설명 줄 제외)
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixFile::threadCountMtx		(	void*	pData	)
+{
+	MtxChunk*		chunk	=	(MtxChunk*)pData;
+	const char*		pos		=	chunk->start;
+	size_t			count	=	0;
+
+	while( pos < chunk->end )
+	{
+		const char*		lineEnd		=	findLineEnd(pos, chunk->end);
+		const char*		text		=	skipSpace(pos, lineEnd);
+
+		if( ( text != lineEnd ) &&
+			( *text != '%' ) )
+		{
+			count++;
+		}
+
+		pos		=	lineEnd + 1;
+	}
+
+	chunk->entryNum		=	count;
+
+	return	0;
+}
+
+/**
+ * 구간의 값 해석
+ * 빌더 요소 배열의 구간 기록 위치부터 순서대로 쓰며, 대칭 행렬은 반대쪽 요소를 함께 쓴다.
+ * 해석에 실패하면 사유를 기록하고 중단한다.
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixFile::threadParseMtx		(	void*	pData	)
+{
+	MtxChunk*			chunk		=	(MtxChunk*)pData;
+	const MtxHeader&	header		=	*chunk->header;
+	size_t*				rowOut		=	chunk->builder->mRow.data();
+	size_t*				colOut		=	chunk->builder->mCol.data();
+	elem_t*				elemOut		=	chunk->builder->mElem.data();
+	size_t				out			=	chunk->offset;
+	const char*			pos			=	chunk->start;
+	size_t				skew		=	( header.symmetry == MTX_SKEW_SYMMETRIC ) ? 1 : 0;
+	size_t				arrayRow	=	0;
+	size_t				arrayCol	=	0;
+
+	// array 형식의 구간 첫 값 위치 계산 (열 순서)
+	if( header.format == MTX_ARRAY )
+	{
+		if( header.symmetry == MTX_GENERAL )
+		{
+			arrayCol	=	chunk->firstEntry / header.rowSize;
+			arrayRow	=	chunk->firstEntry % header.rowSize;
+		}
+		else
+		{
+			size_t		remain	=	chunk->firstEntry;
+
+			while( ( arrayCol < header.colSize ) &&
+				   ( remain >= header.rowSize - arrayCol - skew ) )
+			{
+				remain	-=	header.rowSize - arrayCol - skew;
+				arrayCol++;
+			}
+
+			arrayRow	=	arrayCol + skew + remain;
+		}
+	}
+
+	while( pos < chunk->end )
+	{
+		const char*		lineEnd		=	findLineEnd(pos, chunk->end);
+		const char*		text		=	skipSpace(pos, lineEnd);
+		size_t			row			=	0;
+		size_t			col			=	0;
+		elem_t			elem		=	1;
+
+		pos		=	lineEnd + 1;
+
+		if( ( text == lineEnd ) ||
+			( *text == '%' ) )
+		{
+			continue;
+		}
+
+		if( header.format == MTX_COORDINATE )
+		{
+			if( ( parseIndex(text, lineEnd, row) == false ) ||
+				( parseIndex(text, lineEnd, col) == false ) ||
+				( ( header.field != MTX_PATTERN ) && ( parseElem(text, lineEnd, elem) == false ) ) )
+			{
+				chunk->error	=	"Matrix Market 파일의 값을 해석할 수 없습니다.";
+				break;
+			}
+
+			if( ( row == 0 ) || ( row > header.rowSize ) ||
+				( col == 0 ) || ( col > header.colSize ) )
+			{
+				chunk->error	=	"Matrix Market 파일의 요소 위치가 범위를 넘어섭니다.";
+				break;
+			}
+
+			row--;
+			col--;
+		}
+		else
+		{
+			if( parseElem(text, lineEnd, elem) == false )
+			{
+				chunk->error	=	"Matrix Market 파일의 값을 해석할 수 없습니다.";
+				break;
+			}
+
+			row		=	arrayRow;
+			col		=	arrayCol;
+
+			if( ++arrayRow == header.rowSize )
+			{
+				arrayCol++;
+				arrayRow	=	( header.symmetry == MTX_GENERAL ) ? 0 : arrayCol + skew;
+			}
+		}
+
+		if( skipSpace(text, lineEnd) != lineEnd )
+		{
+			chunk->error	=	"Matrix Market 파일의 값을 해석할 수 없습니다.";
+			break;
+		}
+
+		if( elem != 0 )
+		{
+			rowOut[out]		=	row;
+			colOut[out]		=	col;
+			elemOut[out]	=	elem;
+			out++;
+
+			if( ( header.symmetry != MTX_GENERAL ) &&
+				( row != col ) )
+			{
+				rowOut[out]		=	col;
+				colOut[out]		=	row;
+				elemOut[out]	=	( skew != 0 ) ? -elem : elem;
+				out++;
+			}
+		}
+	}
+
+	chunk->elemNum		=	out - chunk->offset;
+
+	return	0;
+}
+
+/**
+ * 구간의 열 위치 검사
+ * @return 사용 안 함
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	MatrixFile::threadChkColIdx		(	void*	pData	)
+{
+	ColIdxChunk*		chunk		=	(ColIdxChunk*)pData;
+
+	for(size_t pos=chunk->start;pos<chunk->end;++pos)
+	{
+		if( chunk->colIdx[pos] >= chunk->colSize )
+		{
+			chunk->valid	=	false;
+			break;
+		}
+	}
+
+	return	0;
+}
+
+};
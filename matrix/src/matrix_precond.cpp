@@ -0,0 +1,626 @@
+/*
+ * matrix_precond.cpp
+ *
+ *  Created on: 2015. 8. 10.
+ *      Author: asran
+ */
+
+#include "matrix_precond.h"
+#include "matrix_csr.h"
+#include "matrix_error.h"
+#include "thread_pool.h"
+#include <math.h>
+#include <new>
+
+namespace matrix
+{
+
+/**
+ * 생성자
+ */
+template<class T, class I>
+BasicPreconditioner<T, I>::BasicPreconditioner		(	void	)
+:mRowSize(0)
+{
+}
+
+/**
+ * 소멸자
+ */
+template<class T, class I>
+BasicPreconditioner<T, I>::~BasicPreconditioner		(	void	)
+{
+}
+
+/**
+ * CSR 행렬을 행 별로 열 순서로 정렬 된 배열에 복사
+ * @exception 메모리 할당 실패 시 에러 발생
+ */
+template<class T, class I>
+void		BasicPreconditioner<T, I>::loadMatrix		(	const BasicMatrixCSR<T, I>&		matrix,		///< 원본 행렬
+												std::vector<index_t>&	rowStart,	///< 행 별 시작 위치
+												std::vector<index_t>&	col,		///< 열 위치
+												std::vector<elem_t>&	val			///< 요소 값
+											)
+{
+	size_t		row		=	matrix.getRow();
+	size_t		size	=	matrix.mRowStart[row];
+
+	try
+	{
+		std::vector< basic_node_t<T, I> >		vec;
+
+		rowStart.assign(matrix.mRowStart, matrix.mRowStart + row + 1);
+		col.resize(size);
+		val.resize(size);
+
+		for(size_t cnt=0;cnt<row;++cnt)
+		{
+			vec.clear();
+
+			for(size_t pos=rowStart[cnt];pos<rowStart[cnt+1];++pos)
+			{
+				vec.push_back(basic_node_t<T, I>(matrix.mColIdx[pos], matrix.mValue[pos]));
+			}
+
+			std::sort(vec.begin(), vec.end());
+
+			for(size_t pos=0;pos<vec.size();++pos)
+			{
+				col[rowStart[cnt] + pos]	=	vec[pos].mCol;
+				val[rowStart[cnt] + pos]	=	vec[pos].mElem;
+			}
+		}
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+}
+
+/**
+ * 삼각 행렬의 행 별 수준 계산
+ * 행의 수준은 그 행이 참조하는 행들의 수준 중 가장 큰 값 + 1 이다.
+ * 아래 삼각 행렬은 앞 행부터, 위 삼각 행렬은 뒤 행부터 계산한다.
+ */
+template<class T, class I>
+void		BasicPreconditioner<T, I>::buildLevels		(	Factor&		factor,		///< 삼각 행렬
+												bool		lower		///< 아래 삼각 행렬 여부
+											)
+{
+	size_t					row			=	factor.rowStart.size() - 1;
+	std::vector<size_t>		level(row, 0);
+	size_t					levelNum	=	0;
+
+	for(size_t cnt=0;cnt<row;++cnt)
+	{
+		size_t		cur		=	( lower == true ) ? cnt : row - 1 - cnt;
+		size_t		lv		=	0;
+
+		for(size_t pos=factor.rowStart[cur];pos<factor.rowStart[cur+1];++pos)
+		{
+			lv		=	std::max(lv, level[factor.col[pos]] + 1);
+		}
+
+		level[cur]	=	lv;
+		levelNum	=	std::max(levelNum, lv + 1);
+	}
+
+	// 수준 별 계수 정렬
+	factor.levelStart.assign(levelNum + 1, 0);
+	factor.levelRow.resize(row);
+
+	for(size_t cnt=0;cnt<row;++cnt)
+	{
+		factor.levelStart[level[cnt] + 1]++;
+	}
+
+	for(size_t lv=0;lv<levelNum;++lv)
+	{
+		factor.levelStart[lv + 1]	+=	factor.levelStart[lv];
+	}
+
+	std::vector<size_t>		pos(factor.levelStart.begin(), factor.levelStart.end() - 1);
+
+	for(size_t cnt=0;cnt<row;++cnt)
+	{
+		factor.levelRow[pos[level[cnt]]++]	=	cnt;
+	}
+}
+
+/**
+ * 삼각 방정식 풀기 (factor * x = b)
+ * 수준 순서로 풀고, 한 수준의 작업 크기가 쓰레드 풀의 최소 작업 크기 이상이면 나누어 푼다.
+ * 수준의 작업 크기는 행 수 x 행 당 평균 요소 수로 어림한다.
+ * b와 x는 같은 배열이어도 된다.
+ */
+template<class T, class I>
+void		BasicPreconditioner<T, I>::solve		(	const Factor&	factor,		///< 삼각 행렬
+											const elem_t	b[],		///< 우변 벡터
+											elem_t			x[]			///< 해 벡터
+										)
+{
+	ThreadPool&	pool		=	ThreadPool::getInstance();
+	size_t		levelNum	=	factor.levelStart.size() - 1;
+	size_t		rowNum		=	factor.rowStart.size() - 1;
+	size_t		rowElem		=	( rowNum == 0 ) ? 1 : ( factor.col.size() / rowNum + 1 );
+
+	for(size_t lv=0;lv<levelNum;++lv)
+	{
+		size_t		start		=	factor.levelStart[lv];
+		size_t		end			=	factor.levelStart[lv + 1];
+		size_t		threadNum	=	pool.isSerial((end - start) * rowElem) ? 1 : pool.getTaskNum(end - start);
+
+		if( threadNum == 1 )
+		{
+			solveRows(factor, b, x, start, end);
+			continue;
+		}
+
+		std::vector<SolveInfo>	info(threadNum);
+		std::vector<void*>		args(threadNum);
+
+		for(size_t num=0;num<threadNum;++num)
+		{
+			info[num].factor	=	&factor;
+			info[num].b			=	b;
+			info[num].x			=	x;
+			info[num].start		=	start + (end - start) * num / threadNum;
+			info[num].end		=	start + (end - start) * (num + 1) / threadNum;
+
+			args[num]	=	&info[num];
+		}
+
+		// 쓰레드 풀에서 수행
+		pool.execute	(	BasicPreconditioner::threadSolve,
+							&args[0],
+							NULL,
+							threadNum
+						);
+	}
+}
+
+/**
+ * 정방 행렬인지 검사
+ * @exception 정방 행렬이 아닐 경우 예외 발생
+ */
+template<class T, class I>
+void		BasicPreconditioner<T, I>::chkSquare		(	const BasicMatrixCSR<T, I>&	matrix	///< 검사 할 행렬
+											)
+{
+	if( matrix.getRow() != matrix.getCol() )
+	{
+		throw matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
+	}
+}
+
+/**
+ * 지정한 범위의 행에 대한 삼각 방정식 풀기
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicPreconditioner<T, I>::threadSolve		(	void*	pData	)
+{
+	SolveInfo*		info	=	(SolveInfo*)pData;
+
+	solveRows(*info->factor, info->b, info->x, info->start, info->end);
+
+	return	NULL;
+}
+
+/**
+ * levelRow[start, end) 행에 대한 삼각 방정식 풀기
+ */
+template<class T, class I>
+void		BasicPreconditioner<T, I>::solveRows		(	const Factor&	factor,		///< 삼각 행렬
+												const elem_t	b[],		///< 우변 벡터
+												elem_t			x[],		///< 해 벡터
+												size_t			start,		///< 시작 위치
+												size_t			end			///< 종료 위치 (미포함)
+											)
+{
+	bool		unit	=	factor.diag.empty();
+
+	for(size_t cnt=start;cnt<end;++cnt)
+	{
+		size_t		row		=	factor.levelRow[cnt];
+		elem_t		sum		=	b[row];
+
+		for(size_t pos=factor.rowStart[row];pos<factor.rowStart[row+1];++pos)
+		{
+			sum		-=	factor.val[pos] * x[factor.col[pos]];
+		}
+
+		x[row]	=	( unit == true ) ? sum : sum / factor.diag[row];
+	}
+}
+
+/////////////////////////////
+
+/**
+ * 생성자
+ * 대각 요소가 0인 행은 1로 처리한다.
+ */
+template<class T, class I>
+BasicJacobiPrecond<T, I>::BasicJacobiPrecond		(	const BasicMatrixCSR<T, I>&	matrix	///< 계수 행렬
+									)
+{
+	chkSquare(matrix);
+
+	mRowSize	=	matrix.getRow();
+
+	try
+	{
+		mInvDiag.assign(mRowSize, 1);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		elem_t		diag	=	matrix.getElem(row, row);
+
+		if( diag != elem_t(0) )
+		{
+			mInvDiag[row]	=	elem_t(1) / diag;
+		}
+	}
+}
+
+/**
+ * 소멸자
+ */
+template<class T, class I>
+BasicJacobiPrecond<T, I>::~BasicJacobiPrecond		(	void	)
+{
+}
+
+/**
+ * 전처리 적용 (z = D^-1 * r)
+ */
+template<class T, class I>
+void		BasicJacobiPrecond<T, I>::apply		(	const elem_t	r[],	///< 잔차 벡터
+											elem_t			z[]		///< 결과 벡터
+										) const
+{
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		z[row]	=	mInvDiag[row] * r[row];
+	}
+}
+
+/////////////////////////////
+
+/**
+ * 생성자
+ * A의 아래 삼각 부분과 같은 모양으로 L을 계산한다.
+ * L(i,k) = ( A(i,k) - sum_j<k L(i,j) * L(k,j) ) / L(k,k)
+ * L(i,i) = sqrt( A(i,i) - sum_j<i L(i,j)^2 )
+ * @exception 정방 행렬이 아니거나, 분해 중 대각 요소가 양수가 아니면 예외 발생
+ */
+template<class T, class I>
+BasicIC0Precond<T, I>::BasicIC0Precond		(	const BasicMatrixCSR<T, I>&	matrix	///< 계수 행렬 (대칭 양의 정부호)
+							)
+{
+	chkSquare(matrix);
+
+	mRowSize	=	matrix.getRow();
+
+	std::vector<index_t>	rowStart;
+	std::vector<index_t>	col;
+	std::vector<elem_t>		val;
+
+	loadMatrix(matrix, rowStart, col, val);
+
+	try
+	{
+		// 아래 삼각 부분 (대각 제외) 만 남긴다.
+		mLower.rowStart.assign(mRowSize + 1, 0);
+		mLower.diag.assign(mRowSize, 0);
+
+		for(size_t row=0;row<mRowSize;++row)
+		{
+			for(size_t pos=rowStart[row];pos<rowStart[row+1];++pos)
+			{
+				if( col[pos] < row )
+				{
+					mLower.col.push_back(col[pos]);
+					mLower.val.push_back(val[pos]);
+				}
+				else if( col[pos] == row )
+				{
+					mLower.diag[row]	=	val[pos];
+				}
+			}
+
+			mLower.rowStart[row+1]	=	mLower.col.size();
+		}
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	// 행 단위 분해 : 각 행은 열 순서로 정렬 되어 있으므로 두 행의 공통 열은 병합으로 찾는다.
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		size_t		start	=	mLower.rowStart[row];
+		size_t		end		=	mLower.rowStart[row+1];
+
+		for(size_t pos=start;pos<end;++pos)
+		{
+			size_t		k		=	mLower.col[pos];
+			elem_t		sum		=	mLower.val[pos];
+			size_t		posI	=	start;
+			size_t		posK	=	mLower.rowStart[k];
+
+			while( ( posI < pos ) &&
+				   ( posK < mLower.rowStart[k+1] ) )
+			{
+				if( mLower.col[posI] == mLower.col[posK] )
+				{
+					sum		-=	mLower.val[posI++] * mLower.val[posK++];
+				}
+				else if( mLower.col[posI] < mLower.col[posK] )
+				{
+					posI++;
+				}
+				else
+				{
+					posK++;
+				}
+			}
+
+			mLower.val[pos]		=	sum / mLower.diag[k];
+		}
+
+		elem_t		diag	=	mLower.diag[row];
+
+		for(size_t pos=start;pos<end;++pos)
+		{
+			diag	-=	mLower.val[pos] * mLower.val[pos];
+		}
+
+		if( elem_traits<T>::isPositive(diag) != true )
+		{
+			throw matrix::ErrMsg::createErrMsg("불완전 Cholesky 분해에 실패하였습니다.");
+		}
+
+		mLower.diag[row]	=	std::sqrt(diag);
+	}
+
+	// L^T 는 L을 열 기준으로 다시 모아 만든다.
+	try
+	{
+		mUpper.rowStart.assign(mRowSize + 1, 0);
+		mUpper.col.resize(mLower.col.size());
+		mUpper.val.resize(mLower.val.size());
+		mUpper.diag		=	mLower.diag;
+
+		for(size_t pos=0;pos<mLower.col.size();++pos)
+		{
+			mUpper.rowStart[mLower.col[pos] + 1]++;
+		}
+
+		for(size_t row=0;row<mRowSize;++row)
+		{
+			mUpper.rowStart[row + 1]	+=	mUpper.rowStart[row];
+		}
+
+		std::vector<size_t>		next(mUpper.rowStart.begin(), mUpper.rowStart.end() - 1);
+
+		for(size_t row=0;row<mRowSize;++row)
+		{
+			for(size_t pos=mLower.rowStart[row];pos<mLower.rowStart[row+1];++pos)
+			{
+				size_t		dst		=	next[mLower.col[pos]]++;
+
+				mUpper.col[dst]		=	row;
+				mUpper.val[dst]		=	mLower.val[pos];
+			}
+		}
+
+		buildLevels(mLower, true);
+		buildLevels(mUpper, false);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+}
+
+/**
+ * 소멸자
+ */
+template<class T, class I>
+BasicIC0Precond<T, I>::~BasicIC0Precond		(	void	)
+{
+}
+
+/**
+ * 전처리 적용 (L * L^T * z = r)
+ */
+template<class T, class I>
+void		BasicIC0Precond<T, I>::apply		(	const elem_t	r[],	///< 잔차 벡터
+										elem_t			z[]		///< 결과 벡터
+									) const
+{
+	solve(mLower, r, z);
+	solve(mUpper, z, z);
+}
+
+/////////////////////////////
+
+/**
+ * 생성자
+ * A와 같은 모양에서 IKJ 순서로 분해한다.
+ * 행 i의 k < i 요소마다 A(i,k) /= U(k,k) 후, 행 i에 있는 j > k 위치에 대해 A(i,j) -= A(i,k) * U(k,j)
+ * @exception 정방 행렬이 아니거나, 분해 중 대각 요소가 0이면 예외 발생
+ */
+template<class T, class I>
+BasicILU0Precond<T, I>::BasicILU0Precond		(	const BasicMatrixCSR<T, I>&	matrix	///< 계수 행렬
+								)
+{
+	chkSquare(matrix);
+
+	mRowSize	=	matrix.getRow();
+
+	std::vector<index_t>	rowStart;
+	std::vector<index_t>	col;
+	std::vector<elem_t>		val;
+	std::vector<size_t>		diagPos;
+	std::vector<size_t>		marker;
+
+	loadMatrix(matrix, rowStart, col, val);
+
+	try
+	{
+		diagPos.assign(mRowSize, (size_t)-1);
+		marker.assign(mRowSize, (size_t)-1);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	for(size_t row=0;row<mRowSize;++row)
+	{
+		for(size_t pos=rowStart[row];pos<rowStart[row+1];++pos)
+		{
+			marker[col[pos]]	=	pos;
+
+			if( col[pos] == row )
+			{
+				diagPos[row]	=	pos;
+			}
+		}
+
+		if( ( diagPos[row] == (size_t)-1 ) ||
+			( val[diagPos[row]] == elem_t(0) ) )
+		{
+			throw matrix::ErrMsg::createErrMsg("불완전 LU 분해에 실패하였습니다.");
+		}
+
+		for(size_t pos=rowStart[row];( pos < rowStart[row+1] ) && ( col[pos] < row );++pos)
+		{
+			size_t		k		=	col[pos];
+
+			val[pos]	/=	val[diagPos[k]];
+
+			for(size_t posK=diagPos[k]+1;posK<rowStart[k+1];++posK)
+			{
+				size_t		target	=	marker[col[posK]];
+
+				if( ( target != (size_t)-1 ) &&
+					( target >= rowStart[row] ) &&
+					( target < rowStart[row+1] ) )
+				{
+					val[target]		-=	val[pos] * val[posK];
+				}
+			}
+		}
+
+		if( val[diagPos[row]] == elem_t(0) )
+		{
+			throw matrix::ErrMsg::createErrMsg("불완전 LU 분해에 실패하였습니다.");
+		}
+	}
+
+	try
+	{
+		mLower.rowStart.assign(mRowSize + 1, 0);
+		mUpper.rowStart.assign(mRowSize + 1, 0);
+		mUpper.diag.resize(mRowSize);
+
+		for(size_t row=0;row<mRowSize;++row)
+		{
+			for(size_t pos=rowStart[row];pos<rowStart[row+1];++pos)
+			{
+				if( col[pos] < row )
+				{
+					mLower.col.push_back(col[pos]);
+					mLower.val.push_back(val[pos]);
+				}
+				else if( col[pos] > row )
+				{
+					mUpper.col.push_back(col[pos]);
+					mUpper.val.push_back(val[pos]);
+				}
+			}
+
+			mUpper.diag[row]		=	val[diagPos[row]];
+			mLower.rowStart[row+1]	=	mLower.col.size();
+			mUpper.rowStart[row+1]	=	mUpper.col.size();
+		}
+
+		buildLevels(mLower, true);
+		buildLevels(mUpper, false);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+}
+
+/**
+ * 소멸자
+ */
+template<class T, class I>
+BasicILU0Precond<T, I>::~BasicILU0Precond		(	void	)
+{
+}
+
+/**
+ * 전처리 적용 (L * U * z = r)
+ */
+template<class T, class I>
+void		BasicILU0Precond<T, I>::apply		(	const elem_t	r[],	///< 잔차 벡터
+										elem_t			z[]		///< 결과 벡터
+									) const
+{
+	solve(mLower, r, z);
+	solve(mUpper, z, z);
+}
+
+/////////////////////////////
+// 요소 / 위치 형식 별 명시적 인스턴스
+
+template class	BasicPreconditioner< float, uint32_t >;
+template class	BasicPreconditioner< float, uint64_t >;
+template class	BasicPreconditioner< double, uint32_t >;
+template class	BasicPreconditioner< double, uint64_t >;
+template class	BasicPreconditioner< std::complex<float>, uint32_t >;
+template class	BasicPreconditioner< std::complex<float>, uint64_t >;
+template class	BasicPreconditioner< std::complex<double>, uint32_t >;
+template class	BasicPreconditioner< std::complex<double>, uint64_t >;
+
+template class	BasicJacobiPrecond< float, uint32_t >;
+template class	BasicJacobiPrecond< float, uint64_t >;
+template class	BasicJacobiPrecond< double, uint32_t >;
+template class	BasicJacobiPrecond< double, uint64_t >;
+template class	BasicJacobiPrecond< std::complex<float>, uint32_t >;
+template class	BasicJacobiPrecond< std::complex<float>, uint64_t >;
+template class	BasicJacobiPrecond< std::complex<double>, uint32_t >;
+template class	BasicJacobiPrecond< std::complex<double>, uint64_t >;
+
+template class	BasicIC0Precond< float, uint32_t >;
+template class	BasicIC0Precond< float, uint64_t >;
+template class	BasicIC0Precond< double, uint32_t >;
+template class	BasicIC0Precond< double, uint64_t >;
+template class	BasicIC0Precond< std::complex<float>, uint32_t >;
+template class	BasicIC0Precond< std::complex<float>, uint64_t >;
+template class	BasicIC0Precond< std::complex<double>, uint32_t >;
+template class	BasicIC0Precond< std::complex<double>, uint64_t >;
+
+template class	BasicILU0Precond< float, uint32_t >;
+template class	BasicILU0Precond< float, uint64_t >;
+template class	BasicILU0Precond< double, uint32_t >;
+template class	BasicILU0Precond< double, uint64_t >;
+template class	BasicILU0Precond< std::complex<float>, uint32_t >;
+template class	BasicILU0Precond< std::complex<float>, uint64_t >;
+template class	BasicILU0Precond< std::complex<double>, uint32_t >;
+template class	BasicILU0Precond< std::complex<double>, uint64_t >;
+
+};
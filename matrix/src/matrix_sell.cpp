@@ -0,0 +1,701 @@
+/*
+ * matrix_sell.cpp
+ *
+ *  Created on: 2015. 8. 24.
+ *      Author: asran
+ */
+
+#include "matrix_sell.h"
+#include "matrix_csr.h"
+#include "matrix_simd.h"
+#include "matrix_error.h"
+#include "thread_pool.h"
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+
+#include <immintrin.h>
+#define	SIMD_X86
+#define	SIMD_TARGET(inst)		__attribute__((target(inst)))
+
+#elif defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+
+#include <immintrin.h>
+#define	SIMD_X86
+#define	SIMD_TARGET(inst)
+
+#endif
+
+namespace matrix
+{
+
+/////////////////////////////
+// 묶음 계산 함수 : 묶음 한 개의 CHUNK_SIZE 개 행 합을 sum에 저장한다.
+// value / colIdx는 묶음 시작 위치이며, width는 묶음 안의 행 길이이다.
+
+/**
+ * 묶음 계산 (일반 반복문)
+ */
+template<class T, class I>
+static void		chunkScalar		(	const T*	value,
+									const I*	colIdx,
+									size_t		width,
+									const T		x[],
+									T			sum[]
+								)
+{
+	const size_t	chunk	=	BasicMatrixSELL<T, I>::CHUNK_SIZE;
+
+	for(size_t lane=0;lane<chunk;++lane)
+	{
+		sum[lane]	=	0;
+	}
+
+	for(size_t cnt=0;cnt<width;++cnt)
+	{
+		for(size_t lane=0;lane<chunk;++lane)
+		{
+			sum[lane]	+=	value[cnt * chunk + lane] * x[colIdx[cnt * chunk + lane]];
+		}
+	}
+}
+
+#ifdef	SIMD_X86
+
+// 요소 값은 SIMD_ALIGN 경계에서 시작하고 묶음 크기가 벡터 크기의 배수이므로 정렬 된 읽기를 사용한다.
+// 32 bit 열 위치는 부호 있는 위치로 모으므로 열 크기가 INT32_MAX 이하일 때만 사용한다.
+// 모으기는 모든 lane을 켠 마스크 형식을 사용한다. (기본 형식은 GCC에서 초기화 안 된 원본 경고 발생)
+
+SIMD_TARGET("avx2,fma")
+static void		chunkAvx2U32	(	const double*	value,
+									const uint32_t*	colIdx,
+									size_t			width,
+									const double	x[],
+									double			sum[]
+								)
+{
+	__m256d		zero	=	_mm256_setzero_pd();
+	__m256d		mask	=	_mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+	__m256d		sum0	=	zero;
+	__m256d		sum1	=	zero;
+
+	for(size_t cnt=0;cnt<width;++cnt)
+	{
+		const double*	val		=	value + cnt * 8;
+		const uint32_t*	col		=	colIdx + cnt * 8;
+		__m128i			idx0	=	_mm_loadu_si128((const __m128i*)col);
+		__m128i			idx1	=	_mm_loadu_si128((const __m128i*)(col + 4));
+
+		sum0	=	_mm256_fmadd_pd(_mm256_load_pd(val), _mm256_mask_i32gather_pd(zero, x, idx0, mask, 8), sum0);
+		sum1	=	_mm256_fmadd_pd(_mm256_load_pd(val + 4), _mm256_mask_i32gather_pd(zero, x, idx1, mask, 8), sum1);
+	}
+
+	_mm256_storeu_pd(sum, sum0);
+	_mm256_storeu_pd(sum + 4, sum1);
+}
+
+SIMD_TARGET("avx2,fma")
+static void		chunkAvx2U64	(	const double*	value,
+									const uint64_t*	colIdx,
+									size_t			width,
+									const double	x[],
+									double			sum[]
+								)
+{
+	__m256d		zero	=	_mm256_setzero_pd();
+	__m256d		mask	=	_mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+	__m256d		sum0	=	zero;
+	__m256d		sum1	=	zero;
+
+	for(size_t cnt=0;cnt<width;++cnt)
+	{
+		const double*	val		=	value + cnt * 8;
+		const uint64_t*	col		=	colIdx + cnt * 8;
+		__m256i			idx0	=	_mm256_loadu_si256((const __m256i*)col);
+		__m256i			idx1	=	_mm256_loadu_si256((const __m256i*)(col + 4));
+
+		sum0	=	_mm256_fmadd_pd(_mm256_load_pd(val), _mm256_mask_i64gather_pd(zero, x, idx0, mask, 8), sum0);
+		sum1	=	_mm256_fmadd_pd(_mm256_load_pd(val + 4), _mm256_mask_i64gather_pd(zero, x, idx1, mask, 8), sum1);
+	}
+
+	_mm256_storeu_pd(sum, sum0);
+	_mm256_storeu_pd(sum + 4, sum1);
+}
+
+SIMD_TARGET("avx512f")
+static void		chunkAvx512U32	(	const double*	value,
+									const uint32_t*	colIdx,
+									size_t			width,
+									const double	x[],
+									double			sum[]
+								)
+{
+	__m512d		zero	=	_mm512_setzero_pd();
+	__m512d		sum0	=	zero;
+
+	for(size_t cnt=0;cnt<width;++cnt)
+	{
+		__m256i		idx		=	_mm256_loadu_si256((const __m256i*)(colIdx + cnt * 8));
+
+		sum0	=	_mm512_fmadd_pd(_mm512_load_pd(value + cnt * 8), _mm512_mask_i32gather_pd(zero, 0xFF, idx, x, 8), sum0);
+	}
+
+	_mm512_storeu_pd(sum, sum0);
+}
+
+SIMD_TARGET("avx512f")
+static void		chunkAvx512U64	(	const double*	value,
+									const uint64_t*	colIdx,
+									size_t			width,
+									const double	x[],
+									double			sum[]
+								)
+{
+	__m512d		zero	=	_mm512_setzero_pd();
+	__m512d		sum0	=	zero;
+
+	for(size_t cnt=0;cnt<width;++cnt)
+	{
+		__m512i		idx		=	_mm512_loadu_si512((const void*)(colIdx + cnt * 8));
+
+		sum0	=	_mm512_fmadd_pd(_mm512_load_pd(value + cnt * 8), _mm512_mask_i64gather_pd(zero, 0xFF, idx, x, 8), sum0);
+	}
+
+	_mm512_storeu_pd(sum, sum0);
+}
+
+#endif
+
+/**
+ * 생성자
+ */
+template<class T, class I>
+BasicMatrixSELL<T, I>::BasicMatrixSELL		(	void	)
+:mRowSize(0),
+mColSize(0),
+mSize(0),
+mSigma(1),
+mChunkNum(0),
+mChunkStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mRowPerm(NULL),
+mChunkFunc(NULL)
+{
+}
+
+/**
+ * 생성자 (MatrixCSR 변환)
+ * sigma 개 행 범위 안에서 행을 길이가 긴 순서로 정렬한 후 CHUNK_SIZE 개씩 묶는다.
+ * @exception		메모리 할당 실패 또는 저장 요소 수가 위치 형식 범위를 넘을 경우 에러 발생
+ */
+template<class T, class I>
+BasicMatrixSELL<T, I>::BasicMatrixSELL		(	const BasicMatrixCSR<T, I>&	matrix,		///< 변환 할 행렬
+												size_t						sigma		///< 정렬 범위 행 수
+											)
+:mRowSize(0),
+mColSize(0),
+mSize(0),
+mSigma(1),
+mChunkNum(0),
+mChunkStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mRowPerm(NULL),
+mChunkFunc(NULL)
+{
+	size_t				row			=	matrix.getRow();
+	const index_t*		rowStart	=	matrix.getRowStart();
+	const index_t*		colIdx		=	matrix.getColIdx();
+	const elem_t*		value		=	matrix.getValue();
+	size_t				chunkNum	=	( row + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+	std::vector<size_t>	perm;
+	std::vector<size_t>	chunkStart;
+
+	if( row > std::numeric_limits<index_t>::max() )
+	{
+		throw matrix::ErrMsg::createErrMsg("행 크기가 위치 형식 범위를 넘습니다.");
+	}
+
+	try
+	{
+		perm.resize(row);
+		chunkStart.assign(chunkNum + 1, 0);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	// 1. sigma 개 행 범위 안에서 길이가 긴 순서로 정렬 (같은 길이는 원래 순서 유지)
+	sigma	=	std::max(sigma, (size_t)1);
+
+	for(size_t cnt=0;cnt<row;++cnt)
+	{
+		perm[cnt]	=	cnt;
+	}
+
+	if( sigma > 1 )
+	{
+		for(size_t start=0;start<row;start+=sigma)
+		{
+			std::stable_sort	(	perm.begin() + start,
+									perm.begin() + std::min(start + sigma, row),
+									[rowStart](size_t a, size_t b)
+									{
+										return	( rowStart[a+1] - rowStart[a] ) > ( rowStart[b+1] - rowStart[b] );
+									}
+								);
+		}
+	}
+
+	// 2. 묶음 별 길이 (묶음 안의 가장 긴 행)
+	for(size_t chunk=0;chunk<chunkNum;++chunk)
+	{
+		size_t		width	=	0;
+
+		for(size_t lane=0;lane<CHUNK_SIZE;++lane)
+		{
+			size_t		pos		=	chunk * CHUNK_SIZE + lane;
+
+			if( pos < row )
+			{
+				width	=	std::max(width, (size_t)(rowStart[perm[pos]+1] - rowStart[perm[pos]]));
+			}
+		}
+
+		chunkStart[chunk+1]	=	chunkStart[chunk] + width * CHUNK_SIZE;
+	}
+
+	allocElems(row, matrix.getCol(), chunkStart[chunkNum]);
+
+	// 3. 열 우선 순서로 채우기
+	for(size_t chunk=0;chunk<chunkNum;++chunk)
+	{
+		size_t		base	=	chunkStart[chunk];
+		size_t		width	=	( chunkStart[chunk+1] - base ) / CHUNK_SIZE;
+
+		for(size_t lane=0;lane<CHUNK_SIZE;++lane)
+		{
+			size_t		pos		=	chunk * CHUNK_SIZE + lane;
+			size_t		start	=	0;
+			size_t		length	=	0;
+			index_t		lastCol	=	0;
+
+			if( pos < row )
+			{
+				start	=	rowStart[perm[pos]];
+				length	=	rowStart[perm[pos]+1] - start;
+
+				mRowPerm[pos]	=	(index_t)perm[pos];
+			}
+
+			for(size_t cnt=0;cnt<width;++cnt)
+			{
+				size_t		dst		=	base + cnt * CHUNK_SIZE + lane;
+
+				if( cnt < length )
+				{
+					lastCol			=	colIdx[start + cnt];
+					mColIdx[dst]	=	lastCol;
+					mValue[dst]		=	value[start + cnt];
+				}
+				else
+				{
+					// 채운 요소는 이미 읽은 열을 다시 참조하여 x의 다른 위치를 읽지 않는다.
+					mColIdx[dst]	=	lastCol;
+					mValue[dst]		=	0;
+				}
+			}
+		}
+	}
+
+	memcpy(mChunkStart, chunkStart.data(), sizeof(size_t) * (chunkNum + 1));
+
+	mSize		=	matrix.getSize();
+	mSigma		=	sigma;
+}
+
+/**
+ * 복사 생성자
+ */
+template<class T, class I>
+BasicMatrixSELL<T, I>::BasicMatrixSELL		(	const BasicMatrixSELL&		matrix		///< 복사 될 객체
+											)
+:mRowSize(0),
+mColSize(0),
+mSize(0),
+mSigma(1),
+mChunkNum(0),
+mChunkStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mRowPerm(NULL),
+mChunkFunc(NULL)
+{
+	copyElems(matrix);
+}
+
+/**
+ * 이동 생성자
+ * 데이터를 복사하지 않고 가져오며, 원본은 빈 행렬이 된다.
+ */
+template<class T, class I>
+BasicMatrixSELL<T, I>::BasicMatrixSELL		(	BasicMatrixSELL&&			matrix		///< 이동 할 객체
+											)
+:mRowSize(0),
+mColSize(0),
+mSize(0),
+mSigma(1),
+mChunkNum(0),
+mChunkStart(NULL),
+mColIdx(NULL),
+mValue(NULL),
+mRowPerm(NULL),
+mChunkFunc(NULL)
+{
+	swap(matrix);
+}
+
+/**
+ * 소멸자
+ */
+template<class T, class I>
+BasicMatrixSELL<T, I>::~BasicMatrixSELL		(	void	)
+{
+	freeElems();
+}
+
+/**
+ * 행렬 맞바꾸기
+ * 데이터를 복사하지 않고 두 행렬의 내용을 교환한다.
+ */
+template<class T, class I>
+void		BasicMatrixSELL<T, I>::swap		(	BasicMatrixSELL&	operand		///< 맞바꿀 행렬
+											)
+{
+	std::swap(mRowSize, operand.mRowSize);
+	std::swap(mColSize, operand.mColSize);
+	std::swap(mSize, operand.mSize);
+	std::swap(mSigma, operand.mSigma);
+	std::swap(mChunkNum, operand.mChunkNum);
+	std::swap(mChunkStart, operand.mChunkStart);
+	std::swap(mColIdx, operand.mColIdx);
+	std::swap(mValue, operand.mValue);
+	std::swap(mRowPerm, operand.mRowPerm);
+	std::swap(mChunkFunc, operand.mChunkFunc);
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x)
+ */
+template<class T, class I>
+void		BasicMatrixSELL<T, I>::spmv		(	const elem_t	x[],	///< 입력 벡터
+												elem_t			y[]		///< 결과 벡터
+											) const
+{
+	spmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y)
+ * beta가 0이면 y의 기존 값은 읽지 않는다.
+ */
+template<class T, class I>
+void		BasicMatrixSELL<T, I>::spmv		(	elem_t			alpha,	///< 행렬 x 벡터 계수
+												const elem_t	x[],	///< 입력 벡터
+												elem_t			beta,	///< 결과 벡터 계수
+												elem_t			y[]		///< 결과 벡터
+											) const
+{
+	spmvChunks(alpha, x, beta, y, 0, mChunkNum);
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x, 쓰레드 사용)
+ */
+template<class T, class I>
+void		BasicMatrixSELL<T, I>::pspmv	(	const elem_t	x[],	///< 입력 벡터
+												elem_t			y[]		///< 결과 벡터
+											) const
+{
+	pspmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y, 쓰레드 사용)
+ * 묶음 단위로 나누어 쓰레드 풀에서 수행하며, 각 묶음의 행은 서로 다르므로 y를 나누어 쓴다.
+ * 저장 요소 수가 쓰레드 풀의 최소 작업 크기보다 작으면 호출한 쓰레드에서 바로 수행한다.
+ */
+template<class T, class I>
+void		BasicMatrixSELL<T, I>::pspmv	(	elem_t			alpha,	///< 행렬 x 벡터 계수
+												const elem_t	x[],	///< 입력 벡터
+												elem_t			beta,	///< 결과 벡터 계수
+												elem_t			y[]		///< 결과 벡터
+											) const
+{
+	ThreadPool&		pool		=	ThreadPool::getInstance();
+	size_t			threadNum	=	pool.isSerial(getPaddedSize()) ? 1 : pool.getTaskNum(mChunkNum);
+
+	if( threadNum == 1 )
+	{
+		spmvChunks(alpha, x, beta, y, 0, mChunkNum);
+		return;
+	}
+
+	OpInfo					info		=	{this, alpha, x, beta, y};
+	std::vector<FuncInfo>	funcInfo(threadNum);
+	std::vector<void*>		args(threadNum);
+	size_t					threadPerChunk	=	mChunkNum / threadNum;
+	size_t					chunkMod		=	mChunkNum % threadNum;
+
+	for(size_t num=0;num<threadNum;num++)
+	{
+		funcInfo[num].opInfo		=	info;
+		funcInfo[num].startChunk	=	num * threadPerChunk;
+		funcInfo[num].endChunk		=	funcInfo[num].startChunk + threadPerChunk;
+
+		args[num]		=	&funcInfo[num];
+	}
+
+	funcInfo[threadNum-1].endChunk		+=	chunkMod;
+
+	// 쓰레드 풀에서 수행
+	pool.execute	(	BasicMatrixSELL::threadSpmv,
+						&args[0],
+						NULL,
+						threadNum
+					);
+}
+
+/**
+ * 행렬 데이터 공간 할당
+ * 요소 배열은 SIMD_ALIGN 경계에 맞춰 할당한다.
+ * @exception		메모리 할당 실패 또는 저장 요소 수가 위치 형식 범위를 넘을 경우 에러 발생
+ */
+template<class T, class I>
+void		BasicMatrixSELL<T, I>::allocElems		(	size_t		row,			///< 행 크기
+														size_t		col,			///< 열 크기
+														size_t		paddedSize		///< 채운 요소를 포함한 저장 요소 수
+													)
+{
+	if( ( col > std::numeric_limits<index_t>::max() ) ||
+		( paddedSize > std::numeric_limits<index_t>::max() ) )
+	{
+		throw matrix::ErrMsg::createErrMsg("요소 수가 위치 형식 범위를 넘습니다.");
+	}
+
+	freeElems();
+
+	try
+	{
+		mRowSize		=	row;
+		mColSize		=	col;
+		mChunkNum		=	( row + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+		mChunkStart		=	(size_t*)SimdKernel::allocAligned(sizeof(size_t) * (mChunkNum + 1));
+		mColIdx			=	(index_t*)SimdKernel::allocAligned(sizeof(index_t) * paddedSize);
+		mValue			=	(elem_t*)SimdKernel::allocAligned(sizeof(elem_t) * paddedSize);
+		mRowPerm		=	(index_t*)SimdKernel::allocAligned(sizeof(index_t) * row);
+		mChunkFunc		=	selectChunkFunc(col);
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		freeElems();
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	mChunkStart[mChunkNum]	=	paddedSize;
+}
+
+/**
+ * 행렬 데이터 공간 할당 해제
+ */
+template<class T, class I>
+void		BasicMatrixSELL<T, I>::freeElems		(	void	)
+{
+	SimdKernel::freeAligned(mChunkStart);
+	SimdKernel::freeAligned(mColIdx);
+	SimdKernel::freeAligned(mValue);
+	SimdKernel::freeAligned(mRowPerm);
+
+	mRowSize		=	0;
+	mColSize		=	0;
+	mSize			=	0;
+	mChunkNum		=	0;
+	mChunkStart		=	NULL;
+	mColIdx			=	NULL;
+	mValue			=	NULL;
+	mRowPerm		=	NULL;
+	mChunkFunc		=	NULL;
+}
+
+/**
+ * 행렬 데이터 복사
+ */
+template<class T, class I>
+void		BasicMatrixSELL<T, I>::copyElems		(	const BasicMatrixSELL&	matrix	///< 복사 할 행렬
+													)
+{
+	size_t		paddedSize	=	matrix.getPaddedSize();
+
+	allocElems(matrix.getRow(), matrix.getCol(), paddedSize);
+
+	memcpy(mChunkStart, matrix.mChunkStart, sizeof(size_t) * (mChunkNum + 1));
+	memcpy(mColIdx, matrix.mColIdx, sizeof(index_t) * paddedSize);
+	memcpy(mValue, matrix.mValue, sizeof(elem_t) * paddedSize);
+	memcpy(mRowPerm, matrix.mRowPerm, sizeof(index_t) * mRowSize);
+
+	mSize		=	matrix.mSize;
+	mSigma		=	matrix.mSigma;
+}
+
+/**
+ * 지정한 범위의 묶음에 대한 행렬 x 벡터
+ * 묶음 별 합을 계산한 후 정렬 전 행 위치에 기록한다.
+ */
+template<class T, class I>
+void		BasicMatrixSELL<T, I>::spmvChunks		(	elem_t			alpha,			///< 행렬 x 벡터 계수
+														const elem_t	x[],			///< 입력 벡터
+														elem_t			beta,			///< 결과 벡터 계수
+														elem_t			y[],			///< 결과 벡터
+														size_t			startChunk,		///< 시작 묶음
+														size_t			endChunk		///< 종료 묶음 (미포함)
+													) const
+{
+	elem_t		sum[CHUNK_SIZE];
+
+	for(size_t chunk=startChunk;chunk<endChunk;++chunk)
+	{
+		size_t		base	=	mChunkStart[chunk];
+		size_t		width	=	( mChunkStart[chunk+1] - base ) / CHUNK_SIZE;
+		size_t		laneNum	=	std::min((size_t)CHUNK_SIZE, mRowSize - chunk * CHUNK_SIZE);
+
+		mChunkFunc(mValue + base, mColIdx + base, width, x, sum);
+
+		for(size_t lane=0;lane<laneNum;++lane)
+		{
+			size_t		row		=	mRowPerm[chunk * CHUNK_SIZE + lane];
+
+			if( beta == elem_t(0) )
+			{
+				y[row]	=	alpha * sum[lane];
+			}
+			else
+			{
+				y[row]	=	alpha * sum[lane] + beta * y[row];
+			}
+		}
+	}
+}
+
+/**
+ * 묶음 계산 함수 선택 (일반 반복문)
+ * double 이외의 요소 형식은 일반 반복문으로 계산한다.
+ * @return		묶음 계산 함수
+ */
+template<class T, class I>
+typename BasicMatrixSELL<T, I>::ChunkFunc		BasicMatrixSELL<T, I>::selectChunkFunc		(	size_t		/*col*/	///< 열 크기 (사용 안 함)
+																								)
+{
+	return	chunkScalar<T, I>;
+}
+
+/**
+ * 묶음 계산 함수 선택 (double, 32 bit 열 위치)
+ * CPU가 지원하는 가장 넓은 벡터 명령의 모으기 (gather) 함수를 사용한다.
+ * @return		묶음 계산 함수
+ */
+template<>
+BasicMatrixSELL<double, uint32_t>::ChunkFunc		BasicMatrixSELL<double, uint32_t>::selectChunkFunc		(	size_t		col		///< 열 크기
+																											)
+{
+	ChunkFunc	func	=	chunkScalar<double, uint32_t>;
+
+#ifdef	SIMD_X86
+
+	if( col <= (size_t)INT32_MAX )
+	{
+		switch( SimdKernel::getInstSet() )
+		{
+		case SimdKernel::INST_AVX512:
+			func	=	chunkAvx512U32;
+			break;
+		case SimdKernel::INST_AVX2:
+			func	=	chunkAvx2U32;
+			break;
+		default:
+			break;
+		}
+	}
+
+#endif
+
+	return	func;
+}
+
+/**
+ * 묶음 계산 함수 선택 (double, 64 bit 열 위치)
+ * CPU가 지원하는 가장 넓은 벡터 명령의 모으기 (gather) 함수를 사용한다.
+ * @return		묶음 계산 함수
+ */
+template<>
+BasicMatrixSELL<double, uint64_t>::ChunkFunc		BasicMatrixSELL<double, uint64_t>::selectChunkFunc		(	size_t		col		///< 열 크기
+																											)
+{
+	ChunkFunc	func	=	chunkScalar<double, uint64_t>;
+
+#ifdef	SIMD_X86
+
+	if( col <= (size_t)INT64_MAX )
+	{
+		switch( SimdKernel::getInstSet() )
+		{
+		case SimdKernel::INST_AVX512:
+			func	=	chunkAvx512U64;
+			break;
+		case SimdKernel::INST_AVX2:
+			func	=	chunkAvx2U64;
+			break;
+		default:
+			break;
+		}
+	}
+
+#endif
+
+	return	func;
+}
+
+/**
+ * 지정한 범위의 묶음에 대한 행렬 x 벡터
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicMatrixSELL<T, I>::threadSpmv		(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	const OpInfo&	opInfo		=	info->opInfo;
+
+	opInfo.operand->spmvChunks	(	opInfo.alpha,
+									opInfo.vecX,
+									opInfo.beta,
+									opInfo.vecY,
+									info->startChunk,
+									info->endChunk
+								);
+
+	return	NULL;
+}
+
+/////////////////////////////
+// 요소 / 위치 형식 별 명시적 인스턴스
+
+template class	BasicMatrixSELL< float, uint32_t >;
+template class	BasicMatrixSELL< float, uint64_t >;
+template class	BasicMatrixSELL< double, uint32_t >;
+template class	BasicMatrixSELL< double, uint64_t >;
+template class	BasicMatrixSELL< std::complex<float>, uint32_t >;
+template class	BasicMatrixSELL< std::complex<float>, uint64_t >;
+template class	BasicMatrixSELL< std::complex<double>, uint32_t >;
+template class	BasicMatrixSELL< std::complex<double>, uint64_t >;
+
+};
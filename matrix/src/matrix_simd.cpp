@@ -0,0 +1,508 @@
+/*
+ * matrix_simd.cpp
+ *
+ *  Created on: 2015. 8. 3.
+ *      Author: asran
+ */
+
+#include "matrix_simd.h"
+#include <stdlib.h>
+#include <new>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+
+#include <immintrin.h>
+#define	SIMD_X86
+#define	SIMD_TARGET(inst)		__attribute__((target(inst)))
+
+#elif defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+
+#include <immintrin.h>
+#include <intrin.h>
+#define	SIMD_X86
+#define	SIMD_TARGET(inst)
+
+#endif
+
+#define	TRANSPOSE_BLOCK		(32)		///< 전치 변환 블록 크기
+
+namespace matrix
+{
+
+/////////////////////////////
+// 일반 반복문
+
+static void		addScalar		(	const elem_t*	a,
+									const elem_t*	b,
+									elem_t*			c,
+									size_t			num
+								)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		c[cnt]	=	a[cnt] + b[cnt];
+	}
+}
+
+static void		subScalar		(	const elem_t*	a,
+									const elem_t*	b,
+									elem_t*			c,
+									size_t			num
+								)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		c[cnt]	=	a[cnt] - b[cnt];
+	}
+}
+
+static void		scaleScalar		(	elem_t			alpha,
+									const elem_t*	a,
+									elem_t*			c,
+									size_t			num
+								)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		c[cnt]	=	alpha * a[cnt];
+	}
+}
+
+static void		axpyScalar		(	elem_t			alpha,
+									const elem_t*	x,
+									elem_t*			y,
+									size_t			num
+								)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		y[cnt]	+=	alpha * x[cnt];
+	}
+}
+
+static void		axpbyScalar		(	elem_t			alpha,
+									const elem_t*	x,
+									elem_t			beta,
+									elem_t*			y,
+									size_t			num
+								)
+{
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		y[cnt]	=	alpha * x[cnt] + beta * y[cnt];
+	}
+}
+
+static elem_t	dotScalar		(	const elem_t*	a,
+									const elem_t*	b,
+									size_t			num
+								)
+{
+	elem_t		sum		=	0;
+
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		sum		+=	a[cnt] * b[cnt];
+	}
+
+	return	sum;
+}
+
+#ifdef	SIMD_X86
+
+/////////////////////////////
+// 벡터 명령 : 명령 집합 별로 같은 모양의 함수를 만든다.
+// WIDTH 개 단위로 처리하고, 남은 요소는 일반 반복문으로 처리한다.
+
+#define	DEFINE_SIMD_KERNELS(NAME, TARGET, VEC, WIDTH, LOAD, STORE, ADD, SUB, MUL, SET1)			\
+																									\
+TARGET static void	add##NAME	(	const elem_t* a, const elem_t* b, elem_t* c, size_t num	)		\
+{																									\
+	size_t	cnt	=	0;																				\
+	for(;cnt+WIDTH<=num;cnt+=WIDTH)																	\
+	{																								\
+		STORE(c + cnt, ADD(LOAD(a + cnt), LOAD(b + cnt)));											\
+	}																								\
+	addScalar(a + cnt, b + cnt, c + cnt, num - cnt);												\
+}																									\
+																									\
+TARGET static void	sub##NAME	(	const elem_t* a, const elem_t* b, elem_t* c, size_t num	)		\
+{																									\
+	size_t	cnt	=	0;																				\
+	for(;cnt+WIDTH<=num;cnt+=WIDTH)																	\
+	{																								\
+		STORE(c + cnt, SUB(LOAD(a + cnt), LOAD(b + cnt)));											\
+	}																								\
+	subScalar(a + cnt, b + cnt, c + cnt, num - cnt);												\
+}																									\
+																									\
+TARGET static void	scale##NAME	(	elem_t alpha, const elem_t* a, elem_t* c, size_t num	)		\
+{																									\
+	VEC		va	=	SET1(alpha);																	\
+	size_t	cnt	=	0;																				\
+	for(;cnt+WIDTH<=num;cnt+=WIDTH)																	\
+	{																								\
+		STORE(c + cnt, MUL(va, LOAD(a + cnt)));														\
+	}																								\
+	scaleScalar(alpha, a + cnt, c + cnt, num - cnt);												\
+}																									\
+																									\
+TARGET static void	axpy##NAME	(	elem_t alpha, const elem_t* x, elem_t* y, size_t num	)		\
+{																									\
+	VEC		va	=	SET1(alpha);																	\
+	size_t	cnt	=	0;																				\
+	for(;cnt+WIDTH<=num;cnt+=WIDTH)																	\
+	{																								\
+		STORE(y + cnt, ADD(MUL(va, LOAD(x + cnt)), LOAD(y + cnt)));									\
+	}																								\
+	axpyScalar(alpha, x + cnt, y + cnt, num - cnt);													\
+}																									\
+																									\
+TARGET static void	axpby##NAME	(	elem_t alpha, const elem_t* x, elem_t beta, elem_t* y, size_t num	)	\
+{																									\
+	VEC		va	=	SET1(alpha);																	\
+	VEC		vb	=	SET1(beta);																		\
+	size_t	cnt	=	0;																				\
+	for(;cnt+WIDTH<=num;cnt+=WIDTH)																	\
+	{																								\
+		STORE(y + cnt, ADD(MUL(va, LOAD(x + cnt)), MUL(vb, LOAD(y + cnt))));						\
+	}																								\
+	axpbyScalar(alpha, x + cnt, beta, y + cnt, num - cnt);											\
+}																									\
+																									\
+TARGET static elem_t	dot##NAME	(	const elem_t* a, const elem_t* b, size_t num	)				\
+{																									\
+	VEC		vs0	=	SET1(0);																		\
+	VEC		vs1	=	SET1(0);																		\
+	elem_t	lane[WIDTH];																			\
+	elem_t	sum	=	0;																				\
+	size_t	cnt	=	0;																				\
+	for(;cnt+2*WIDTH<=num;cnt+=2*WIDTH)																\
+	{																								\
+		vs0	=	ADD(vs0, MUL(LOAD(a + cnt), LOAD(b + cnt)));										\
+		vs1	=	ADD(vs1, MUL(LOAD(a + cnt + WIDTH), LOAD(b + cnt + WIDTH)));						\
+	}																								\
+	STORE(lane, ADD(vs0, vs1));																		\
+	for(size_t idx=0;idx<WIDTH;++idx)																\
+	{																								\
+		sum	+=	lane[idx];																			\
+	}																								\
+	return	sum + dotScalar(a + cnt, b + cnt, num - cnt);											\
+}
+
+DEFINE_SIMD_KERNELS	(	Sse2, SIMD_TARGET("sse2"), __m128d, 2,
+						_mm_loadu_pd, _mm_storeu_pd, _mm_add_pd, _mm_sub_pd, _mm_mul_pd, _mm_set1_pd	)
+
+DEFINE_SIMD_KERNELS	(	Avx2, SIMD_TARGET("avx2,fma"), __m256d, 4,
+						_mm256_loadu_pd, _mm256_storeu_pd, _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd, _mm256_set1_pd	)
+
+DEFINE_SIMD_KERNELS	(	Avx512, SIMD_TARGET("avx512f"), __m512d, 8,
+						_mm512_loadu_pd, _mm512_storeu_pd, _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd, _mm512_set1_pd	)
+
+#undef	DEFINE_SIMD_KERNELS
+
+/**
+ * CPU 지원 명령 검사
+ * @return 사용 가능한 가장 넓은 명령 집합
+ */
+static SimdKernel::InstSet		detectInstSet		(	void	)
+{
+	SimdKernel::InstSet		instSet		=	SimdKernel::INST_SCALAR;
+
+#if defined(__GNUC__)
+
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports("sse2") )
+	{
+		instSet		=	SimdKernel::INST_SSE2;
+	}
+
+	if( __builtin_cpu_supports("avx2") &&
+		__builtin_cpu_supports("fma") )
+	{
+		instSet		=	SimdKernel::INST_AVX2;
+	}
+
+	if( __builtin_cpu_supports("avx512f") )
+	{
+		instSet		=	SimdKernel::INST_AVX512;
+	}
+
+#else
+
+	int		info[4];
+
+	__cpuid(info, 1);
+
+	bool	sse2		=	( info[3] & (1 << 26) ) != 0;
+	bool	fma			=	( info[2] & (1 << 12) ) != 0;
+	bool	osxsave		=	( info[2] & (1 << 27) ) != 0;
+	bool	avx			=	( info[2] & (1 << 28) ) != 0;
+
+	unsigned __int64	xcr0	=	( osxsave == true ) ? _xgetbv(0) : 0;
+
+	__cpuidex(info, 7, 0);
+
+	bool	avx2		=	( info[1] & (1 << 5) ) != 0;
+	bool	avx512		=	( info[1] & (1 << 16) ) != 0;
+
+	if( sse2 == true )
+	{
+		instSet		=	SimdKernel::INST_SSE2;
+	}
+
+	// OS가 YMM / ZMM 레지스터를 저장하는지도 확인한다.
+	if( ( avx == true ) && ( avx2 == true ) && ( fma == true ) &&
+		( ( xcr0 & 0x06 ) == 0x06 ) )
+	{
+		instSet		=	SimdKernel::INST_AVX2;
+	}
+
+	if( ( avx512 == true ) &&
+		( ( xcr0 & 0xE6 ) == 0xE6 ) )
+	{
+		instSet		=	SimdKernel::INST_AVX512;
+	}
+
+#endif
+
+	return	instSet;
+}
+
+#endif
+
+/**
+ * 사용 중인 명령 집합 가져오기
+ * @return 명령 집합
+ */
+SimdKernel::InstSet		SimdKernel::getInstSet		(	void	)
+{
+	return	getTable().instSet;
+}
+
+/**
+ * 요소 덧셈 (c = a + b)
+ */
+void		SimdKernel::add		(	const elem_t*	a,		///< 피연산자
+									const elem_t*	b,		///< 피연산자
+									elem_t*			c,		///< 결과 (a, b와 같아도 됨)
+									size_t			num		///< 요소 수
+								)
+{
+	getTable().add(a, b, c, num);
+}
+
+/**
+ * 요소 뺄셈 (c = a - b)
+ */
+void		SimdKernel::sub		(	const elem_t*	a,		///< 피연산자
+									const elem_t*	b,		///< 피연산자
+									elem_t*			c,		///< 결과 (a, b와 같아도 됨)
+									size_t			num		///< 요소 수
+								)
+{
+	getTable().sub(a, b, c, num);
+}
+
+/**
+ * 요소 x 단일 값 (c = alpha * a)
+ */
+void		SimdKernel::scale	(	elem_t			alpha,	///< 곱할 값
+									const elem_t*	a,		///< 피연산자
+									elem_t*			c,		///< 결과 (a와 같아도 됨)
+									size_t			num		///< 요소 수
+								)
+{
+	getTable().scale(alpha, a, c, num);
+}
+
+/**
+ * 요소 누적 (y = alpha * x + y)
+ */
+void		SimdKernel::axpy	(	elem_t			alpha,	///< x 계수
+									const elem_t*	x,		///< 피연산자
+									elem_t*			y,		///< 누적 할 배열
+									size_t			num		///< 요소 수
+								)
+{
+	getTable().axpy(alpha, x, y, num);
+}
+
+/**
+ * 요소 선형 결합 (y = alpha * x + beta * y)
+ */
+void		SimdKernel::axpby	(	elem_t			alpha,	///< x 계수
+									const elem_t*	x,		///< 피연산자
+									elem_t			beta,	///< y 계수
+									elem_t*			y,		///< 결과 배열
+									size_t			num		///< 요소 수
+								)
+{
+	getTable().axpby(alpha, x, beta, y, num);
+}
+
+/**
+ * 내적 (a · b)
+ * @return 내적 결과
+ */
+elem_t		SimdKernel::dot		(	const elem_t*	a,		///< 피연산자
+									const elem_t*	b,		///< 피연산자
+									size_t			num		///< 요소 수
+								)
+{
+	return	getTable().dot(a, b, num);
+}
+
+/**
+ * 전치 변환 (c = a^T)
+ * 읽기와 쓰기가 모두 캐시 안에서 이루어지도록 TRANSPOSE_BLOCK 크기 블록 단위로 변환한다.
+ */
+void		SimdKernel::transpose	(	const elem_t*	a,		///< row x col 행렬
+										size_t			row,	///< 행 크기
+										size_t			col,	///< 열 크기
+										elem_t*			c		///< col x row 결과 행렬 (a와 달라야 함)
+									)
+{
+	for(size_t rb=0;rb<row;rb+=TRANSPOSE_BLOCK)
+	{
+		size_t		rEnd	=	std::min(row, rb + TRANSPOSE_BLOCK);
+
+		for(size_t cb=0;cb<col;cb+=TRANSPOSE_BLOCK)
+		{
+			size_t		cEnd	=	std::min(col, cb + TRANSPOSE_BLOCK);
+
+			for(size_t r=rb;r<rEnd;++r)
+			{
+				const elem_t*	src		=	a + r * col;
+
+				for(size_t cc=cb;cc<cEnd;++cc)
+				{
+					c[cc * row + r]		=	src[cc];
+				}
+			}
+		}
+	}
+}
+
+/**
+ * SIMD_ALIGN 바이트 경계에 정렬 된 메모리 할당
+ * @return 할당한 메모리
+ * @exception 메모리 할당 실패 시 std::bad_alloc 발생
+ */
+void*		SimdKernel::allocAligned	(	size_t		size	///< 할당 할 크기 (byte)
+										)
+{
+	void*	ptr		=	NULL;
+
+	if( size == 0 )
+	{
+		size	=	1;
+	}
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	ptr		=	::_aligned_malloc(size, SIMD_ALIGN);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	if( ::posix_memalign(&ptr, SIMD_ALIGN, size) != 0 )
+	{
+		ptr		=	NULL;
+	}
+
+#endif
+
+	if( ptr == NULL )
+	{
+		throw std::bad_alloc();
+	}
+
+	return	ptr;
+}
+
+/**
+ * allocAligned로 할당한 메모리 해제 (NULL 가능)
+ */
+void		SimdKernel::freeAligned		(	void*		ptr		///< 해제 할 메모리
+										)
+{
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	::_aligned_free(ptr);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	::free(ptr);
+
+#endif
+}
+
+/**
+ * 연산 함수 표 가져오기
+ * 최초 호출 시 한 번만 CPU를 검사한다.
+ * @return 연산 함수 표
+ */
+const SimdKernel::FuncTable&		SimdKernel::getTable		(	void	)
+{
+	static const FuncTable		table	=	selectTable();
+
+	return	table;
+}
+
+/**
+ * CPU 지원 명령에 맞는 연산 함수 선택
+ * @return 연산 함수 표
+ */
+SimdKernel::FuncTable		SimdKernel::selectTable		(	void	)
+{
+	FuncTable	table	=	{	INST_SCALAR,
+								addScalar,
+								subScalar,
+								scaleScalar,
+								axpyScalar,
+								axpbyScalar,
+								dotScalar
+							};
+
+#ifdef	SIMD_X86
+
+	switch( detectInstSet() )
+	{
+	case INST_AVX512:
+		table.instSet	=	INST_AVX512;
+		table.add		=	addAvx512;
+		table.sub		=	subAvx512;
+		table.scale		=	scaleAvx512;
+		table.axpy		=	axpyAvx512;
+		table.axpby		=	axpbyAvx512;
+		table.dot		=	dotAvx512;
+		break;
+	case INST_AVX2:
+		table.instSet	=	INST_AVX2;
+		table.add		=	addAvx2;
+		table.sub		=	subAvx2;
+		table.scale		=	scaleAvx2;
+		table.axpy		=	axpyAvx2;
+		table.axpby		=	axpbyAvx2;
+		table.dot		=	dotAvx2;
+		break;
+	case INST_SSE2:
+		table.instSet	=	INST_SSE2;
+		table.add		=	addSse2;
+		table.sub		=	subSse2;
+		table.scale		=	scaleSse2;
+		table.axpy		=	axpySse2;
+		table.axpby		=	axpbySse2;
+		table.dot		=	dotSse2;
+		break;
+	default:
+		break;
+	}
+
+#endif
+
+	return	table;
+}
+
+};
@@ -7,99 +7,199 @@
 
 #include "sparse_matrix.h"
 #include "matrix_error.h"
+#include "thread_pool.h"
 #include <math.h>
 
-#define	THREAD_NUM					(2)
-#define	THREAD_FUNC_THRESHOLD	(THREAD_NUM)
 
 namespace matrix
 {
 
-typedef	THREAD_RETURN_TYPE(THREAD_FUNC_TYPE *Operation)(void*);
-
-struct		FuncInfo
-{
-	SparseMatrix::OpInfo	opInfo;
-	Operation				func;
-	size_t					startRow;
-	size_t					endRow;
-};
-
 /**
  * 생성자
  */
-SparseMatrix::SparseMatrix		(	void	)
+template<class T, class I>
+BasicSparseMatrix<T, I>::BasicSparseMatrix		(	void	)
 :mRowSize(0),
  mColSize(0),
- mData(NULL)
+ mData(NULL),
+ mSorted(true),
+ mArena(NULL)
 {
+	setArena(getDefaultArena());
 }
 
 /**
  * 소멸자
  */
-SparseMatrix::SparseMatrix		(	size_t		row,	///< 행
+template<class T, class I>
+BasicSparseMatrix<T, I>::BasicSparseMatrix		(	size_t		row,	///< 행
 											size_t		col		///< 열
 										)
 :mRowSize(0),
  mColSize(0),
- mData(NULL)
+ mData(NULL),
+ mSorted(true),
+ mArena(NULL)
 {
+	setArena(getDefaultArena());
 	allocElems(row, col);
 }
 
 /**
  * 생성자
  */
-SparseMatrix::SparseMatrix		(	const SparseMatrix&		matrix		///< 행렬
+template<class T, class I>
+BasicSparseMatrix<T, I>::BasicSparseMatrix		(	const BasicSparseMatrix&		matrix		///< 행렬
 								)
 :mRowSize(0),
  mColSize(0),
- mData(NULL)
+ mData(NULL),
+ mSorted(true),
+ mArena(NULL)
 {
+	matrix.chkSorted();
+
+	setArena(matrix.getArena());
 	allocElems(matrix.getRow(), matrix.getCol());
 	copyElems(matrix);
 }
 
+/**
+ * 이동 생성자
+ * 데이터를 복사하지 않고 가져오며, 원본은 빈 행렬이 된다.
+ */
+template<class T, class I>
+BasicSparseMatrix<T, I>::BasicSparseMatrix		(	BasicSparseMatrix&&			matrix		///< 이동 할 객체
+								)
+:mRowSize(0),
+ mColSize(0),
+ mData(NULL),
+ mSorted(true),
+ mArena(NULL)
+{
+	swap(matrix);
+}
+
 /**
  * 소멸자
  */
-SparseMatrix::~SparseMatrix		(	void	)
+template<class T, class I>
+BasicSparseMatrix<T, I>::~BasicSparseMatrix		(	void	)
 {
 	freeElems();
+
+	delete	mArena;
 }
 
 /**
  * 행렬 요소 값 참조
  * @return 참조한 행렬 요소 값
  */
-elem_t		SparseMatrix::getElem		(	size_t		row,	///< 참조 할 행 위치
+template<class T, class I>
+T		BasicSparseMatrix<T, I>::getElem		(	size_t		row,	///< 참조 할 행 위치
 												size_t		col		///< 참조 할 열 위치
 											) const
 {
-	return	SparseMatrix::getElem_(mData, row, col);
+	chkSorted();
+
+	return	BasicSparseMatrix::getElem_(mData, row, col);
 }
 
 /**
  * 행렬 요소 값 설정
  */
-void		SparseMatrix::setElem		(	size_t		row,	///< 설정 할 행 위치
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::setElem		(	size_t		row,	///< 설정 할 행 위치
 												size_t		col,	///< 설정 할 열 위치
 												elem_t		elem	///< 설정 할 요소 값
 											)
 {
-	SparseMatrix::setElem_(mData, row, col, elem);
+	chkSorted();
+
+	BasicSparseMatrix::setElem_(mData, row, col, elem);
+}
+
+/**
+ * 행렬 요소 값 추가
+ * 행 정렬을 유지하지 않고 행 끝에 추가하므로, 많은 요소를 한 번에 입력할 때 사용한다.
+ * 같은 위치에 여러 번 추가하면 마지막 값이 남는다.
+ * 추가가 끝나면 finalize()로 정렬하며, 정렬 전에 다른 연산을 호출하면 자동으로 정렬한다.
+ * 자동 정렬은 쓰레드 간 직렬화 되므로 여러 쓰레드에서 같은 행렬을 읽어도 되지만,
+ * 요소 추가와 다른 연산을 동시에 호출하면 안 된다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::appendElem	(	size_t		row,	///< 추가 할 행 위치
+												size_t		col,	///< 추가 할 열 위치
+												elem_t		elem	///< 추가 할 요소 값
+											)
+{
+	mData[row].mVector.push_back(node_t(col, elem));
+	mSorted.store(false, std::memory_order_relaxed);
 }
 
-void		SparseMatrix::clear		(	void	)
+/**
+ * appendElem()으로 추가한 요소를 열 순서로 정렬하고 중복 및 0 값 요소 제거
+ * first touch 모드에서는 호출한 쓰레드에서 채운 행 (setElem(), appendElem())을
+ * 그 행을 맡을 쓰레드가 다시 할당하도록 하므로, 정렬 되어 있어도 요소 입력이 끝나면 호출한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::finalize		(	void	)
 {
-	for(size_t row=0;row<getRow();++row)
+	reserveRows(NULL);
+
+	if( mSorted == true )
+	{
+		return;
+	}
+
+	if( ThreadPool::getInstance().isSerial(countElems()) == true )
+	{
+		for(size_t row=0;row<getRow();++row)
+		{
+			sortRow_(mData[row].mVector);
+		}
+	}
+	else
+	{
+		OpInfo		info;
+
+		info.operandA	=	this;
+
+		doThreadFunc(FUNC_SORT, info);
+	}
+
+	mSorted		=	true;
+}
+
+/**
+ * 모든 요소 제거
+ * 행 저장 공간을 사용하면 모든 행을 비우고 공간을 한 번에 해제하며, 아니면 행 별 할당 공간은 유지한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::clear		(	void	)
+{
+	if( mArena == NULL )
+	{
+		for(size_t row=0;row<getRow();++row)
+		{
+			clear(row);
+		}
+	}
+	else
 	{
-		clear(row);
+		for(size_t row=0;row<getRow();++row)
+		{
+			row_t(RowAllocator<node_t>(mArena)).swap(mData[row].mVector);
+		}
+
+		mArena->reset();
 	}
+
+	mSorted		=	true;
 }
 
-void		SparseMatrix::clear		(	size_t		row		)
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::clear		(	size_t		row		)
 {
 	mData[row].mVector.clear();
 }
@@ -108,36 +208,23 @@ void		SparseMatrix::clear		(	size_t		row		)
  * 행렬 덧셈
  * @return	행렬 덧셈 결과
  */
-SparseMatrix	SparseMatrix::add	(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::add	(	const BasicSparseMatrix&	operand	///< 피연산자
 										) const
 {
 	chkSameSize(operand);
+	chkSorted();
+	operand.chkSorted();
 
-	SparseMatrix		result	=	SparseMatrix(getRow(), getCol());
+	BasicSparseMatrix		result	=	BasicSparseMatrix(getRow(), getCol());
 
-	result.equal(*this);
-
-	for(size_t row=0;row<operand.getRow();++row)
+	for(size_t row=0;row<getRow();++row)
 	{
-		std::vector<node_t>&	vec		=	operand.mData[row].mVector;
-
-		for(size_t cnt=0;cnt<vec.size();++cnt)
-		{
-			size_t	col		=	vec[cnt].mCol;
-
-			result.setElem	(	row,
-									col,
-									result.getElem(row, col) + vec[cnt].mElem
-								);
-		}
-
-		//for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-		//{
-		//	result.setElem	(	row,
-		//							itor->mCol,
-		//							result.getElem(row, itor->mCol) + itor->mElem
-		//						);
-		//}
+		mergeRow_	(	mData[row].mVector,
+						operand.mData[row].mVector,
+						1,
+						result.mData[row].mVector
+					);
 	}
 
 	return	result;
@@ -147,28 +234,25 @@ SparseMatrix	SparseMatrix::add	(	const SparseMatrix&	operand	///< 피연산자
  * 쓰레드 행렬 덧셈
  * @return 행렬 덧셈 결과
  */
-SparseMatrix	SparseMatrix::padd	(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::padd	(	const BasicSparseMatrix&	operand	///< 피연산자
 										) const
 {
 	chkSameSize(operand);
+	chkSorted();
+	operand.chkSorted();
 
-	SparseMatrix	result		=	SparseMatrix(getRow(), getCol());
+	BasicSparseMatrix	result		=	BasicSparseMatrix(getRow(), getCol());
 
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	if( ThreadPool::getInstance().isSerial(getSize() + operand.getSize()) == true )
 	{
-		result.equal(*this);
-
-		for(size_t row=0;row<operand.getRow();++row)
+		for(size_t row=0;row<getRow();++row)
 		{
-			std::vector<node_t>&	vec		=	operand.mData[row].mVector;
-
-			for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-			{
-				result.setElem	(	row,
-										itor->mCol,
-										result.getElem(row, itor->mCol) + itor->mElem
-									);
-			}
+			mergeRow_	(	mData[row].mVector,
+							operand.mData[row].mVector,
+							1,
+							result.mData[row].mVector
+						);
 		}
 	}
 	else
@@ -189,36 +273,23 @@ SparseMatrix	SparseMatrix::padd	(	const SparseMatrix&	operand	///< 피연산자
  * 행렬 뺄셈
  * @return 행렬 뺄셈 결과
  */
-SparseMatrix	SparseMatrix::sub	(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::sub	(	const BasicSparseMatrix&	operand	///< 피연산자
 										) const
 {
 	chkSameSize(operand);
+	chkSorted();
+	operand.chkSorted();
 
-	SparseMatrix		result		=	SparseMatrix(getRow(), getCol());
-
-	result.equal(*this);
+	BasicSparseMatrix		result		=	BasicSparseMatrix(getRow(), getCol());
 
-	for(size_t row=0;row<operand.getRow();++row)
+	for(size_t row=0;row<getRow();++row)
 	{
-		std::vector<node_t>&	vec		=	operand.mData[row].mVector;
-
-		for(size_t cnt=0;cnt<vec.size();++cnt)
-		{
-			size_t	col		=	vec[cnt].mCol;
-
-			result.setElem	(	row,
-									col,
-									result.getElem(row, col) - vec[cnt].mElem
-								);
-		}
-
-		//for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-		//{
-		//	result.setElem	(	row,
-		//							itor->mCol,
-		//							result.getElem(row, itor->mCol) - itor->mElem
-		//						);
-		//}
+		mergeRow_	(	mData[row].mVector,
+						operand.mData[row].mVector,
+						-1,
+						result.mData[row].mVector
+					);
 	}
 
 	return	result;
@@ -228,28 +299,25 @@ SparseMatrix	SparseMatrix::sub	(	const SparseMatrix&	operand	///< 피연산자
  * 쓰레드 행렬 뺄셈
  * @return 행렬 뺄셈 결과
  */
-SparseMatrix	SparseMatrix::psub	(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::psub	(	const BasicSparseMatrix&	operand	///< 피연산자
 										) const
 {
 	chkSameSize(operand);
+	chkSorted();
+	operand.chkSorted();
 
-	SparseMatrix	result		=	SparseMatrix(getRow(), getCol());
+	BasicSparseMatrix	result		=	BasicSparseMatrix(getRow(), getCol());
 
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	if( ThreadPool::getInstance().isSerial(getSize() + operand.getSize()) == true )
 	{
-		result.equal(*this);
-
-		for(size_t row=0;row<operand.getRow();++row)
+		for(size_t row=0;row<getRow();++row)
 		{
-			std::vector<node_t>&	vec		=	operand.mData[row].mVector;
-
-			for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-			{
-				result.setElem	(	row,
-										itor->mCol,
-										result.getElem(row, itor->mCol) - itor->mElem
-									);
-			}
+			mergeRow_	(	mData[row].mVector,
+							operand.mData[row].mVector,
+							-1,
+							result.mData[row].mVector
+						);
 		}
 	}
 	else
@@ -270,33 +338,30 @@ SparseMatrix	SparseMatrix::psub	(	const SparseMatrix&	operand	///< 피연산자
  * 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-SparseMatrix	SparseMatrix::multiply	(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::multiply	(	const BasicSparseMatrix&	operand	///< 피연산자
 											) const
 {
-	if( ( getRow() != operand.getCol() ) &&
-		( getCol() != operand.getRow() ) )
+	if( getCol() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix	result	=	SparseMatrix(getRow(), operand.getCol());
+	chkSorted();
+	operand.chkSorted();
+
+	BasicSparseMatrix			result	=	BasicSparseMatrix(getRow(), operand.getCol());
+	row_t		vec;
+	row_t		buffer;
 
 	for(size_t row=0;row<getRow();++row)
 	{
-		std::vector<node_t>&	vec		=	mData[row].mVector;
-
-		for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-		{
-			std::vector<node_t>&	vec2	=	operand.mData[itor->mCol].mVector;
-
-			for(elem_vector_itor itor2=vec2.begin();itor2!=vec2.end();itor2++)
-			{
-				result.setElem	(	row,
-										itor2->mCol,
-										result.getElem(row, itor2->mCol) + (itor->mElem * itor2->mElem)
-									);
-			}
-		}
+		multiplyRow_	(	mData[row].mVector,
+							operand.mData,
+							vec,
+							buffer
+						);
+		storeRow_(result.mData[row].mVector, vec);
 	}
 
 	return	result;
@@ -306,35 +371,33 @@ SparseMatrix	SparseMatrix::multiply	(	const SparseMatrix&	operand	///< 피연산
  * 쓰레드 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-SparseMatrix	SparseMatrix::pmultiply		(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::pmultiply		(	const BasicSparseMatrix&	operand	///< 피연산자
 												) const
 {
-	if( ( getRow() != operand.getCol() ) &&
-		( getCol() != operand.getRow() ) )
+	if( getCol() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix	result	=	SparseMatrix(getRow(), operand.getCol());
+	chkSorted();
+	operand.chkSorted();
 
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	BasicSparseMatrix	result	=	BasicSparseMatrix(getRow(), operand.getCol());
+
+	if( ThreadPool::getInstance().isSerial(getSize()) == true )
 	{
+		row_t		vec;
+		row_t		buffer;
+
 		for(size_t row=0;row<getRow();++row)
 		{
-			std::vector<node_t>&	vec		=	mData[row].mVector;
-
-			for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-			{
-				std::vector<node_t>&	vec2	=	operand.mData[itor->mCol].mVector;
-
-				for(elem_vector_itor itor2=vec2.begin();itor2!=vec2.end();itor2++)
-				{
-					result.setElem	(	row,
-											itor2->mCol,
-											result.getElem(row, itor2->mCol) + (itor->mElem * itor2->mElem)
-										);
-				}
-			}
+			multiplyRow_	(	mData[row].mVector,
+								operand.mData,
+								vec,
+								buffer
+							);
+			storeRow_(result.mData[row].mVector, vec);
 		}
 	}
 	else
@@ -355,21 +418,29 @@ SparseMatrix	SparseMatrix::pmultiply		(	const SparseMatrix&	operand	///< 피연
  * 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-SparseMatrix	SparseMatrix::multiply	(	elem_t		operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::multiply	(	elem_t		operand	///< 피연산자
 											) const
 {
-	SparseMatrix	result	=	SparseMatrix(getRow(), getCol());
+	chkSorted();
+
+	BasicSparseMatrix	result	=	BasicSparseMatrix(getRow(), getCol());
 
 	for(size_t row=0;row<getRow();++row)
 	{
-		std::vector<node_t>&	vec		=	mData[row].mVector;
+		row_t&	vec		=	mData[row].mVector;
+		row_t&	vecRet	=	result.mData[row].mVector;
+
+		vecRet.reserve(vec.size());
 
 		for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
 		{
-			result.setElem	(	row,
-									itor->mCol,
-									itor->mElem * operand
-								);
+			elem_t		val		=	itor->mElem * operand;
+
+			if( val != elem_t(0) )
+			{
+				vecRet.push_back(node_t(itor->mCol, val));
+			}
 		}
 	}
 
@@ -380,23 +451,31 @@ SparseMatrix	SparseMatrix::multiply	(	elem_t		operand	///< 피연산자
  * 쓰레드 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-SparseMatrix	SparseMatrix::pmultiply	(	elem_t		operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::pmultiply	(	elem_t		operand	///< 피연산자
 											) const
 {
-	SparseMatrix	result	=	SparseMatrix(getRow(), getCol());
+	chkSorted();
 
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	BasicSparseMatrix	result	=	BasicSparseMatrix(getRow(), getCol());
+
+	if( ThreadPool::getInstance().isSerial(getSize()) == true )
 	{
 		for(size_t row=0;row<getRow();++row)
 		{
-			std::vector<node_t>&	vec		=	mData[row].mVector;
+			row_t&	vec		=	mData[row].mVector;
+			row_t&	vecRet	=	result.mData[row].mVector;
+
+			vecRet.reserve(vec.size());
 
 			for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
 			{
-				result.setElem	(	row,
-										itor->mCol,
-										itor->mElem * operand
-									);
+				elem_t		val		=	itor->mElem * operand;
+
+				if( val != elem_t(0) )
+				{
+					vecRet.push_back(node_t(itor->mCol, val));
+				}
 			}
 		}
 	}
@@ -415,33 +494,38 @@ SparseMatrix	SparseMatrix::pmultiply	(	elem_t		operand	///< 피연산자
 }
 
 /**
- * 뒤 전치행렬 변환 후 앞 행렬 곱셈
- * @return 행렬 곱셈 결과
+ * 전치 행렬
+ * 열 별 요소 수를 세어 결과 행 공간을 먼저 확보한 후, 행 순서로 요소를 옮겨 O(요소 수)에 만든다.
+ * 행 순서로 옮기므로 결과의 각 행은 열 순서로 정렬 된다.
+ * @return 전치 행렬
  */
-SparseMatrix	SparseMatrix::tmultiply		(	const SparseMatrix&	operand	///< 피연산자
-												) const
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::transpose		(	void	) const
 {
-	if( getCol() != operand.getCol() )
-	{
-		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
-	}
+	chkSorted();
 
-	SparseMatrix	result	=	SparseMatrix(getRow(), operand.getRow());
+	BasicSparseMatrix		result	=	BasicSparseMatrix(getCol(), getRow());
+	std::vector<size_t>		count(getCol(), 0);
 
-	for (size_t row = 0; row < getRow(); ++row)
+	for(size_t row=0;row<getRow();++row)
 	{
-		std::vector<node_t>& vec = mData[row].mVector;
+		const row_t&	vec		=	mData[row].mVector;
 
-		for (size_t col = 0; col < operand.getRow(); ++col)
+		for(elem_vector_citor itor=vec.begin();itor!=vec.end();++itor)
 		{
-			elem_t sum = 0;
+			count[itor->mCol]++;
+		}
+	}
 
-			for (elem_vector_itor itor = vec.begin(); itor < vec.end(); ++itor)
-			{
-				sum += itor->mElem * operand.getElem(col, itor->mCol);
-			}
+	result.reserveRows(count.data());
 
-			result.setElem(row, col, sum);
+	for(size_t row=0;row<getRow();++row)
+	{
+		const row_t&	vec		=	mData[row].mVector;
+
+		for(elem_vector_citor itor=vec.begin();itor!=vec.end();++itor)
+		{
+			result.mData[itor->mCol].mVector.push_back(node_t(row, itor->mElem));
 		}
 	}
 
@@ -449,143 +533,81 @@ SparseMatrix	SparseMatrix::tmultiply		(	const SparseMatrix&	operand	///< 피연
 }
 
 /**
- * 쓰레드 뒤 전치행렬 변환 후 앞 행렬 곱셈
+ * 뒤 전치행렬 변환 후 앞 행렬 곱셈 (A * B^T)
+ * 뒤 행렬의 열 접근 형식 (전치 행렬)을 만든 후 행렬 곱셈을 한다.
  * @return 행렬 곱셈 결과
  */
-SparseMatrix	SparseMatrix::ptmultiply	(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::tmultiply		(	const BasicSparseMatrix&	operand	///< 피연산자
 												) const
 {
-	if( ( getCol() != operand.getCol() ) &&
-		( getRow() != operand.getRow() ) )
+	if( getCol() != operand.getCol() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix	result	=	SparseMatrix(getRow(), operand.getCol());
-
-	if( getRow() < THREAD_FUNC_THRESHOLD )
-	{
-		for (size_t row = 0; row < getRow(); ++row)
-		{
-			std::vector<node_t>& vec = mData[row].mVector;
-
-			for (size_t col = 0; col < operand.getRow(); ++col)
-			{
-				elem_t sum = 0;
-
-				for (elem_vector_itor itor = vec.begin(); itor < vec.end(); ++itor)
-				{
-					sum += itor->mElem * operand.getElem(col, itor->mCol);
-				}
-
-				result.setElem(row, col, sum);
-			}
-		}
-	}
-	else
-	{
-		OpInfo		info;
-
-		info.operandA		=	this;
-		info.operandB		=	&operand;
-		info.result		=	&result;
-
-		doThreadFunc(FUNC_TMULTIPLY, info);
-	}
-
-	return	result;
+	return	multiply(operand.transpose());
 }
 
 /**
- * 앞 전치행렬 변환 후 뒤 행렬 곱셈
+ * 쓰레드 뒤 전치행렬 변환 후 앞 행렬 곱셈 (A * B^T)
+ * 뒤 행렬의 열 접근 형식 (전치 행렬)을 만든 후 쓰레드 행렬 곱셈을 한다.
  * @return 행렬 곱셈 결과
  */
-SparseMatrix	SparseMatrix::stmultiply		(	const SparseMatrix&	operand	) const
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::ptmultiply	(	const BasicSparseMatrix&	operand	///< 피연산자
+												) const
 {
-	if( ( getCol() != operand.getCol() ) &&
-		( getRow() != operand.getRow() ) )
+	if( getCol() != operand.getCol() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix	result	=	SparseMatrix(getCol(), operand.getCol());
-
-	for(size_t row=0;row<getRow();++row)
-	{
-		std::vector<node_t>&	vec		=	mData[row].mVector;
-
-		for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-		{
-			std::vector<node_t>&	vec2	=	operand.mData[row].mVector;
-
-			for(elem_vector_itor itor2=vec2.begin();itor2!=vec2.end();itor2++)
-			{
-				result.setElem	(	itor->mCol,
-										itor2->mCol,
-										result.getElem(itor->mCol, itor2->mCol) + (itor->mElem * itor2->mElem)
-									);
-			}
-		}
-	}
-
-	return	result;
+	return	pmultiply(operand.transpose());
 }
 
 /**
- * 쓰레드 앞 전치행렬 변환 후 뒤 행렬 곱셈
+ * 앞 전치행렬 변환 후 뒤 행렬 곱셈 (A^T * B)
+ * 앞 행렬의 열 접근 형식 (전치 행렬)을 만든 후 행렬 곱셈을 한다.
  * @return 행렬 곱셈 결과
  */
-SparseMatrix	SparseMatrix::pstmultiply	(	const SparseMatrix&	operand	) const
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::stmultiply		(	const BasicSparseMatrix&	operand	) const
 {
-	if( ( getCol() != operand.getCol() ) &&
-		( getRow() != operand.getRow() ) )
+	if( getRow() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix	result	=	SparseMatrix(getCol(), operand.getCol());
-
-	if( getRow() < THREAD_FUNC_THRESHOLD )
-	{
-		for(size_t row=0;row<getRow();++row)
-		{
-			std::vector<node_t>&	vec		=	mData[row].mVector;
-
-			for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-			{
-				std::vector<node_t>&	vec2	=	operand.mData[row].mVector;
+	return	transpose().multiply(operand);
+}
 
-				for(elem_vector_itor itor2=vec2.begin();itor2!=vec2.end();itor2++)
-				{
-					result.setElem	(	itor->mCol,
-										itor2->mCol,
-										result.getElem(itor->mCol, itor2->mCol) + (itor->mElem * itor2->mElem)
-									);
-				}
-			}
-		}
-	}
-	else
+/**
+ * 쓰레드 앞 전치행렬 변환 후 뒤 행렬 곱셈 (A^T * B)
+ * 앞 행렬의 전치 행렬을 만든 후 쓰레드 행렬 곱셈을 하므로, 각 쓰레드는 자신이 맡은 결과 행만 쓴다.
+ * @return 행렬 곱셈 결과
+ */
+template<class T, class I>
+BasicSparseMatrix<T, I>	BasicSparseMatrix<T, I>::pstmultiply	(	const BasicSparseMatrix&	operand	) const
+{
+	if( getRow() != operand.getRow() )
 	{
-		OpInfo		info;
-
-		info.operandA	=	this;
-		info.operandB	=	&operand;
-		info.result		=	&result;
-
-		doThreadFunc(FUNC_STMULTIPLY, info);
+		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	return	result;
+	return	transpose().pmultiply(operand);
 }
 
 /**
  * 행렬 대입
  * @return 대입 할 행렬
  */
-const SparseMatrix&		SparseMatrix::equal			(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::equal			(	const BasicSparseMatrix&	operand	///< 피연산자
 													)
 {
+	operand.chkSorted();
+
 	try
 	{
 		chkSameSize(operand);
@@ -605,9 +627,12 @@ const SparseMatrix&		SparseMatrix::equal			(	const SparseMatrix&	operand	///< 
  * 쓰레드 행렬 대입
  * @return 대입 할 행렬
  */
-const SparseMatrix&		SparseMatrix::pequal	(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::pequal	(	const BasicSparseMatrix&	operand	///< 피연산자
 														)
 {
+	operand.chkSorted();
+
 	try
 	{
 		chkSameSize(operand);
@@ -627,7 +652,8 @@ const SparseMatrix&		SparseMatrix::pequal	(	const SparseMatrix&	operand	///< 피
  * 행렬 비교 연산
  * @return 두 행렬이 일치하면 true, 비 일치하면 false
  */
-bool		SparseMatrix::compare		(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+bool		BasicSparseMatrix<T, I>::compare		(	const BasicSparseMatrix&	operand	///< 피연산자
 											) const
 {
 	bool	ret		=	true;
@@ -636,12 +662,20 @@ bool		SparseMatrix::compare		(	const SparseMatrix&	operand	///< 피연산자
 	{
 		for(size_t row=0;row<getRow();++row)
 		{
-			std::vector<node_t>&	vec		=	mData[row].mVector;
+			row_t&	vec		=	mData[row].mVector;
+			row_t&	vec2	=	operand.mData[row].mVector;
 
-			for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
+			if( vec.size() != vec2.size() )
+			{
+				ret		=	false;
+				break;
+			}
+
+			// 정렬 된 행이므로 같은 위치의 요소끼리 비교
+			for(size_t cnt=0;cnt<vec.size();++cnt)
 			{
-				elem_t	val		=	operand.getElem(row, itor->mCol);
-				if( itor->mElem != val )
+				if( ( vec[cnt].mCol != vec2[cnt].mCol ) ||
+					( vec[cnt].mElem != vec2[cnt].mElem ) )
 				{
 					ret		=	false;
 					break;
@@ -666,14 +700,15 @@ bool		SparseMatrix::compare		(	const SparseMatrix&	operand	///< 피연산자
  * 쓰레드 행렬 비교 연산
  * @return 두 행렬이 일치하면 true, 비 일치하면 false
  */
-bool			SparseMatrix::pcompare		(	const SparseMatrix&	operand	///< 피연산자
+template<class T, class I>
+bool			BasicSparseMatrix<T, I>::pcompare		(	const BasicSparseMatrix&	operand	///< 피연산자
 											) const
 {
 	bool	ret		=	true;
 
 	if( getSize() == operand.getSize() )
 	{
-		if( getRow() < THREAD_FUNC_THRESHOLD )
+		if( ThreadPool::getInstance().isSerial(getSize()) == true )
 		{
 			ret		=	compare(operand);
 		}
@@ -698,82 +733,274 @@ bool			SparseMatrix::pcompare		(	const SparseMatrix&	operand	///< 피연산자
 }
 
 /**
- * 행렬 방정식 해 구하기
- * @return		해 행렬 리턴
+ * 행렬 데이터 맞바꾸기
  */
-SparseMatrix		SparseMatrix::sol_cg		(	const SparseMatrix&	operand	///< 피연산자
-												)
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::swap			(	BasicSparseMatrix&		operand		///< 맞바꿀 행렬
+											)
+{
+	std::swap(mRowSize, operand.mRowSize);
+	std::swap(mColSize, operand.mColSize);
+	std::swap(mData, operand.mData);
+	mSorted		=	operand.mSorted.exchange(mSorted);
+	std::swap(mArena, operand.mArena);
+}
+
+/**
+ * 행렬 x 단일 값 덧셈 (this = this + alpha * operand)
+ * 임시 행렬을 만들지 않고 자신의 행을 갱신한다.
+ * @return 연산 결과
+ */
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::axpy		(	elem_t					alpha,		///< 피연산자 계수
+														const BasicSparseMatrix&		operand		///< 피연산자
+													)
 {
-	elem_t	rangeResult = 0.0;
+	chkSameSize(operand);
 
-	return sol_cg	(	operand,
-						SparseMatrix(this->getCol(), operand.getCol()),
-						32,
-						0.0001,
-						ABSOLUTE,
-						rangeResult
-					);
+	updateElems(alpha, &operand, 1);
+
+	return	*this;
 }
 
-SparseMatrix		SparseMatrix::sol_cg		(	const SparseMatrix&	operand,
-													const SparseMatrix&	init,
-													uint32_t				iteration,
-													elem_t					limit,
-													CG_LimitType			limitType,
-													elem_t&				rangeResult
-												)
+/**
+ * 행렬 x 단일 값 (this = alpha * this)
+ * @return 연산 결과
+ */
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::scale		(	elem_t		alpha	///< 곱할 값
+													)
 {
-	SparseMatrix		x			=	init;
-	SparseMatrix		r			=	operand - ( (*this) * x );
-	SparseMatrix		p			=	r;
-	SparseMatrix		rSold		=	r.stmultiply(r);
-	SparseMatrix		result		=	x;
-	elem_t		min			=	1000;
-	elem_t		preVal		=	0;
-	bool		foundFlag	=	false;
+	updateElems(0, NULL, alpha);
 
-	for(size_t cnt=0;cnt<iteration;++cnt)
-	{
-		SparseMatrix	ap		=	(*this) * p;
+	return	*this;
+}
 
-		elem_t			ptval	=	(p.stmultiply(ap)).getElem(0,0);
-		elem_t			alpha	=	rSold.getElem(0,0) / ptval;
+/**
+ * 행렬 x 단일 값 후 덧셈 (this = alpha * this + operand)
+ * @return 연산 결과
+ */
+template<class T, class I>
+const BasicSparseMatrix<T, I>&		BasicSparseMatrix<T, I>::scale_add	(	elem_t					alpha,		///< 자신에 곱할 값
+														const BasicSparseMatrix&		operand		///< 피연산자
+													)
+{
+	chkSameSize(operand);
 
-		x	=	x + (p * alpha);
-		r	=	r - (ap * alpha);
+	updateElems(1, &operand, alpha);
 
-		SparseMatrix	rsNew	=	r.stmultiply(r);
+	return	*this;
+}
 
-		elem_t		sqrtVal	=	sqrt(rsNew.getElem(0,0));
+/**
+ * 선형 결합 (this = coef[0] * operand[0] + ... + coef[num-1] * operand[num-1])
+ * 행 별로 모든 피연산자의 행을 한 번에 병합하여 결과 행과 맞바꾸므로,
+ * 자신이 피연산자이어도 된다.
+ * @exception 피연산자 크기가 다르거나 메모리 할당 실패 시 예외 발생
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::combine		(	size_t						num,		///< 항 수
+												const elem_t				coef[],		///< 항 별 계수
+												const BasicSparseMatrix* const	operand[]	///< 항 별 피연산자
+											)
+{
+	size_t		work	=	0;
 
-		if( min > sqrtVal )
-		{
-			min				=	sqrtVal;
-			rangeResult	=	sqrtVal;
-			result			=	x;
-		}
+	for(size_t cnt=0;cnt<num;++cnt)
+	{
+		operand[0]->chkSameSize(*operand[cnt]);
+		operand[cnt]->chkSorted();
 
-		switch( limitType )
-		{
-		case ABSOLUTE:
-			if( sqrtVal < limit )
+		work	+=	operand[cnt]->getSize();
+	}
+
+	if( ( getRow() != operand[0]->getRow() ) ||
+		( getCol() != operand[0]->getCol() ) )
+	{
+		freeElems();
+		allocElems(operand[0]->getRow(), operand[0]->getCol());
+	}
+
+	if( ThreadPool::getInstance().isSerial(work) == true )
+	{
+		row_t		vec;
+		row_t		buffer;
+
+		for(size_t row=0;row<getRow();++row)
+		{
+			combineRow_(num, coef, operand, row, vec, buffer);
+			storeRow_(mData[row].mVector, vec);
+		}
+	}
+	else
+	{
+		OpInfo	info;
+
+		info.termNum	=	num;
+		info.coef		=	coef;
+		info.terms		=	operand;
+		info.result		=	this;
+
+		doThreadFunc(FUNC_COMBINE, info);
+	}
+
+	mSorted		=	true;
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x)
+ * x는 getCol() 개, y는 getRow() 개의 연속 된 요소 배열이며, 메모리를 할당하지 않는다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::spmv		(	const elem_t	x[],	///< 입력 벡터
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	spmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y)
+ * beta가 0이면 y의 기존 값은 읽지 않는다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::spmv		(	elem_t			alpha,	///< 행렬 x 벡터 계수
+									const elem_t	x[],	///< 입력 벡터
+									elem_t			beta,	///< 결과 벡터 계수
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	chkSorted();
+
+	spmvRows(alpha, x, beta, y, 0, getRow());
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x, 쓰레드 사용)
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::pspmv		(	const elem_t	x[],	///< 입력 벡터
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	pspmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y, 쓰레드 사용)
+ * 행 단위로 나누어 쓰레드 풀에서 수행하며, 각 쓰레드는 자기 행의 y만 쓴다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::pspmv		(	elem_t			alpha,	///< 행렬 x 벡터 계수
+									const elem_t	x[],	///< 입력 벡터
+									elem_t			beta,	///< 결과 벡터 계수
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	chkSorted();
+
+	if( ThreadPool::getInstance().isSerial(getSize()) == true )
+	{
+		spmvRows(alpha, x, beta, y, 0, getRow());
+	}
+	else
+	{
+		OpInfo		info;
+
+		info.operandA		=	this;
+		info.elemOperandB	=	alpha;
+		info.vecX			=	x;
+		info.vecY			=	y;
+		info.beta			=	beta;
+
+		doThreadFunc(FUNC_SPMV, info);
+	}
+}
+
+/**
+ * 행렬 방정식 해 구하기
+ * @return		해 행렬 리턴
+ */
+template<class T, class I>
+BasicSparseMatrix<T, I>		BasicSparseMatrix<T, I>::sol_cg		(	const BasicSparseMatrix&	operand	///< 피연산자
+												)
+{
+	real_t	rangeResult = 0.0;
+
+	return sol_cg	(	operand,
+						BasicSparseMatrix(this->getCol(), operand.getCol()),
+						32,
+						0.0001,
+						ABSOLUTE,
+						rangeResult
+					);
+}
+
+template<class T, class I>
+BasicSparseMatrix<T, I>		BasicSparseMatrix<T, I>::sol_cg		(	const BasicSparseMatrix&	operand,
+													const BasicSparseMatrix&	init,
+													uint32_t				iteration,
+													real_t					limit,
+													CG_LimitType			limitType,
+													real_t&				rangeResult
+												)
+{
+	BasicSparseMatrix		x			=	init;
+	BasicSparseMatrix		r			=	operand - ( (*this) * x );
+	BasicSparseMatrix		p			=	r;
+	BasicSparseMatrix		ap;
+	BasicSparseMatrix		result		=	x;
+	elem_t		rSold		=	r.stmultiply(r).getElem(0,0);
+	real_t		min			=	1000;
+	real_t		preVal		=	0;
+	bool		foundFlag	=	false;
+
+	for(size_t cnt=0;cnt<iteration;++cnt)
+	{
+		ap		=	(*this) * p;
+
+		elem_t			ptval	=	(p.stmultiply(ap)).getElem(0,0);
+		elem_t			alpha	=	rSold / ptval;
+
+		x.axpy(alpha, p);
+		r.axpy(-alpha, ap);
+
+		elem_t		rsNew	=	r.stmultiply(r).getElem(0,0);
+		real_t		sqrtVal	=	std::sqrt(std::abs(rsNew));
+
+		if( min > sqrtVal )
+		{
+			min				=	sqrtVal;
+			rangeResult	=	sqrtVal;
+			result			=	x;
+		}
+
+		switch( limitType )
+		{
+		case ABSOLUTE:
+			if( sqrtVal < limit )
 			{
 				rangeResult	=	sqrtVal;
 				foundFlag		=	true;
-				break;
 			}
 			break;
 		case RELATIVE:
-			if( (preVal - sqrtVal) < limit )
+			// 첫 반복은 이전 값이 없으므로 비교하지 않는다.
+			if( ( cnt > 0 ) &&
+				( (preVal - sqrtVal) < limit ) )
 			{
 				rangeResult	=	sqrtVal;
 				foundFlag		=	true;
-				break;
 			}
 			break;
 		}
 
-		p		=	r + ( p * (rsNew.getElem(0,0) / rSold.getElem(0,0) ) );
+		if( foundFlag == true )
+		{
+			break;
+		}
+
+		p.scale_add(rsNew / rSold, r);
 		rSold	=	rsNew;
 
 		preVal = sqrtVal;
@@ -781,7 +1008,7 @@ SparseMatrix		SparseMatrix::sol_cg		(	const SparseMatrix&	operand,
 
 	if( foundFlag != true )
 	{
-		x	=	result;
+		x.swap(result);
 	}
 
 	return	x;
@@ -789,18 +1016,32 @@ SparseMatrix		SparseMatrix::sol_cg		(	const SparseMatrix&	operand,
 
 /**
  * 행렬 데이터 공간 할당
- * @exception 메모리 할당 실패 시 에러 발생
+ * @exception 메모리 할당 실패 또는 열 크기가 위치 형식 범위를 넘을 경우 에러 발생
  */
-void		SparseMatrix::allocElems	(	size_t		row,	///< 행 크기
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::allocElems	(	size_t		row,	///< 행 크기
 												size_t		col		///< 열 크기
 											)
 {
+	if( col > std::numeric_limits<index_t>::max() )
+	{
+		throw matrix::ErrMsg::createErrMsg("열 크기가 위치 형식 범위를 넘습니다.");
+	}
+
 	try
 	{
 		mRowSize	=	row;
 		mColSize	=	col;
 
 		mData	=	new vector_node_t[row];
+
+		if( mArena != NULL )
+		{
+			for(size_t cnt=0;cnt<row;++cnt)
+			{
+				row_t(RowAllocator<node_t>(mArena)).swap(mData[cnt].mVector);
+			}
+		}
 	}
 	catch (	std::bad_alloc&	exception		)
 	{
@@ -810,20 +1051,200 @@ void		SparseMatrix::allocElems	(	size_t		row,	///< 행 크기
 
 /**
  * 행렬 데이터 공간 할당 해제
+ * 행 저장 공간은 모든 행을 해제한 뒤 한 번에 비운다.
  */
-void		SparseMatrix::freeElems		(	void	)
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::freeElems		(	void	)
 {
 	delete[]	mData;
+	mData		=	NULL;
 	mRowSize	=	0;
 	mColSize	=	0;
+
+	if( mArena != NULL )
+	{
+		mArena->reset();
+	}
+}
+
+/**
+ * 행 공간 예약
+ * first touch 모드에서는 연산 종류와 관계 없는 행 분할 (splitRows())로 각 쓰레드가 맡은 행의 공간을 다시 할당하여,
+ * 이후 쓰레드 연산에서 그 행을 맡을 쓰레드의 NUMA 노드에 행 데이터를 둔다. (기존 요소는 유지)
+ * first touch 모드가 아니면 호출한 쓰레드에서 예약만 한다.
+ * @exception 메모리 할당 실패 시 에러 발생
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::reserveRows	(	const size_t	size[]	///< 행 별 예약 크기 (NULL이면 현재 요소 수)
+											)
+{
+	try
+	{
+		if( ThreadPool::getInstance().getFirstTouch() == false )
+		{
+			for(size_t row=0;( size != NULL ) && ( row < getRow() );++row)
+			{
+				mData[row].mVector.reserve(size[row]);
+			}
+		}
+		else if( getRow() > 0 )
+		{
+			OpInfo		info;
+
+			info.result		=	this;
+			info.rowSize	=	size;
+
+			doThreadFunc(FUNC_RESERVE, info);
+		}
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+}
+
+/**
+ * 행 저장 공간 사용 설정
+ * 사용하면 행 데이터를 큰 덩어리에서 잘라 받아 행렬 소멸 또는 clear() 시 한 번에 해제한다.
+ * 설정을 바꾸면 기존 행을 새 공간으로 옮긴다.
+ * @exception 메모리 할당 실패 시 에러 발생
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::setArena		(	bool		use		///< 행 저장 공간 사용 여부
+											)
+{
+	if( use == getArena() )
+	{
+		return;
+	}
+
+	RowArena*	arena	=	NULL;
+
+	if( use == true )
+	{
+		try
+		{
+			arena	=	new RowArena;
+		}
+		catch (	std::bad_alloc&	exception		)
+		{
+			throw matrix::ErrMsg::createErrMsg(exception.what());
+		}
+	}
+
+	moveRows(arena);
+}
+
+/**
+ * 행 데이터 압축
+ * 모든 행을 요소 수에 맞는 크기로 다시 만든다.
+ * 행 저장 공간을 사용하면 새 공간으로 옮겨, 갱신 중 버려진 공간을 돌려준다.
+ * @exception 메모리 할당 실패 시 에러 발생
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::compact		(	void	)
+{
+	RowArena*	arena	=	NULL;
+
+	if( mArena != NULL )
+	{
+		try
+		{
+			arena	=	new RowArena;
+		}
+		catch (	std::bad_alloc&	exception		)
+		{
+			throw matrix::ErrMsg::createErrMsg(exception.what());
+		}
+	}
+
+	moveRows(arena);
+}
+
+/**
+ * 새로 생성하는 행렬의 행 저장 공간 사용 여부 설정
+ * 이미 생성 된 행렬은 바뀌지 않는다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::setDefaultArena	(	bool		use		///< 행 저장 공간 사용 여부
+												)
+{
+	sDefaultArena	=	use;
+}
+
+/**
+ * 새로 생성하는 행렬의 행 저장 공간 사용 여부 가져오기
+ * @return 행 저장 공간을 사용하면 true
+ */
+template<class T, class I>
+bool		BasicSparseMatrix<T, I>::getDefaultArena	(	void	)
+{
+	return	sDefaultArena;
+}
+
+/**
+ * 모든 행을 지정한 공간으로 옮기기
+ * 새 행 배열을 모두 만든 뒤 바꾸므로, 실패하면 기존 데이터가 그대로 남는다.
+ * 성공하면 기존 행 저장 공간은 해제하고 지정한 공간을 소유한다.
+ * @exception 메모리 할당 실패 시 에러 발생
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::moveRows		(	RowArena*	arena	///< 옮길 공간 (NULL이면 힙)
+											)
+{
+	vector_node_t*		data	=	NULL;
+
+	try
+	{
+		if( mData != NULL )
+		{
+			data	=	new vector_node_t[getRow()];
+		}
+
+		for(size_t row=0;row<getRow();++row)
+		{
+			const row_t&	vec		=	mData[row].mVector;
+			row_t			dest	=	row_t(RowAllocator<node_t>(arena));
+
+			dest.assign(vec.begin(), vec.end());
+			data[row].mVector.swap(dest);
+		}
+	}
+	catch (	std::bad_alloc&	exception		)
+	{
+		delete[]	data;
+		delete		arena;
+
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	delete[]	mData;
+	delete		mArena;
+
+	mData	=	data;
+	mArena	=	arena;
 }
 
 /**
  * 행렬 데이터 복사
+ * first touch 모드에서는 행 공간을 먼저 예약하여, 호출한 쓰레드가 복사해도 행을 맡을 쓰레드의 공간에 둔다.
  */
-void		SparseMatrix::copyElems		(	const SparseMatrix&		matrix		///< 복사 할 행렬
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::copyElems		(	const BasicSparseMatrix&		matrix		///< 복사 할 행렬
 										)
 {
+	if( ThreadPool::getInstance().getFirstTouch() == true )
+	{
+		std::vector<size_t>		size(getRow());
+
+		for(size_t row=0;row<getRow();++row)
+		{
+			size[row]	=	matrix.mData[row].mVector.size();
+		}
+
+		reserveRows(size.data());
+	}
+
 	for(size_t row=0;row<getRow();++row)
 	{
 		mData[row].mVector	=	matrix.mData[row].mVector;
@@ -833,16 +1254,13 @@ void		SparseMatrix::copyElems		(	const SparseMatrix&		matrix		///< 복사 할 
 /**
  * 쓰레드 행렬 데이터 복사
  */
-void		SparseMatrix::pcopyElems	(	const SparseMatrix&		matrix		///< 복사 할 행렬
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::pcopyElems	(	const BasicSparseMatrix&		matrix		///< 복사 할 행렬
 										)
 {
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	if( ThreadPool::getInstance().isSerial(matrix.countElems()) == true )
 	{
-		for(size_t row=0;row<getRow();++row)
-		{
-			mData[row].mVector.clear();
-			mData[row]		=	matrix.mData[row];
-		}
+		copyElems(matrix);
 	}
 	else
 	{
@@ -859,7 +1277,8 @@ void		SparseMatrix::pcopyElems	(	const SparseMatrix&		matrix		///< 복사 할 
  * 같은 크기의 행렬인지 검사
  * @exception 행렬이 같은 크기가 아닐 경우 예외 발생
  */
-void		SparseMatrix::chkSameSize	(	const SparseMatrix&		matrix		///< 비교 할 행렬
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::chkSameSize	(	const BasicSparseMatrix&		matrix		///< 비교 할 행렬
 										) const
 {
 	if( ( getRow() != matrix.getRow() ) ||
@@ -873,7 +1292,8 @@ void		SparseMatrix::chkSameSize	(	const SparseMatrix&		matrix		///< 비교 할 
  * 행렬 요소 참조 범위 검사
  * @exception 참조 범위 밖일 경우 예외 발생
  */
-void		SparseMatrix::chkBound		(	size_t		row,	///< 참조 할 행 위치
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::chkBound		(	size_t		row,	///< 참조 할 행 위치
 												size_t		col		///< 참조 할 열 위치
 											) const
 {
@@ -885,244 +1305,342 @@ void		SparseMatrix::chkBound		(	size_t		row,	///< 참조 할 행 위치
 }
 
 /**
- * 쓰레드 연산 시작
+ * 지정한 범위의 행에 대한 행렬 x 벡터
  */
-void		SparseMatrix::doThreadFunc	(	FuncKind	kind,	///< 연산 종류
-												OpInfo&		info	///< 연산 참조 데이터
-											) const
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::spmvRows		(	elem_t			alpha,		///< 행렬 x 벡터 계수
+										const elem_t	x[],		///< 입력 벡터
+										elem_t			beta,		///< 결과 벡터 계수
+										elem_t			y[],		///< 결과 벡터
+										size_t			startRow,	///< 시작 행
+										size_t			endRow		///< 종료 행 (미포함)
+									) const
 {
-	FuncInfo		orgFuncInfo	=	{info, NULL, 0, 0};
-	FuncInfo		funcInfo[THREAD_NUM];
+	for(size_t row=startRow;row<endRow;++row)
+	{
+		elem_t		sum		=	0;
 
-#if(PLATFORM == PLATFORM_WINDOWS)
+		for(elem_vector_citor itor=mData[row].mVector.begin();itor!=mData[row].mVector.end();++itor)
+		{
+			sum		+=	itor->mElem * x[itor->mCol];
+		}
 
-	HANDLE			id[THREAD_NUM];
+		if( beta == elem_t(0) )
+		{
+			y[row]	=	alpha * sum;
+		}
+		else
+		{
+			y[row]	=	alpha * sum + beta * y[row];
+		}
+	}
+}
 
-#elif(PLATFORM == PLATFORM_LINUX)
+/**
+ * 행 정렬 상태 검사
+ * appendElem()으로 추가 된 요소가 정렬 되지 않았으면 정렬한다.
+ * 여러 쓰레드가 같은 행렬을 읽을 때 한 쓰레드만 정렬하도록 잠금을 잡은 후 다시 확인한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::chkSorted		(	void	) const
+{
+	if( mSorted.load(std::memory_order_acquire) == false )
+	{
+		std::lock_guard<std::mutex>		lock(sSortLock);
 
-	pthread_t		id[THREAD_NUM];
+		if( mSorted.load(std::memory_order_acquire) == false )
+		{
+			const_cast<BasicSparseMatrix*>(this)->finalize();
+		}
+	}
+}
 
-#endif
+/**
+ * 자신에 대한 갱신 (this = beta * this + alpha * operand)
+ * operand가 NULL이면 자신에 beta만 곱한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::updateElems	(	elem_t					alpha,		///< 피연산자 계수
+												const BasicSparseMatrix*		operand,	///< 피연산자
+												elem_t					beta		///< 자신에 곱할 값
+											)
+{
+	chkSorted();
 
-	switch( kind )
+	if( operand != NULL )
 	{
-	case FUNC_ADD:
-		orgFuncInfo.func	=	SparseMatrix::threadAdd;
-		break;
-	case FUNC_SUB:
-		orgFuncInfo.func	=	SparseMatrix::threadSub;
-		break;
-	case FUNC_MULTIPLY:
-		orgFuncInfo.func	=	SparseMatrix::threadMultiply;
-		break;
-	case FUNC_ELEM_MUL:
-		orgFuncInfo.func	=	SparseMatrix::threadElemMul;
-		break;
-	case FUNC_TMULTIPLY:
-		orgFuncInfo.func	=	SparseMatrix::threadTmultiply;
-		break;
-	case FUNC_STMULTIPLY:
-		orgFuncInfo.func	=	SparseMatrix::threadStmultiply;
-		break;
-	case FUNC_COMPARE:
-		orgFuncInfo.func	=	SparseMatrix::threadCompare;
-		break;
-	default:
-		break;
+		operand->chkSorted();
 	}
 
-	size_t	threadPerRow	=	getRow() / THREAD_NUM;
-	size_t	rowMod			=	getRow() % THREAD_NUM;
-
-	for(size_t num=0;num<THREAD_NUM;num++)
+	if( ThreadPool::getInstance().isSerial(countElems() + ( ( operand != NULL ) ? operand->countElems() : 0 )) == true )
 	{
-		funcInfo[num]	=	orgFuncInfo;
+		row_t		buffer;
 
-		funcInfo[num].startRow	=	(size_t)(num * threadPerRow);
-		funcInfo[num].endRow		=	funcInfo[num].startRow + threadPerRow - 1;
+		for(size_t row=0;row<getRow();++row)
+		{
+			updateRow_	(	mData[row].mVector,
+							( operand != NULL ) ? &operand->mData[row].mVector : NULL,
+							alpha,
+							beta,
+							buffer
+						);
+		}
 	}
-
-	funcInfo[THREAD_NUM-1].endRow	+=	rowMod;
-
-	// Thread 생성
-	for(size_t num=0;num<THREAD_NUM;num++)
+	else
 	{
-#if(PLATFORM == PLATFORM_WINDOWS)
+		OpInfo	info;
 
-		id[num]	=	(HANDLE)_beginthreadex	(	NULL,
-												0,
-												SparseMatrix::threadFunc,
-												&funcInfo[num],
-												0,
-												NULL
-											);
+		info.operandB		=	operand;
+		info.elemOperandB	=	alpha;
+		info.beta			=	beta;
+		info.result			=	this;
 
-#elif(PLATFORM == PLATFORM_LINUX)
+		doThreadFunc(FUNC_AXPBY, info);
+	}
+}
 
-		pthread_create	(	&id[num],
-								NULL,
-								SparseMatrix::threadFunc,
-								&funcInfo[num]
-							);
+/**
+ * 행 구간 나누기
+ * 연산이 읽는 행의 요소 수 (빈 행도 1로 센다)가 비슷하도록 나눈다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::splitRows	(	FuncKind		kind,		///< 연산 종류
+												const OpInfo&	info,		///< 연산 참조 데이터
+												size_t			partNum,	///< 구간 수
+												size_t			bound[]		///< 구간 별 시작 행 (partNum + 1 개)
+											) const
+{
+	// first touch 모드에서는 행을 맡는 쓰레드가 연산마다 바뀌지 않도록 연산 종류와 관계 없이 행 수로 나눈다.
+	if( ThreadPool::getInstance().getFirstTouch() == true )
+	{
+		for(size_t num=0;num<=partNum;++num)
+		{
+			bound[num]	=	getRow() * num / partNum;
+		}
 
-#endif
+		return;
 	}
 
-	for(size_t num=0;num<THREAD_NUM;num++)
+	std::vector<size_t>		weight(getRow() + 1, 0);
+
+	for(size_t row=0;row<getRow();++row)
 	{
+		size_t		size	=	1;
+
 		switch( kind )
 		{
-		case FUNC_COMPARE:
+		case FUNC_COPY:
+			size	+=	info.operandB->mData[row].mVector.size();
+			break;
+		case FUNC_AXPBY:
+			size	+=	mData[row].mVector.size();
+
+			if( info.operandB != NULL )
+			{
+				size	+=	info.operandB->mData[row].mVector.size();
+			}
+			break;
+		case FUNC_COMBINE:
+			for(size_t cnt=0;cnt<info.termNum;++cnt)
 			{
-				THREAD_RETURN_TYPE	retVal		=	(THREAD_RETURN_TYPE)FALSE;
+				size	+=	info.terms[cnt]->mData[row].mVector.size();
+			}
+			break;
+		default:
+			size	+=	mData[row].mVector.size();
+			break;
+		}
 
-				info.retVal		=	(THREAD_RETURN_TYPE)TRUE;
+		weight[row+1]	=	weight[row] + size;
+	}
 
-#if(PLATFORM == PLATFORM_WINDOWS)
+	ThreadPool::splitRows(&weight[0], getRow(), partNum, bound);
+}
 
-				::WaitForSingleObjectEx	(	id[num],
-											INFINITE,
-											FALSE
-										);
+/**
+ * 쓰레드 연산 시작
+ * 행 구간은 요소 수가 비슷하도록 나누며, 행 별 계산량이 피연산자 B에 따라 달라지는 곱셈은
+ * 구간을 조각으로 더 잘게 나누어 작업 훔치기로 수행한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::doThreadFunc	(	FuncKind	kind,	///< 연산 종류
+												OpInfo&		info	///< 연산 참조 데이터
+											) const
+{
+	ThreadPool&				pool		=	ThreadPool::getInstance();
+	size_t					threadNum	=	pool.getTaskNum(getRow());
+	FuncInfo				orgFuncInfo	=	{info, NULL, 0, 0, NULL, NULL, 0};
+	bool					useChunk	=	false;
+	std::vector<FuncInfo>			funcInfo(threadNum);
+	std::vector<void*>				args(threadNum);
+	std::vector<THREAD_RETURN_TYPE>	retVal(threadNum);
 
-				::GetExitCodeThread(id[num], (LPDWORD)&retVal);
+	switch( kind )
+	{
+	case FUNC_ADD:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadAdd;
+		break;
+	case FUNC_SUB:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadSub;
+		break;
+	case FUNC_MULTIPLY:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadMultiply;
+		useChunk			=	true;
+		break;
+	case FUNC_ELEM_MUL:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadElemMul;
+		break;
+	case FUNC_COMPARE:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadCompare;
+		break;
+	case FUNC_SPMV:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadSpmv;
+		break;
+	default:
+		break;
+	}
 
-				::CloseHandle(id[num]);
+	size_t					chunkNum	=	useChunk ? pool.getChunkNum(threadNum, getRow()) : threadNum;
+	std::vector<size_t>		bound(chunkNum + 1);
 
-#elif(PLATFORM == PLATFORM_LINUX)
+	splitRows(kind, info, chunkNum, &bound[0]);
 
-				pthread_join(id[num], &retVal);
+	ChunkQueue				queue(threadNum, chunkNum);
 
-#endif
+	for(size_t num=0;num<threadNum;num++)
+	{
+		funcInfo[num]	=	orgFuncInfo;
 
-				info.retVal	=	(THREAD_RETURN_TYPE)((unsigned long)info.retVal & (unsigned long)retVal);
-			}
-			break;
-		default:
+		funcInfo[num].startRow	=	bound[num];
+		funcInfo[num].endRow		=	bound[num+1] - 1;
 
-#if(PLATFORM == PLATFORM_WINDOWS)
+		if( useChunk == true )
+		{
+			funcInfo[num].queue			=	&queue;
+			funcInfo[num].chunkStart	=	&bound[0];
+			funcInfo[num].task			=	num;
+		}
 
-			::WaitForSingleObjectEx	(	id[num],
-										INFINITE,
-										FALSE
-									);
-			::CloseHandle(id[num]);
+		args[num]		=	&funcInfo[num];
+	}
 
-#elif(PLATFORM == PLATFORM_LINUX)
+	// 쓰레드 풀에서 수행
+	pool.execute	(	BasicSparseMatrix::threadFunc,
+						&args[0],
+						&retVal[0],
+						threadNum
+					);
 
-			pthread_join(id[num], NULL);
+	if( kind == FUNC_COMPARE )
+	{
+		info.retVal		=	(THREAD_RETURN_TYPE)TRUE;
 
-#endif
-			break;
+		for(size_t num=0;num<threadNum;num++)
+		{
+			info.retVal	=	(THREAD_RETURN_TYPE)((unsigned long)info.retVal & (unsigned long)retVal[num]);
 		}
 	}
 }
 
 /**
  * 쓰레드 연산 시작
+ * 행 구간은 요소 수가 비슷하도록 나눈다.
  */
-void		SparseMatrix::doThreadFunc	(	FuncKind	kind,	///< 연산 종류
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::doThreadFunc	(	FuncKind	kind,	///< 연산 종류
 												OpInfo&		info	///< 연산 참조 데이터
 											)
 {
-	FuncInfo		orgFuncInfo	=	{info, NULL, 0, 0};
-	FuncInfo		funcInfo[THREAD_NUM];
-
-#if(PLATFORM == PLATFORM_WINDOWS)
-
-	HANDLE			id[THREAD_NUM];
-
-#elif(PLATFORM == PLATFORM_LINUX)
-
-	pthread_t		id[THREAD_NUM];
-
-#endif
+	ThreadPool&				pool		=	ThreadPool::getInstance();
+	size_t					threadNum	=	pool.getTaskNum(getRow());
+	FuncInfo				orgFuncInfo	=	{info, NULL, 0, 0, NULL, NULL, 0};
+	std::vector<FuncInfo>	funcInfo(threadNum);
+	std::vector<void*>		args(threadNum);
 
 	switch( kind )
 	{
 	case FUNC_COPY:
-		orgFuncInfo.func	=	SparseMatrix::threadCopy;
+		orgFuncInfo.func	=	BasicSparseMatrix::threadCopy;
+		break;
+	case FUNC_SORT:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadSort;
+		break;
+	case FUNC_AXPBY:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadAxpby;
+		break;
+	case FUNC_COMBINE:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadCombine;
+		break;
+	case FUNC_RESERVE:
+		orgFuncInfo.func	=	BasicSparseMatrix::threadReserve;
 		break;
 	default:
 		break;
 	}
 
-	size_t	threadPerRow	=	getRow() / THREAD_NUM;
-	size_t	rowMod			=	getRow() % THREAD_NUM;
+	std::vector<size_t>		bound(threadNum + 1);
 
-	for(size_t num=0;num<THREAD_NUM;num++)
+	splitRows(kind, info, threadNum, &bound[0]);
+
+	for(size_t num=0;num<threadNum;num++)
 	{
 		funcInfo[num]	=	orgFuncInfo;
 
-		funcInfo[num].startRow	=	(size_t)(num * threadPerRow);
-		funcInfo[num].endRow	=	funcInfo[num].startRow + threadPerRow - 1;
-	}
-
-	funcInfo[THREAD_NUM-1].endRow	+=	rowMod;
+		funcInfo[num].startRow	=	bound[num];
+		funcInfo[num].endRow		=	bound[num+1] - 1;
 
-	// Thread 생성
-	for(size_t num=0;num<THREAD_NUM;num++)
-	{
-#if(PLATFORM == PLATFORM_WINDOWS)
-
-		id[num]	=	(HANDLE)_beginthreadex	(	NULL,
-												0,
-												SparseMatrix::threadFunc,
-												&funcInfo[num],
-												0,
-												NULL
-											);
+		args[num]		=	&funcInfo[num];
+	}
 
-#elif(PLATFORM == PLATFORM_LINUX)
+	// 쓰레드 풀에서 수행
+	pool.execute	(	BasicSparseMatrix::threadFunc,
+						&args[0],
+						NULL,
+						threadNum
+					);
+}
 
-		pthread_create	(	&id[num],
-								NULL,
-								SparseMatrix::threadFunc,
-								&funcInfo[num]
-							);
+/**
+ * 작업 쓰레드 함수
+ * 조각 큐가 있으면 남은 조각이 없을 때까지 조각을 가져와 그 행 구간을 수행한다.
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadFunc			(	void*	pData	)
+{
+	FuncInfo*	info	=	(FuncInfo*)pData;
+	size_t		chunk	=	0;
 
-#endif
+	if( info->queue == NULL )
+	{
+		return	info->func(info);
 	}
 
-	for(size_t num=0;num<THREAD_NUM;num++)
+	while( info->queue->pop(info->task, chunk) == true )
 	{
-#if(PLATFORM == PLATFORM_WINDOWS)
-
-		::WaitForSingleObjectEx	(	id[num],
-									INFINITE,
-									FALSE
-								);
-		::CloseHandle(id[num]);
+		info->startRow	=	info->chunkStart[chunk];
+		info->endRow	=	info->chunkStart[chunk+1] - 1;
 
-#elif(PLATFORM == PLATFORM_LINUX)
-
-		pthread_join(id[num], NULL);
-
-#endif
+		info->func(info);
 	}
-}
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadFunc			(	void*	pData	)
-{
-	FuncInfo*	info	=	(FuncInfo*)pData;
-
-	return	info->func(info);
+	return	NULL;
 }
 
 /**
  * 지정한 범위의 행에 대한 행렬 덧셈
  * return 항상 NULL을 리턴
  */
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadAdd			(	void*	pData	)
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadAdd			(	void*	pData	)
 {
 	FuncInfo*		info		=	(FuncInfo*)pData;
 	size_t			start		=	info->startRow;
 	size_t			end			=	info->endRow;
 	size_t			range		=	end - start;
 
-	const SparseMatrix&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix&		result		=	*info->opInfo.result;
+	const BasicSparseMatrix&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix&	operandB	=	*info->opInfo.operandB;
+	BasicSparseMatrix&		result		=	*info->opInfo.result;
 
 	vector_node_t*		nodeA		=	&operandA.mData[start];
 	vector_node_t*		nodeB		=	&operandB.mData[start];
@@ -1130,399 +1648,377 @@ THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadAdd			(	void*	pData	)
 
 	for(size_t row=0;row<=range;++row)
 	{
-		nodeRet[row]	=	nodeA[row];
+		mergeRow_	(	nodeA[row].mVector,
+						nodeB[row].mVector,
+						1,
+						nodeRet[row].mVector
+					);
 	}
 
+	return		NULL;
+}
+
+/**
+ * 지정한 범위의 행에 대한 행렬 뺄셈
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadSub			(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	size_t			start		=	info->startRow;
+	size_t			end			=	info->endRow;
+	size_t			range		=	end - start;
+
+	const BasicSparseMatrix&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix&	operandB	=	*info->opInfo.operandB;
+	BasicSparseMatrix&		result		=	*info->opInfo.result;
+
+	vector_node_t*		nodeA		=	&operandA.mData[start];
+	vector_node_t*		nodeB		=	&operandB.mData[start];
+	vector_node_t*		nodeRet	=	&result.mData[start];
+
 	for(size_t row=0;row<=range;++row)
 	{
-		std::vector<node_t>&	vec		=	nodeB[row].mVector;
-		for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-		{
-			bool	found	=	false;
+		mergeRow_	(	nodeA[row].mVector,
+						nodeB[row].mVector,
+						-1,
+						nodeRet[row].mVector
+					);
+	}
 
-			std::vector<node_t>&	vec2	=	nodeRet[row].mVector;
-			for(elem_vector_itor itor2=vec2.begin();itor2!=vec2.end();++itor2)
-			{
-				if( itor2->mCol == itor->mCol )
-				{
-					elem_t		val		=	itor2->mElem + itor->mElem;
-
-					if( val != 0 )
-					{
-						itor2->mElem	=	val;
-					}
-					else
-					{
-						// 설정 값이 0이라면 vector에서 삭제
-						// 삭제 후에 itor 값을 vector의 다음 값으로 변경하지 않는 것은
-						// 직후 break로 반복문으로 빠져나가므로 불필요한 동작이다.
-						vec2.erase(itor2);
-					}
-
-					found			=	true;
-					break;
-				}
-			}
+	return		NULL;
+}
 
-			if( found == false )
-			{
-				vec2.push_back(node_t(itor->mCol, itor->mElem));
-			}
-		}
+/**
+ * 지정한 범위의 행에 대한 행렬 곱셈
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadMultiply	(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	size_t			start		=	info->startRow;
+	size_t			end			=	info->endRow;
+	size_t			range		=	end - start;
+
+	const BasicSparseMatrix&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix&	operandB	=	*info->opInfo.operandB;
+	BasicSparseMatrix&			result		=	*info->opInfo.result;
+
+	vector_node_t*		nodeA		=	&operandA.mData[start];
+	vector_node_t*		nodeB		=	operandB.mData;
+	vector_node_t*		nodeRet	=	&result.mData[start];
+
+	row_t	vec;
+	row_t	buffer;
+
+	for(size_t row=0;row<=range;++row)
+	{
+		multiplyRow_	(	nodeA[row].mVector,
+							nodeB,
+							vec,
+							buffer
+						);
+		storeRow_(nodeRet[row].mVector, vec);
 	}
 
-	return		NULL;
+	return	NULL;
 }
 
 /**
- * 지정한 범위의 행에 대한 행렬 뺄셈
+ * 지정한 범위의 행에 대한 행렬 곱셈
  * return 항상 NULL을 리턴
  */
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadSub			(	void*	pData	)
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadElemMul		(	void*	pData	)
 {
 	FuncInfo*		info		=	(FuncInfo*)pData;
 	size_t			start		=	info->startRow;
 	size_t			end			=	info->endRow;
 	size_t			range		=	end - start;
 
-	const SparseMatrix&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix&		result		=	*info->opInfo.result;
+	const BasicSparseMatrix&	operandA	=	*info->opInfo.operandA;
+	elem_t				operandB	=	info->opInfo.elemOperandB;
+	BasicSparseMatrix&		result		=	*info->opInfo.result;
 
 	vector_node_t*		nodeA		=	&operandA.mData[start];
-	vector_node_t*		nodeB		=	&operandB.mData[start];
 	vector_node_t*		nodeRet	=	&result.mData[start];
 
 	for(size_t row=0;row<=range;++row)
 	{
-		nodeRet[row]	=	nodeA[row];
-	}
+		row_t&	vec		=	nodeA[row].mVector;
+		row_t&	vecRet	=	nodeRet[row].mVector;
+
+		vecRet.clear();
+		vecRet.reserve(vec.size());
 
-	for(size_t row=0;row<=range;++row)
-	{
-		std::vector<node_t>&	vec		=	nodeB[row].mVector;
 		for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
 		{
-			bool	found	=	false;
-
-			std::vector<node_t>&	vec2	=	nodeRet[row].mVector;
-			for(elem_vector_itor itor2=vec2.begin();itor2!=vec2.end();++itor2)
-			{
-				if( itor2->mCol == itor->mCol )
-				{
-					elem_t		val		=	itor2->mElem - itor->mElem;
-
-					if( val != 0 )
-					{
-						itor2->mElem	=	val;
-					}
-					else
-					{
-						// 설정 값이 0이라면 vector에서 삭제
-						// 삭제 후에 itor 값을 vector의 다음 값으로 변경하지 않는 것은
-						// 직후 break로 반복문으로 빠져나가므로 불필요한 동작이다.
-						vec2.erase(itor2);
-					}
-
-					found			=	true;
-					break;
-				}
-			}
+			elem_t		val			=	itor->mElem * operandB;
 
-			if( found == false )
+			if( val != elem_t(0) )
 			{
-				vec2.push_back(node_t(itor->mCol, -itor->mElem));
+				vecRet.push_back(node_t(itor->mCol, val));
 			}
 		}
 	}
 
-	return		NULL;
+	return	NULL;
 }
 
 /**
- * 지정한 범위의 행에 대한 행렬 곱셈
+ * 지정한 범위의 행을 복사
  * return 항상 NULL을 리턴
  */
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadMultiply	(	void*	pData	)
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadCopy			(	void*	pData	)
 {
 	FuncInfo*		info		=	(FuncInfo*)pData;
 	size_t			start		=	info->startRow;
 	size_t			end			=	info->endRow;
 	size_t			range		=	end - start;
 
-	const SparseMatrix&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix&			result		=	*info->opInfo.result;
+	const BasicSparseMatrix&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix&	operandB	=	*info->opInfo.operandB;
 
 	vector_node_t*		nodeA		=	&operandA.mData[start];
-	vector_node_t*		nodeB		=	operandB.mData;
-	vector_node_t*		nodeRet	=	&result.mData[start];
+	vector_node_t*		nodeB		=	&operandB.mData[start];
 
 	for(size_t row=0;row<=range;++row)
 	{
-		std::vector<node_t>&	vec		=	nodeA[row].mVector;
-		for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-		{
-			std::vector<node_t>&	vec2	=	nodeB[itor->mCol].mVector;
-			for(elem_vector_itor itor2=vec2.begin();itor2!=vec2.end();++itor2)
-			{
-				elem_t		val		=	SparseMatrix::getElem_(nodeRet, row, itor2->mCol) + (itor->mElem * itor2->mElem);
-
-				if( val != 0 )
-				{
-					SparseMatrix::setElem_(nodeRet, row, itor2->mCol, val);
-				}
-				else
-				{
-					//printf("데이터가 0\n");
-					SparseMatrix::delElem_(nodeRet, row, itor2->mCol);
-				}
-			}
-		}
+		nodeA[row].mVector	=	nodeB[row].mVector;
 	}
 
 	return	NULL;
 }
 
 /**
- * 지정한 범위의 행에 대한 행렬 곱셈
- * return 항상 NULL을 리턴
+ * 지정한 범위 내 행에 대해서 비교 연산
+ * return 비교 결과를 void* 형으로 변환하여 리턴
  */
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadElemMul		(	void*	pData	)
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadCompare		(	void*	pData	)
 {
+	bool			flag		=	true;
 	FuncInfo*		info		=	(FuncInfo*)pData;
 	size_t			start		=	info->startRow;
 	size_t			end			=	info->endRow;
 	size_t			range		=	end - start;
 
-	const SparseMatrix&	operandA	=	*info->opInfo.operandA;
-	elem_t				operandB	=	info->opInfo.elemOperandB;
-	SparseMatrix&		result		=	*info->opInfo.result;
+	const BasicSparseMatrix&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix&	operandB	=	*info->opInfo.operandB;
 
 	vector_node_t*		nodeA		=	&operandA.mData[start];
-	vector_node_t*		nodeRet	=	&result.mData[start];
+	vector_node_t*		nodeB		=	&operandB.mData[start];
 
 	for(size_t row=0;row<=range;++row)
 	{
-		std::vector<node_t>&	vec		=	nodeA[row].mVector;
-		for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-		{
-			elem_t		val			=	itor->mElem * operandB;
+		row_t&	vec		=	nodeA[row].mVector;
+		row_t&	vec2	=	nodeB[row].mVector;
 
-			if( val != 0 )
-			{
-				SparseMatrix::setElem_(nodeRet, row, itor->mCol, val);
-			}
-			else
+		if( vec.size() != vec2.size() )
+		{
+			flag	=	false;
+		}
+		else
+		{
+			// 정렬 된 행이므로 같은 위치의 요소끼리 비교
+			for(size_t cnt=0;cnt<vec.size();++cnt)
 			{
-				//printf("데이터가 0\n");
-				SparseMatrix::delElem_(nodeRet, row, itor->mCol);
+				if( ( vec[cnt].mCol != vec2[cnt].mCol ) ||
+					( vec[cnt].mElem != vec2[cnt].mElem ) )
+				{
+					flag		=	false;
+					break;
+				}
 			}
 		}
+
+		if( flag == false )
+		{
+			break;
+		}
 	}
 
-	return	NULL;
+	return	(THREAD_RETURN_TYPE)flag;
 }
 
 /**
- * 지정한 범위의 행에 대한 전치행렬 변환 후 곱셈
+ * 지정한 범위의 행을 열 순서로 정렬
  * return 항상 NULL을 리턴
  */
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadTmultiply	(	void*	pData	)
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadSort			(	void*	pData	)
 {
 	FuncInfo*		info		=	(FuncInfo*)pData;
 	size_t			start		=	info->startRow;
 	size_t			end			=	info->endRow;
 	size_t			range		=	end - start;
 
-	const SparseMatrix&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix&		result		=	*info->opInfo.result;
+	const BasicSparseMatrix&	operandA	=	*info->opInfo.operandA;
 
 	vector_node_t*		nodeA		=	&operandA.mData[start];
-	vector_node_t*		nodeB		=	operandB.mData;
-	vector_node_t*		nodeRet		=	&result.mData[start];
 
 	for(size_t row=0;row<=range;++row)
 	{
-		std::vector<node_t>&	vec		=	nodeA[row].mVector;
-
-		for(size_t col=0;col<result.getCol();++col)
-		{
-			elem_t	sum		=	0;
+		sortRow_(nodeA[row].mVector);
+	}
 
-			for(elem_vector_itor itor=vec.begin();itor!=vec.end();itor++)
-			{
-				sum	+=	itor->mElem * getElem_(nodeB, col, itor->mCol);
-			}
+	return	NULL;
+}
 
-			setElem_(nodeRet, row, col, sum);
-		}
-	}
+/**
+ * 지정한 범위의 행에 대한 행렬 x 벡터
+ * return 항상 NULL을 리턴
+ */
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadSpmv		(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	const BasicSparseMatrix::OpInfo&	opInfo	=	info->opInfo;
+
+	opInfo.operandA->spmvRows	(	opInfo.elemOperandB,
+									opInfo.vecX,
+									opInfo.beta,
+									opInfo.vecY,
+									info->startRow,
+									info->endRow + 1
+								);
 
 	return	NULL;
 }
 
 /**
- * 지정한 범위의 행에 대한 전치행렬 변환 후 곱셈
+ * 지정한 범위의 행에 대한 자신의 갱신 (this = beta * this + alpha * operand)
  * return 항상 NULL을 리턴
  */
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadStmultiply	(	void*	pData	)
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadAxpby		(	void*	pData	)
 {
 	FuncInfo*		info		=	(FuncInfo*)pData;
 	size_t			start		=	info->startRow;
 	size_t			end			=	info->endRow;
-	size_t			range		=	end - start;
 
-	const SparseMatrix&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix&		result		=	*info->opInfo.result;
+	const BasicSparseMatrix*	operand		=	info->opInfo.operandB;
+	BasicSparseMatrix&		result		=	*info->opInfo.result;
 
-	vector_node_t*		nodeA		=	&operandA.mData[start];
-	vector_node_t*		nodeB		=	&operandB.mData[start];
-	vector_node_t*		nodeRet		=	result.mData;
+	row_t	buffer;
 
-	for(size_t row=0;row<=range;++row)
+	for(size_t row=start;row<=end;++row)
 	{
-		std::vector<node_t>&	vec		=	nodeA[row].mVector;
-
-		for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-		{
-			std::vector<node_t>&	vec2	=	nodeB[row].mVector;
-
-			for(elem_vector_itor itor2=vec2.begin();itor2!=vec2.end();itor2++)
-			{
-				// 전치 행렬 곱셈은 분리 된 각 스레드마다
-				// nodeRet의 같은 행을 참조 할 수 있어 lock을 사용하여 접근 제어
-				LOCK(&nodeRet[itor->mCol].mLock);
-				elem_t		val		=	getElem_(nodeRet, itor->mCol, itor2->mCol);
-
-				setElem_	(	nodeRet,
-								itor->mCol,
-								itor2->mCol,
-								val + (itor->mElem * itor2->mElem)
-							);
-				UNLOCK(&nodeRet[itor->mCol].mLock);
-			}
-		}
+		updateRow_	(	result.mData[row].mVector,
+						( operand != NULL ) ? &operand->mData[row].mVector : NULL,
+						info->opInfo.elemOperandB,
+						info->opInfo.beta,
+						buffer
+					);
 	}
 
 	return	NULL;
 }
 
 /**
- * 지정한 범위의 행을 복사
+ * 지정한 범위의 행에 대한 선형 결합
  * return 항상 NULL을 리턴
  */
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadCopy			(	void*	pData	)
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadCombine		(	void*	pData	)
 {
 	FuncInfo*		info		=	(FuncInfo*)pData;
 	size_t			start		=	info->startRow;
 	size_t			end			=	info->endRow;
-	size_t			range		=	end - start;
 
-	const SparseMatrix&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix&	operandB	=	*info->opInfo.operandB;
+	const BasicSparseMatrix::OpInfo&	opInfo	=	info->opInfo;
+	BasicSparseMatrix&		result		=	*opInfo.result;
 
-	vector_node_t*		nodeA		=	&operandA.mData[start];
-	vector_node_t*		nodeB		=	&operandB.mData[start];
+	row_t	vec;
+	row_t	buffer;
 
-	for(size_t row=0;row<=range;++row)
+	for(size_t row=start;row<=end;++row)
 	{
-		nodeA[row].mVector	=	nodeB[row].mVector;
+		combineRow_(opInfo.termNum, opInfo.coef, opInfo.terms, row, vec, buffer);
+		storeRow_(result.mData[row].mVector, vec);
 	}
 
 	return	NULL;
 }
 
 /**
- * 지정한 범위 내 행에 대해서 비교 연산
- * return 비교 결과를 void* 형으로 변환하여 리턴
+ * 지정한 범위의 행 공간을 다시 할당
+ * return 항상 NULL을 리턴
  */
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix::threadCompare		(	void*	pData	)
+template<class T, class I>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix<T, I>::threadReserve		(	void*	pData	)
 {
-	bool			flag		=	true;
 	FuncInfo*		info		=	(FuncInfo*)pData;
 	size_t			start		=	info->startRow;
 	size_t			end			=	info->endRow;
-	size_t			range		=	end - start;
 
-	const SparseMatrix&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix&	operandB	=	*info->opInfo.operandB;
+	BasicSparseMatrix&		result		=	*info->opInfo.result;
+	const size_t*			size		=	info->opInfo.rowSize;
 
-	vector_node_t*		nodeA		=	&operandA.mData[start];
-	vector_node_t*		nodeB		=	&operandB.mData[start];
-
-	for(size_t row=0;row<=range;++row)
+	for(size_t row=start;row<=end;++row)
 	{
-		std::vector<node_t>&	vec		=	nodeA[row].mVector;
+		row_t&		vec			=	result.mData[row].mVector;
+		size_t		capacity	=	vec.size();
 
-		if( vec.size() != nodeB[row].mVector.size() )
-		{
-			flag	=	false;
-		}
-		else
+		if( size != NULL )
 		{
-			for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-			{
-				if( itor->mElem != SparseMatrix::getElem_(nodeB, row, itor->mCol) )
-				{
-					flag		=	false;
-					break;
-				}
-			}
+			capacity	=	std::max(capacity, size[row]);
 		}
 
-		if( flag == false )
+		if( capacity == 0 )
 		{
-			break;
+			continue;
 		}
+
+		row_t		dest		=	row_t(vec.get_allocator());
+
+		dest.reserve(capacity);
+		dest.assign(vec.begin(), vec.end());
+		vec.swap(dest);
 	}
 
-	return	(THREAD_RETURN_TYPE)flag;
+	return	NULL;
 }
 
 /**
  * 행렬 데이터 제거
  */
-void		SparseMatrix::delElem_		(	vector_node_t*	data,	///< vector 객체 배열
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::delElem_		(	vector_node_t*	data,	///< vector 객체 배열
 												size_t				row,	///< 삭제 할 데이터 행
 												size_t				col		///< 삭제 할 데이터 열
 											)
 {
-	std::vector<node_t>&	vec		=	data[row].mVector;
+	row_t&	vec		=	data[row].mVector;
 
-	elem_vector_itor itor	=	find(vec.begin(), vec.end(), col);
-	if( itor != vec.end() )
+	elem_vector_itor itor	=	std::lower_bound(vec.begin(), vec.end(), col);
+	if( ( itor != vec.end() ) &&
+		( itor->mCol == col ) )
 	{
 		vec.erase(itor);
 	}
-
-	//for(elem_vector_itor itor=vec.begin();itor!=vec.end();++itor)
-	//{
-	//	if( itor->mCol == row )
-	//	{
-	//		vec.erase(itor);
-	//		break;
-	//	}
-	//}
 }
 
 /**
  * 행렬 데이터 참조
  */
-elem_t		SparseMatrix::getElem_		(	vector_node_t*	data,	///< vector 객체 배열
+template<class T, class I>
+T		BasicSparseMatrix<T, I>::getElem_		(	vector_node_t*	data,	///< vector 객체 배열
 												size_t				row,	///< 참조 할 데이터 행
 												size_t				col		///< 참조 할 데이터 열
 											)
 {
 	elem_t				value	=	0;
-	std::vector<node_t>&	vec		=	data[row].mVector;
+	row_t&	vec		=	data[row].mVector;
 
 	if( vec.size() != 0 )
 	{
-		elem_vector_itor itor	=	find(vec.begin(), vec.end(), col);
-		if( itor != vec.end() )
+		elem_vector_itor itor	=	std::lower_bound(vec.begin(), vec.end(), col);
+		if( ( itor != vec.end() ) &&
+			( itor->mCol == col ) )
 		{
 			value	=	itor->mElem;
 		}
@@ -1534,34 +2030,305 @@ elem_t		SparseMatrix::getElem_		(	vector_node_t*	data,	///< vector 객체 배열
 /**
  * 행렬 데이터 설정
  */
-void		SparseMatrix::setElem_		(	vector_node_t*	data,	///< vector 객체 배열
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::setElem_		(	vector_node_t*	data,	///< vector 객체 배열
 												size_t				row,	///< 설정 할 데이터 행
 												size_t				col,	///< 설정 할 데이터 열
 												elem_t				elem	///< 설정 할 요소 값
 											)
 {
-	std::vector<node_t>&	vec		=	data[row].mVector;
+	row_t&	vec		=	data[row].mVector;
 
-	elem_vector_itor itor	=	find(vec.begin(), vec.end(), col);
+	elem_vector_itor itor	=	std::lower_bound(vec.begin(), vec.end(), col);
 
-	if( itor != vec.end() )
+	if( ( itor != vec.end() ) &&
+		( itor->mCol == col ) )
 	{
-		if( elem != 0 )
+		if( elem != elem_t(0) )
 		{
 			itor->mElem	=	elem;
 		}
 		else
 		{
 			// 설정 값이 0이라면 vector에서 삭제
-			// 삭제 후에 itor 값을 vector의 다음 값으로 변경하지 않는 것은
-			// 직후 break로 반복문으로 빠져나가므로 불필요한 동작이다.
 			vec.erase(itor);
 		}
 	}
-	else if( elem != 0 )
+	else if( elem != elem_t(0) )
+	{
+		// 열 순서를 유지하도록 삽입
+		vec.insert(itor, node_t(col, elem));
+	}
+}
+
+/**
+ * 한 행을 열 순서로 정렬
+ * 같은 열이 여러 번 나오면 마지막 값만 남기고, 0 값 요소는 제거한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::sortRow_		(	row_t&	vec		///< 정렬 할 행
+											)
+{
+	std::stable_sort(vec.begin(), vec.end());
+
+	size_t		count	=	0;
+
+	for(size_t cnt=0;cnt<vec.size();++cnt)
+	{
+		// 같은 열의 마지막 요소만 사용
+		if( ( cnt + 1 < vec.size() ) &&
+			( vec[cnt+1].mCol == vec[cnt].mCol ) )
+		{
+			continue;
+		}
+
+		if( vec[cnt].mElem != elem_t(0) )
+		{
+			vec[count++]	=	vec[cnt];
+		}
+	}
+
+	vec.erase(vec.begin() + count, vec.end());
+}
+
+/**
+ * 정렬 된 두 행의 병합
+ * result = vecA + coefB * vecB 를 계산하며, 결과가 0인 요소는 제외한다.
+ * result는 vecA, vecB와 다른 객체이어야 한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::mergeRow_		(	const row_t&	vecA,	///< 앞 행
+												const row_t&	vecB,	///< 뒤 행
+												elem_t						coefB,	///< 뒤 행에 곱할 값
+												row_t&		result	///< 병합 결과
+											)
+{
+	elem_vector_citor	itorA	=	vecA.begin();
+	elem_vector_citor	itorB	=	vecB.begin();
+
+	result.clear();
+	result.reserve(vecA.size() + vecB.size());
+
+	while( ( itorA != vecA.end() ) &&
+		   ( itorB != vecB.end() ) )
+	{
+		if( itorA->mCol < itorB->mCol )
+		{
+			result.push_back(*itorA);
+			++itorA;
+		}
+		else if( itorB->mCol < itorA->mCol )
+		{
+			elem_t		val		=	coefB * itorB->mElem;
+
+			if( val != elem_t(0) )
+			{
+				result.push_back(node_t(itorB->mCol, val));
+			}
+			++itorB;
+		}
+		else
+		{
+			elem_t		val		=	itorA->mElem + coefB * itorB->mElem;
+
+			if( val != elem_t(0) )
+			{
+				result.push_back(node_t(itorA->mCol, val));
+			}
+			++itorA;
+			++itorB;
+		}
+	}
+
+	for(;itorA!=vecA.end();++itorA)
+	{
+		result.push_back(*itorA);
+	}
+
+	for(;itorB!=vecB.end();++itorB)
+	{
+		elem_t		val		=	coefB * itorB->mElem;
+
+		if( val != elem_t(0) )
+		{
+			result.push_back(node_t(itorB->mCol, val));
+		}
+	}
+}
+
+/**
+ * 정렬 된 행의 갱신 (vecA = beta * vecA + alpha * vecB)
+ * vecB의 열이 모두 vecA에 있으면 그 자리에서 값을 바꾸고,
+ * 새 열이 생기면 buffer에 병합한 후 맞바꾼다. 결과가 0인 요소는 제외한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::updateRow_		(	row_t&		vecA,	///< 갱신 할 행
+												const row_t*	vecB,	///< 더할 행 (NULL이면 없음)
+												elem_t						alpha,	///< 더할 행에 곱할 값
+												elem_t						beta,	///< 갱신 할 행에 곱할 값
+												row_t&		buffer	///< 병합에 사용할 임시 행
+											)
+{
+	bool		zeroFlag	=	false;
+
+	if( beta == elem_t(0) )
+	{
+		vecA.clear();
+	}
+	else if( beta != elem_t(1) )
+	{
+		for(elem_vector_itor itor=vecA.begin();itor!=vecA.end();++itor)
+		{
+			itor->mElem		*=	beta;
+			zeroFlag		|=	( itor->mElem == elem_t(0) );
+		}
+	}
+
+	if( ( vecB != NULL ) &&
+		( vecB->empty() == false ) &&
+		( alpha != elem_t(0) ) )
+	{
+		elem_vector_itor	itorA	=	vecA.begin();
+		elem_vector_citor	itorB	=	vecB->begin();
+
+		// vecB의 열이 모두 vecA에 있는지 확인
+		for(;itorB!=vecB->end();++itorB)
+		{
+			itorA	=	std::lower_bound(itorA, vecA.end(), itorB->mCol);
+
+			if( ( itorA == vecA.end() ) ||
+				( itorA->mCol != itorB->mCol ) )
+			{
+				break;
+			}
+		}
+
+		if( itorB == vecB->end() )
+		{
+			itorA	=	vecA.begin();
+
+			for(itorB=vecB->begin();itorB!=vecB->end();++itorB)
+			{
+				itorA	=	std::lower_bound(itorA, vecA.end(), itorB->mCol);
+
+				itorA->mElem	+=	alpha * itorB->mElem;
+				zeroFlag		|=	( itorA->mElem == elem_t(0) );
+			}
+		}
+		else
+		{
+			mergeRow_(vecA, *vecB, alpha, buffer);
+			storeRow_(vecA, buffer);
+		}
+	}
+
+	// 0이 된 요소 제거
+	if( zeroFlag == true )
+	{
+		size_t		count	=	0;
+
+		for(size_t cnt=0;cnt<vecA.size();++cnt)
+		{
+			if( vecA[cnt].mElem != elem_t(0) )
+			{
+				vecA[count++]	=	vecA[cnt];
+			}
+		}
+
+		vecA.erase(vecA.begin() + count, vecA.end());
+	}
+}
+
+/**
+ * 계산한 행을 행렬의 행에 저장
+ * 같은 공간을 쓰면 맞바꾸고, 다르면 행렬의 행 공간에 복사하여 임시 행이 행 저장 공간을 가져가지 않도록 한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::storeRow_		(	row_t&		dest,	///< 저장 할 행렬의 행
+												row_t&		src		///< 계산 된 임시 행
+											)
+{
+	if( dest.get_allocator() == src.get_allocator() )
+	{
+		dest.swap(src);
+	}
+	else
+	{
+		dest.assign(src.begin(), src.end());
+	}
+}
+
+/**
+ * 한 행의 선형 결합 (result = coef[0] * operand[0]의 행 + ...)
+ * 첫 항을 복사한 후 나머지 항을 차례로 병합하며, 결과가 0인 요소는 제외한다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::combineRow_		(	size_t						num,		///< 항 수
+												const elem_t				coef[],		///< 항 별 계수
+												const BasicSparseMatrix* const	operand[],	///< 항 별 피연산자
+												size_t						row,		///< 계산 할 행
+												row_t&		result,		///< 결과 행
+												row_t&		buffer		///< 병합에 사용할 임시 행
+											)
+{
+	const row_t&	vec		=	operand[0]->mData[row].mVector;
+
+	result.clear();
+	result.reserve(vec.size());
+
+	for(elem_vector_citor itor=vec.begin();itor!=vec.end();++itor)
+	{
+		elem_t		val		=	coef[0] * itor->mElem;
+
+		if( val != elem_t(0) )
+		{
+			result.push_back(node_t(itor->mCol, val));
+		}
+	}
+
+	for(size_t cnt=1;cnt<num;++cnt)
+	{
+		mergeRow_(result, operand[cnt]->mData[row].mVector, coef[cnt], buffer);
+		result.swap(buffer);
+	}
+}
+
+/**
+ * 한 행과 행렬의 곱셈
+ * vecA의 각 요소에 해당하는 nodeB의 행을 차례로 병합하여 결과 행을 만든다.
+ */
+template<class T, class I>
+void		BasicSparseMatrix<T, I>::multiplyRow_	(	const row_t&	vecA,	///< 앞 행렬의 행
+												const vector_node_t*		nodeB,	///< 뒤 행렬
+												row_t&		result,	///< 곱셈 결과 행
+												row_t&		buffer	///< 병합용 임시 행
+											)
+{
+	result.clear();
+
+	for(elem_vector_citor itor=vecA.begin();itor!=vecA.end();++itor)
 	{
-		vec.push_back(node_t(col, elem));
+		mergeRow_(result, nodeB[itor->mCol].mVector, itor->mElem, buffer);
+		result.swap(buffer);
 	}
 }
 
+template<class T, class I>
+bool	BasicSparseMatrix<T, I>::sDefaultArena	=	false;
+
+template<class T, class I>
+std::mutex	BasicSparseMatrix<T, I>::sSortLock;
+
+/////////////////////////////
+// 요소 / 위치 형식 별 명시적 인스턴스
+
+template class	BasicSparseMatrix< float, uint32_t >;
+template class	BasicSparseMatrix< float, uint64_t >;
+template class	BasicSparseMatrix< double, uint32_t >;
+template class	BasicSparseMatrix< double, uint64_t >;
+template class	BasicSparseMatrix< std::complex<float>, uint32_t >;
+template class	BasicSparseMatrix< std::complex<float>, uint64_t >;
+template class	BasicSparseMatrix< std::complex<double>, uint32_t >;
+template class	BasicSparseMatrix< std::complex<double>, uint64_t >;
+
 };
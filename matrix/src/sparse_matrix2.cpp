@@ -7,43 +7,37 @@
 
 #include "sparse_matrix2.h"
 #include "matrix_error.h"
+#include "thread_pool.h"
 #include <math.h>
+#include <stdexcept>
 
-#define	THREAD_NUM					(8)
-#define	THREAD_FUNC_THRESHOLD	(THREAD_NUM)
 
 namespace matrix
 {
 
-typedef	THREAD_RETURN_TYPE(THREAD_FUNC_TYPE *Operation)(void*);
-
-struct		FuncInfo
-{
-	SparseMatrix2::OpInfo	opInfo;
-	Operation				func;
-	size_t					startCol;
-	size_t					endCol;
-};
-
 /**
  * 생성자
  */
-SparseMatrix2::SparseMatrix2			(	void	)
+template<class T, class R>
+BasicSparseMatrix2<T, R>::BasicSparseMatrix2			(	void	)
 :mRowSize(0),
  mColSize(0),
- mData(NULL)
+ mData(NULL),
+ mPool(NULL)
 {
 }
 
 /**
  * 생성자
  */
-SparseMatrix2::SparseMatrix2			(	size_t		row,	///< 행 크기
+template<class T, class R>
+BasicSparseMatrix2<T, R>::BasicSparseMatrix2			(	size_t		row,	///< 행 크기
 											size_t		col		///< 열 크기
 										)
 :mRowSize(0),
  mColSize(0),
- mData(NULL)
+ mData(NULL),
+ mPool(NULL)
 {
 	allocElems(row, col);
 }
@@ -51,29 +45,50 @@ SparseMatrix2::SparseMatrix2			(	size_t		row,	///< 행 크기
 /**
  * 복사 생성자
  */
-SparseMatrix2::SparseMatrix2			(	const SparseMatrix2&		matrix		///< 복사 될 객체
+template<class T, class R>
+BasicSparseMatrix2<T, R>::BasicSparseMatrix2			(	const BasicSparseMatrix2&		matrix		///< 복사 될 객체
 										)
 :mRowSize(0),
  mColSize(0),
- mData(NULL)
+ mData(NULL),
+ mPool(NULL)
 {
 	allocElems(matrix.getRow(), matrix.getCol());
 	copyElems(matrix);
 }
 
+/**
+ * 이동 생성자
+ * 데이터를 복사하지 않고 가져오며, 원본은 빈 행렬이 된다.
+ */
+template<class T, class R>
+BasicSparseMatrix2<T, R>::BasicSparseMatrix2			(	BasicSparseMatrix2&&				matrix		///< 이동 할 객체
+										)
+:mRowSize(0),
+ mColSize(0),
+ mData(NULL),
+ mPool(NULL)
+{
+	swap(matrix);
+}
+
 /**
  * 소멸자
  */
-SparseMatrix2::~SparseMatrix2			(	void	)
+template<class T, class R>
+BasicSparseMatrix2<T, R>::~BasicSparseMatrix2			(	void	)
 {
 	freeElems();
+
+	delete	mPool;
 }
 
 /**
  * 행렬 요소 값 참조
  * @return 참조한 행렬 요소 값
  */
-elem_t		SparseMatrix2::getElem		(	size_t		row,	///< 참조 할 행 위치
+template<class T, class R>
+T		BasicSparseMatrix2<T, R>::getElem		(	size_t		row,	///< 참조 할 행 위치
 											size_t		col		///< 참조 할 열 위치
 										) const
 {
@@ -96,14 +111,15 @@ elem_t		SparseMatrix2::getElem		(	size_t		row,	///< 참조 할 행 위치
 /**
  * 행렬 요소 값 설정
  */
-void		SparseMatrix2::setElem			(	size_t		row,	///< 설정 할 행 위치
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::setElem			(	size_t		row,	///< 설정 할 행 위치
 												size_t		col,	///< 설정 할 열 위치
 												elem_t		elem	///< 설정 할 요소 값
 											)
 {
 	//chkBound(row, col);
 
-	if( elem != 0 )
+	if( elem != elem_t(0) )
 	{
 		mData[row].mMap[col]	=	elem;
 	}
@@ -117,12 +133,13 @@ void		SparseMatrix2::setElem			(	size_t		row,	///< 설정 할 행 위치
  * 행렬 덧셈
  * @return 행렬 덧셈 결과
  */
-SparseMatrix2	SparseMatrix2::add		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::add		(	const BasicSparseMatrix2&	operand	///< 피연산자
 										) const
 {
 	chkSameSize(operand);
 
-	SparseMatrix2	result		=	SparseMatrix2(getRow(), getCol());
+	BasicSparseMatrix2	result		=	BasicSparseMatrix2(getRow(), getCol());
 
 	result		=	*this;
 
@@ -144,14 +161,15 @@ SparseMatrix2	SparseMatrix2::add		(	const SparseMatrix2&	operand	///< 피연산
  * 쓰레드 행렬 덧셈
  * @return 행렬 덧셈 결과
  */
-SparseMatrix2	SparseMatrix2::padd		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::padd		(	const BasicSparseMatrix2&	operand	///< 피연산자
 										) const
 {
 	chkSameSize(operand);
 
-	SparseMatrix2	result		=	SparseMatrix2(getRow(), getCol());
+	BasicSparseMatrix2	result		=	BasicSparseMatrix2(getRow(), getCol());
 
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	if( ThreadPool::getInstance().isSerial(getSize() + operand.getSize()) == true )
 	{
 		result		=	*this;
 
@@ -184,12 +202,13 @@ SparseMatrix2	SparseMatrix2::padd		(	const SparseMatrix2&	operand	///< 피연산
  * 행렬 뺄셈
  * @return 행렬 뺄셈 결과
  */
-SparseMatrix2	SparseMatrix2::sub		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::sub		(	const BasicSparseMatrix2&	operand	///< 피연산자
 										) const
 {
 	chkSameSize(operand);
 
-	SparseMatrix2	result		=	SparseMatrix2(getRow(), getCol());
+	BasicSparseMatrix2	result		=	BasicSparseMatrix2(getRow(), getCol());
 
 	result		=	*this;
 
@@ -211,14 +230,15 @@ SparseMatrix2	SparseMatrix2::sub		(	const SparseMatrix2&	operand	///< 피연산
  * 쓰레드 행렬 뺄셈
  * @return 행렬 뺄셈 결과
  */
-SparseMatrix2	SparseMatrix2::psub		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::psub		(	const BasicSparseMatrix2&	operand	///< 피연산자
 										) const
 {
 	chkSameSize(operand);
 
-	SparseMatrix2	result		=	SparseMatrix2(getRow(), getCol());
+	BasicSparseMatrix2	result		=	BasicSparseMatrix2(getRow(), getCol());
 
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	if( ThreadPool::getInstance().isSerial(getSize() + operand.getSize()) == true )
 	{
 		result		=	*this;
 
@@ -251,16 +271,16 @@ SparseMatrix2	SparseMatrix2::psub		(	const SparseMatrix2&	operand	///< 피연산
  * 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-SparseMatrix2	SparseMatrix2::multiply		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::multiply		(	const BasicSparseMatrix2&	operand	///< 피연산자
 											) const
 {
-	if( ( getRow() != operand.getCol() ) &&
-		( getCol() != operand.getRow() ) )
+	if( getCol() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix2	result	=	SparseMatrix2(getRow(), operand.getCol());
+	BasicSparseMatrix2	result	=	BasicSparseMatrix2(getRow(), operand.getCol());
 
 	for(size_t row=0;row<getRow();++row)
 	{
@@ -283,18 +303,18 @@ SparseMatrix2	SparseMatrix2::multiply		(	const SparseMatrix2&	operand	///< 피
  * 쓰레드 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-SparseMatrix2	SparseMatrix2::pmultiply	(	const SparseMatrix2&	operand
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::pmultiply	(	const BasicSparseMatrix2&	operand
 											) const
 {
-	if( ( getRow() != operand.getCol() ) &&
-		( getCol() != operand.getRow() ) )
+	if( getCol() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix2	result	=	SparseMatrix2(getRow(), operand.getCol());
+	BasicSparseMatrix2	result	=	BasicSparseMatrix2(getRow(), operand.getCol());
 
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	if( ThreadPool::getInstance().isSerial(getSize()) == true )
 	{
 		for(size_t row=0;row<getRow();++row)
 		{
@@ -328,10 +348,11 @@ SparseMatrix2	SparseMatrix2::pmultiply	(	const SparseMatrix2&	operand
  * 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-SparseMatrix2	SparseMatrix2::multiply		(	elem_t		operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::multiply		(	elem_t		operand	///< 피연산자
 											) const
 {
-	SparseMatrix2	result	=	SparseMatrix2(getRow(), getCol());
+	BasicSparseMatrix2	result	=	BasicSparseMatrix2(getRow(), getCol());
 
 	for(size_t row=0;row<getRow();++row)
 	{
@@ -351,12 +372,13 @@ SparseMatrix2	SparseMatrix2::multiply		(	elem_t		operand	///< 피연산자
  * 쓰레드 행렬 곱셈
  * @return 행렬 곱셈 결과
  */
-SparseMatrix2	SparseMatrix2::pmultiply	(	elem_t		operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::pmultiply	(	elem_t		operand	///< 피연산자
 											) const
 {
-	SparseMatrix2	result	=	SparseMatrix2(getRow(), getCol());
+	BasicSparseMatrix2	result	=	BasicSparseMatrix2(getRow(), getCol());
 
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	if( ThreadPool::getInstance().isSerial(getSize()) == true )
 	{
 		for(size_t row=0;row<getRow();++row)
 		{
@@ -384,31 +406,22 @@ SparseMatrix2	SparseMatrix2::pmultiply	(	elem_t		operand	///< 피연산자
 }
 
 /**
- * 전치 행렬 변환 후 곱셈
- * @return 행렬 곱셈 결과
+ * 전치 행렬
+ * 행 순서로 요소를 옮기므로 결과 행의 끝에 바로 추가한다. (O(요소 수))
+ * @return 전치 행렬
  */
-SparseMatrix2	SparseMatrix2::tmultiply	(	const SparseMatrix2&	operand	///< 피연산자
-											) const
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::transpose	(	void	) const
 {
-	if( ( getRow() != operand.getRow() ) &&
-		( getCol() != operand.getCol() ) )
-	{
-		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
-	}
-
-	SparseMatrix2	result	=	SparseMatrix2(getRow(), operand.getCol());
+	BasicSparseMatrix2	result	=	BasicSparseMatrix2(getCol(), getRow());
 
 	for(size_t row=0;row<getRow();++row)
 	{
 		for(elem_map_itor itor=mData[row].mMap.begin();itor!=mData[row].mMap.end();++itor)
 		{
-			for(elem_map_itor itor2=operand.mData[row].mMap.begin();itor2!=operand.mData[row].mMap.end();itor2++)
-			{
-				result.setElem	(	itor->first,
-										itor2->first,
-										result.getElem(itor->first, itor2->first) + (itor->second * itor2->second)
-									);
-			}
+			map_t&	map		=	result.mData[itor->first].mMap;
+
+			map.emplace_hint(map.end(), row, itor->second);
 		}
 	}
 
@@ -416,132 +429,79 @@ SparseMatrix2	SparseMatrix2::tmultiply	(	const SparseMatrix2&	operand	///< 피
 }
 
 /**
- * 쓰레드 전치 행렬 변환 후 곱셈
+ * 전치 행렬 변환 후 곱셈 (A^T * B)
+ * 앞 행렬의 열 접근 형식 (전치 행렬)을 만든 후 행렬 곱셈을 한다.
  * @return 행렬 곱셈 결과
  */
-SparseMatrix2	SparseMatrix2::ptmultiply	(	const SparseMatrix2&	operand	///< 피연산자
-												) const
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::tmultiply	(	const BasicSparseMatrix2&	operand	///< 피연산자
+											) const
 {
-	if( ( getRow() != operand.getRow() ) &&
-		( getCol() != operand.getCol() ) )
+	if( getRow() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix2	result	=	SparseMatrix2(getRow(), operand.getCol());
+	return	transpose().multiply(operand);
+}
 
-	if( getRow() < THREAD_FUNC_THRESHOLD )
-	{
-		for(size_t row=0;row<getRow();++row)
-		{
-			for(elem_map_itor itor=mData[row].mMap.begin();itor!=mData[row].mMap.end();++itor)
-			{
-				for(elem_map_itor itor2=operand.mData[row].mMap.begin();itor2!=operand.mData[row].mMap.end();itor2++)
-				{
-					result.setElem	(	itor->first,
-											itor2->first,
-											result.getElem(itor->first, itor2->first) + (itor->second * itor2->second)
-										);
-				}
-			}
-		}
-	}
-	else
+/**
+ * 쓰레드 전치 행렬 변환 후 곱셈 (A^T * B)
+ * 앞 행렬의 전치 행렬을 만든 후 쓰레드 행렬 곱셈을 하므로, 각 쓰레드는 자신이 맡은 결과 행만 쓴다.
+ * @return 행렬 곱셈 결과
+ */
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::ptmultiply	(	const BasicSparseMatrix2&	operand	///< 피연산자
+												) const
+{
+	if( getRow() != operand.getRow() )
 	{
-		OpInfo		info;
-
-		info.operandA		=	this;
-		info.operandB		=	&operand;
-		info.result		=	&result;
-
-		doThreadFunc(FUNC_TMULTIPLY, info);
+		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	return	result;
+	return	transpose().pmultiply(operand);
 }
 
 /**
- * 앞 전치 행렬 변환 후 곱셈
+ * 앞 전치 행렬 변환 후 곱셈 (A^T * B)
+ * 앞 행렬의 열 접근 형식 (전치 행렬)을 만든 후 행렬 곱셈을 한다.
  * @return 행렬 곱셈 결과
  */
-SparseMatrix2	SparseMatrix2::stmultiply	(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::stmultiply	(	const BasicSparseMatrix2&	operand	///< 피연산자
 											) const
 {
-	if( ( getRow() != operand.getRow() ) &&
-		( getCol() != operand.getCol() ) )
+	if( getRow() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix2	result	=	SparseMatrix2(getRow(), operand.getCol());
-
-	for(size_t row=0;row<getRow();++row)
-	{
-		for(elem_map_itor itor=mData[row].mMap.begin();itor!=mData[row].mMap.end();++itor)
-		{
-			for(elem_map_itor itor2=operand.mData[row].mMap.begin();itor2!=operand.mData[row].mMap.end();itor2++)
-			{
-				result.setElem	(	itor->first,
-										itor2->first,
-										result.getElem(itor->first, itor2->first) + (itor->second * itor2->second)
-									);
-			}
-		}
-	}
-
-	return	result;
+	return	transpose().multiply(operand);
 }
 
 /**
- * 쓰레드 앞 전치 행렬 변환 후 곱셈
+ * 쓰레드 앞 전치 행렬 변환 후 곱셈 (A^T * B)
+ * 앞 행렬의 전치 행렬을 만든 후 쓰레드 행렬 곱셈을 하므로, 각 쓰레드는 자신이 맡은 결과 행만 쓴다.
  * @return 행렬 곱셈 결과
  */
-SparseMatrix2	SparseMatrix2::pstmultiply	(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>	BasicSparseMatrix2<T, R>::pstmultiply	(	const BasicSparseMatrix2&	operand	///< 피연산자
 												) const
 {
-	if( ( getRow() != operand.getRow() ) &&
-		( getCol() != operand.getCol() ) )
+	if( getRow() != operand.getRow() )
 	{
 		throw	matrix::ErrMsg::createErrMsg("행렬 크기가 올바르지 않습니다.");
 	}
 
-	SparseMatrix2	result	=	SparseMatrix2(getRow(), operand.getCol());
-
-	if( getRow() < THREAD_FUNC_THRESHOLD )
-	{
-		for(size_t row=0;row<getRow();++row)
-		{
-			for(elem_map_itor itor=mData[row].mMap.begin();itor!=mData[row].mMap.end();++itor)
-			{
-				for(elem_map_itor itor2=operand.mData[row].mMap.begin();itor2!=operand.mData[row].mMap.end();itor2++)
-				{
-					result.setElem	(	itor->first,
-											itor2->first,
-											result.getElem(itor->first, itor2->first) + (itor->second * itor2->second)
-										);
-				}
-			}
-		}
-	}
-	else
-	{
-		OpInfo		info;
-
-		info.operandA		=	this;
-		info.operandB		=	&operand;
-		info.result		=	&result;
-
-		doThreadFunc(FUNC_STMULTIPLY, info);
-	}
-
-	return	result;
+	return	transpose().pmultiply(operand);
 }
 
 /**
  * 행렬 대입
  * @return 대입 할 행렬
  */
-const SparseMatrix2&		SparseMatrix2::equal			(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::equal			(	const BasicSparseMatrix2&	operand	///< 피연산자
 															)
 {
 	try
@@ -563,7 +523,8 @@ const SparseMatrix2&		SparseMatrix2::equal			(	const SparseMatrix2&	operand	///<
  * 쓰레드 행렬 대입
  * @return 대입 할 행렬
  */
-const SparseMatrix2&		SparseMatrix2::pequal		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::pequal		(	const BasicSparseMatrix2&	operand	///< 피연산자
 														)
 {
 	try
@@ -585,7 +546,8 @@ const SparseMatrix2&		SparseMatrix2::pequal		(	const SparseMatrix2&	operand	///<
  * 행렬 비교
  * @return 두 행렬이 같으면 true, 다르면 false 리턴
  */
-bool			SparseMatrix2::compare		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+bool			BasicSparseMatrix2<T, R>::compare		(	const BasicSparseMatrix2&	operand	///< 피연산자
 											) const
 {
 	bool	ret		=	true;
@@ -621,14 +583,15 @@ bool			SparseMatrix2::compare		(	const SparseMatrix2&	operand	///< 피연산자
  * 쓰레드 행렬 비교
  * @return 두 행렬이 같으면 true, 다르면 false 리턴
  */
-bool			SparseMatrix2::pcompare		(	const SparseMatrix2&	operand
+template<class T, class R>
+bool			BasicSparseMatrix2<T, R>::pcompare		(	const BasicSparseMatrix2&	operand
 												) const
 {
 	bool	ret		=	true;
 
 	if( getSize() == operand.getSize() )
 	{
-		if( getRow() < THREAD_FUNC_THRESHOLD )
+		if( ThreadPool::getInstance().isSerial(getSize()) == true )
 		{
 			for(size_t row=0;row<getRow();++row)
 			{
@@ -667,32 +630,210 @@ bool			SparseMatrix2::pcompare		(	const SparseMatrix2&	operand
 	return	ret;
 }
 
+/**
+ * 행렬 데이터 맞바꾸기
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::swap			(	BasicSparseMatrix2&		operand		///< 맞바꿀 행렬
+											)
+{
+	std::swap(mRowSize, operand.mRowSize);
+	std::swap(mColSize, operand.mColSize);
+	std::swap(mData, operand.mData);
+	std::swap(mPool, operand.mPool);
+}
+
+/**
+ * 행렬 x 단일 값 덧셈 (this = this + alpha * operand)
+ * 임시 행렬을 만들지 않고 자신의 행을 갱신한다.
+ * @return 연산 결과
+ */
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::axpy		(	elem_t					alpha,		///< 피연산자 계수
+														const BasicSparseMatrix2&	operand		///< 피연산자
+													)
+{
+	chkSameSize(operand);
+
+	updateElems(alpha, &operand, 1);
+
+	return	*this;
+}
+
+/**
+ * 행렬 x 단일 값 (this = alpha * this)
+ * @return 연산 결과
+ */
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::scale		(	elem_t		alpha	///< 곱할 값
+														)
+{
+	updateElems(0, NULL, alpha);
+
+	return	*this;
+}
+
+/**
+ * 행렬 x 단일 값 후 덧셈 (this = alpha * this + operand)
+ * @return 연산 결과
+ */
+template<class T, class R>
+const BasicSparseMatrix2<T, R>&		BasicSparseMatrix2<T, R>::scale_add	(	elem_t					alpha,		///< 자신에 곱할 값
+															const BasicSparseMatrix2&	operand		///< 피연산자
+														)
+{
+	chkSameSize(operand);
+
+	updateElems(1, &operand, alpha);
+
+	return	*this;
+}
+
+/**
+ * 선형 결합 (this = coef[0] * operand[0] + ... + coef[num-1] * operand[num-1])
+ * 행 별로 모든 피연산자의 행을 한 번에 더하여 결과 행과 맞바꾸므로,
+ * 자신이 피연산자이어도 된다.
+ * @exception 피연산자 크기가 다르거나 메모리 할당 실패 시 예외 발생
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::combine		(	size_t						num,		///< 항 수
+											const elem_t				coef[],		///< 항 별 계수
+											const BasicSparseMatrix2* const	operand[]	///< 항 별 피연산자
+										)
+{
+	size_t		work	=	operand[0]->getSize();
+
+	for(size_t cnt=1;cnt<num;++cnt)
+	{
+		operand[0]->chkSameSize(*operand[cnt]);
+
+		work	+=	operand[cnt]->getSize();
+	}
+
+	if( ( getRow() != operand[0]->getRow() ) ||
+		( getCol() != operand[0]->getCol() ) )
+	{
+		freeElems();
+		allocElems(operand[0]->getRow(), operand[0]->getCol());
+	}
+
+	if( ThreadPool::getInstance().isSerial(work) == true )
+	{
+		map_t	map(getAllocator());
+
+		for(size_t row=0;row<getRow();++row)
+		{
+			combineRow_(num, coef, operand, row, map);
+			mData[row].mMap.swap(map);
+		}
+	}
+	else
+	{
+		OpInfo		info;
+
+		info.termNum	=	num;
+		info.coef		=	coef;
+		info.terms		=	operand;
+		info.result		=	this;
+
+		doThreadFunc(FUNC_COMBINE, info);
+	}
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x)
+ * x는 getCol() 개, y는 getRow() 개의 연속 된 요소 배열이며, 메모리를 할당하지 않는다.
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::spmv		(	const elem_t	x[],	///< 입력 벡터
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	spmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y)
+ * beta가 0이면 y의 기존 값은 읽지 않는다.
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::spmv		(	elem_t			alpha,	///< 행렬 x 벡터 계수
+									const elem_t	x[],	///< 입력 벡터
+									elem_t			beta,	///< 결과 벡터 계수
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	spmvRows(alpha, x, beta, y, 0, getRow());
+}
+
+/**
+ * 행렬 x 벡터 (y = A * x, 쓰레드 사용)
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::pspmv		(	const elem_t	x[],	///< 입력 벡터
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	pspmv(1, x, 0, y);
+}
+
+/**
+ * 행렬 x 벡터 (y = alpha * A * x + beta * y, 쓰레드 사용)
+ * 행 단위로 나누어 쓰레드 풀에서 수행하며, 각 쓰레드는 자기 행의 y만 쓴다.
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::pspmv		(	elem_t			alpha,	///< 행렬 x 벡터 계수
+									const elem_t	x[],	///< 입력 벡터
+									elem_t			beta,	///< 결과 벡터 계수
+									elem_t			y[]		///< 결과 벡터
+								) const
+{
+	if( ThreadPool::getInstance().isSerial(getSize()) == true )
+	{
+		spmvRows(alpha, x, beta, y, 0, getRow());
+	}
+	else
+	{
+		OpInfo		info;
+
+		info.operandA		=	this;
+		info.elemOperandB	=	alpha;
+		info.vecX			=	x;
+		info.vecY			=	y;
+		info.beta			=	beta;
+
+		doThreadFunc(FUNC_SPMV, info);
+	}
+}
+
 /**
  * 행렬 방정식 해 계산
  * @return 해 계산 결과
  */
-SparseMatrix2		SparseMatrix2::sol_cg		(	const SparseMatrix2&	operand	///< 피연산자
+template<class T, class R>
+BasicSparseMatrix2<T, R>		BasicSparseMatrix2<T, R>::sol_cg		(	const BasicSparseMatrix2&	operand	///< 피연산자
 												)
 {
-	SparseMatrix2		x			=	SparseMatrix2(this->getCol(), operand.getCol());
-	SparseMatrix2		r			=	operand - ( (*this) * x );
-	SparseMatrix2		p			=	r;
-	SparseMatrix2		rSold		=	r.tmultiply(r);
-	SparseMatrix2		result		=	x;
-	elem_t		min			=	1000;
+	BasicSparseMatrix2		x			=	BasicSparseMatrix2(this->getCol(), operand.getCol());
+	BasicSparseMatrix2		r			=	operand - ( (*this) * x );
+	BasicSparseMatrix2		p			=	r;
+	BasicSparseMatrix2		ap;
+	BasicSparseMatrix2		result		=	x;
+	elem_t		rSold		=	r.tmultiply(r).getElem(0,0);
+	real_t		min			=	1000;
 	bool		foundFlag	=	false;
 
 	for(size_t cnt=0;cnt<1000000;cnt++)
 	{
-		SparseMatrix2	ap		=	(*this) * p;
-		elem_t			alpha	=	rSold.getElem(0,0) / (p.tmultiply(ap)).getElem(0,0);
+		ap		=	(*this) * p;
 
-		x	=	x + (p * alpha);
-		r	=	r - (ap * alpha);
+		elem_t			alpha	=	rSold / (p.tmultiply(ap)).getElem(0,0);
 
-		SparseMatrix2	rsNew	=	r.tmultiply(r);
+		x.axpy(alpha, p);
+		r.axpy(-alpha, ap);
 
-		elem_t		sqrtVal	=	sqrt(rsNew.getElem(0,0));
+		elem_t		rsNew	=	r.tmultiply(r).getElem(0,0);
+		real_t		sqrtVal	=	std::sqrt(std::abs(rsNew));
 
 		if( min > sqrtVal )
 		{
@@ -706,13 +847,13 @@ SparseMatrix2		SparseMatrix2::sol_cg		(	const SparseMatrix2&	operand	///< 피연
 			break;
 		}
 
-		p		=	r + ( p * (rsNew.getElem(0,0) / rSold.getElem(0,0) ) );
+		p.scale_add(rsNew / rSold, r);
 		rSold	=	rsNew;
 	}
 
 	if( foundFlag != true )
 	{
-		x	=	result;
+		x.swap(result);
 	}
 
 	return	x;
@@ -722,7 +863,8 @@ SparseMatrix2		SparseMatrix2::sol_cg		(	const SparseMatrix2&	operand	///< 피연
  * 행렬 데이터 공간 할당
  * @exception 메모리 할당 실패 시 에러 발생
  */
-void		SparseMatrix2::allocElems		(	size_t		row,	///< 행 크기
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::allocElems		(	size_t		row,	///< 행 크기
 												size_t		col		///< 열 크기
 											)
 {
@@ -731,7 +873,17 @@ void		SparseMatrix2::allocElems		(	size_t		row,	///< 행 크기
 		mRowSize	=	row;
 		mColSize	=	col;
 
+		if( mPool == NULL )
+		{
+			mPool	=	new NodePool;
+		}
+
 		mData	=	new map_node_t[row];
+
+		for(size_t cnt=0;cnt<row;++cnt)
+		{
+			map_t(getAllocator()).swap(mData[cnt].mMap);
+		}
 	}
 	catch (	std::bad_alloc&	exception		)
 	{
@@ -741,18 +893,26 @@ void		SparseMatrix2::allocElems		(	size_t		row,	///< 행 크기
 
 /**
  * 행렬 데이터 공간 할당 해제
+ * 행 노드 저장 공간은 모든 행을 해제한 뒤 한 번에 비운다.
  */
-void		SparseMatrix2::freeElems		(	void	)
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::freeElems		(	void	)
 {
 	delete[]	mData;
 	mRowSize	=	0;
 	mColSize	=	0;
+
+	if( mPool != NULL )
+	{
+		mPool->reset();
+	}
 }
 
 /**
  * 행렬 데이터 복사
  */
-void		SparseMatrix2::copyElems		(	const SparseMatrix2&		matrix		///< 복사 할 행렬
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::copyElems		(	const BasicSparseMatrix2&		matrix		///< 복사 할 행렬
 											)
 {
 	for(size_t row=0;row<getRow();++row)
@@ -765,10 +925,11 @@ void		SparseMatrix2::copyElems		(	const SparseMatrix2&		matrix		///< 복사 할
 /**
  * 쓰레드 행렬 데이터 복사
  */
-void		SparseMatrix2::pcopyElems		(	const SparseMatrix2&		matrix		///< 복사 할 행렬
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::pcopyElems		(	const BasicSparseMatrix2&		matrix		///< 복사 할 행렬
 												)
 {
-	if( getRow() < THREAD_FUNC_THRESHOLD )
+	if( ThreadPool::getInstance().isSerial(matrix.getSize()) == true )
 	{
 		for(size_t row=0;row<getRow();++row)
 		{
@@ -791,7 +952,8 @@ void		SparseMatrix2::pcopyElems		(	const SparseMatrix2&		matrix		///< 복사 할
  * 같은 크기의 행렬인지 검사
  * @exception 행렬이 같은 크기가 아닐 경우 예외 발생
  */
-void		SparseMatrix2::chkSameSize		(	const SparseMatrix2&		matrix		///< 비교 할 행렬
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::chkSameSize		(	const BasicSparseMatrix2&		matrix		///< 비교 할 행렬
 											) const
 {
 	if( ( getRow() != matrix.getRow() ) ||
@@ -801,11 +963,78 @@ void		SparseMatrix2::chkSameSize		(	const SparseMatrix2&		matrix		///< 비교 
 	}
 }
 
+/**
+ * 자신에 대한 갱신 (this = beta * this + alpha * operand)
+ * operand가 NULL이면 자신에 beta만 곱한다.
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::updateElems		(	elem_t					alpha,		///< 피연산자 계수
+												const BasicSparseMatrix2*	operand,	///< 피연산자
+												elem_t					beta		///< 자신에 곱할 값
+											)
+{
+	if( ThreadPool::getInstance().isSerial(getSize() + ( ( operand != NULL ) ? operand->getSize() : 0 )) == true )
+	{
+		for(size_t row=0;row<getRow();++row)
+		{
+			updateRow_	(	mData[row].mMap,
+							( operand != NULL ) ? &operand->mData[row].mMap : NULL,
+							alpha,
+							beta
+						);
+		}
+	}
+	else
+	{
+		OpInfo		info;
+
+		info.operandB		=	operand;
+		info.elemOperandB	=	alpha;
+		info.beta			=	beta;
+		info.result			=	this;
+
+		doThreadFunc(FUNC_AXPBY, info);
+	}
+}
+
+/**
+ * 지정한 범위의 행에 대한 행렬 x 벡터
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::spmvRows		(	elem_t			alpha,		///< 행렬 x 벡터 계수
+										const elem_t	x[],		///< 입력 벡터
+										elem_t			beta,		///< 결과 벡터 계수
+										elem_t			y[],		///< 결과 벡터
+										size_t			startRow,	///< 시작 행
+										size_t			endRow		///< 종료 행 (미포함)
+									) const
+{
+	for(size_t row=startRow;row<endRow;++row)
+	{
+		elem_t		sum		=	0;
+
+		for(elem_map_itor itor=mData[row].mMap.begin();itor!=mData[row].mMap.end();++itor)
+		{
+			sum		+=	itor->second * x[itor->first];
+		}
+
+		if( beta == elem_t(0) )
+		{
+			y[row]	=	alpha * sum;
+		}
+		else
+		{
+			y[row]	=	alpha * sum + beta * y[row];
+		}
+	}
+}
+
 /**
  * 행렬 요소 참조 범위 검사
  * @exception 참조 범위 밖일 경우 예외 발생
  */
-void		SparseMatrix2::chkBound			(	size_t		row,	///< 참조 할 행 위치
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::chkBound			(	size_t		row,	///< 참조 할 행 위치
 												size_t		col		///< 참조 할 열 위치
 											) const
 {
@@ -816,237 +1045,227 @@ void		SparseMatrix2::chkBound			(	size_t		row,	///< 참조 할 행 위치
 	}
 }
 
-void		SparseMatrix2::doThreadFunc		(	FuncKind	kind,
-												OpInfo&		info
-											) const
+/**
+ * 행 구간 나누기
+ * 연산이 읽는 행의 요소 수 (빈 행도 1로 센다)가 비슷하도록 나눈다.
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::splitRows	(	FuncKind		kind,		///< 연산 종류
+											const OpInfo&	info,		///< 연산 참조 데이터
+											size_t			partNum,	///< 구간 수
+											size_t			bound[]		///< 구간 별 시작 행 (partNum + 1 개)
+										) const
 {
-	FuncInfo		orgFuncInfo	=	{info, NULL, 0, 0};
-	FuncInfo		funcInfo[THREAD_NUM];
+	std::vector<size_t>		weight(getRow() + 1, 0);
 
-#if(PLATFORM == PLATFORM_WINDOWS)
+	for(size_t row=0;row<getRow();++row)
+	{
+		size_t		size	=	1;
 
-	HANDLE			id[THREAD_NUM];
+		switch( kind )
+		{
+		case FUNC_COPY:
+			size	+=	info.operandB->mData[row].mMap.size();
+			break;
+		case FUNC_AXPBY:
+			size	+=	mData[row].mMap.size();
 
-#elif(PLATFORM == PLATFORM_LINUX)
+			if( info.operandB != NULL )
+			{
+				size	+=	info.operandB->mData[row].mMap.size();
+			}
+			break;
+		case FUNC_COMBINE:
+			for(size_t cnt=0;cnt<info.termNum;++cnt)
+			{
+				size	+=	info.terms[cnt]->mData[row].mMap.size();
+			}
+			break;
+		default:
+			size	+=	mData[row].mMap.size();
+			break;
+		}
 
-	pthread_t		id[THREAD_NUM];
+		weight[row+1]	=	weight[row] + size;
+	}
 
-#endif
+	ThreadPool::splitRows(&weight[0], getRow(), partNum, bound);
+}
+
+/**
+ * 쓰레드 연산 시작
+ * 행 구간은 요소 수가 비슷하도록 나누며, 행 별 계산량이 피연산자 B에 따라 달라지는 곱셈은
+ * 구간을 조각으로 더 잘게 나누어 작업 훔치기로 수행한다.
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::doThreadFunc		(	FuncKind	kind,
+												OpInfo&		info
+											) const
+{
+	ThreadPool&				pool		=	ThreadPool::getInstance();
+	size_t					threadNum	=	pool.getTaskNum(getRow());
+	FuncInfo				orgFuncInfo	=	{info, NULL, 0, 0, NULL, NULL, 0};
+	bool					useChunk	=	false;
+	std::vector<FuncInfo>			funcInfo(threadNum);
+	std::vector<void*>				args(threadNum);
+	std::vector<THREAD_RETURN_TYPE>	retVal(threadNum);
 
 	switch( kind )
 	{
 	case FUNC_ADD:
-		orgFuncInfo.func	=	SparseMatrix2::threadAdd;
+		orgFuncInfo.func	=	BasicSparseMatrix2::threadAdd;
 		break;
 	case FUNC_SUB:
-		orgFuncInfo.func	=	SparseMatrix2::threadSub;
+		orgFuncInfo.func	=	BasicSparseMatrix2::threadSub;
 		break;
 	case FUNC_MULTIPLY:
-		orgFuncInfo.func	=	SparseMatrix2::threadMultiply;
+		orgFuncInfo.func	=	BasicSparseMatrix2::threadMultiply;
+		useChunk			=	true;
 		break;
 	case FUNC_ELEM_MUL:
-		orgFuncInfo.func	=	SparseMatrix2::threadElemMul;
-		break;
-	case FUNC_TMULTIPLY:
-		orgFuncInfo.func	=	SparseMatrix2::threadTmultiply;
-		break;
-	case FUNC_STMULTIPLY:
-		orgFuncInfo.func	=	SparseMatrix2::threadStmultiply;
+		orgFuncInfo.func	=	BasicSparseMatrix2::threadElemMul;
 		break;
 	case FUNC_COMPARE:
-		orgFuncInfo.func	=	SparseMatrix2::threadCompare;
+		orgFuncInfo.func	=	BasicSparseMatrix2::threadCompare;
+		break;
+	case FUNC_SPMV:
+		orgFuncInfo.func	=	BasicSparseMatrix2::threadSpmv;
 		break;
 	default:
 		break;
 	}
 
-	size_t		threadPerCol	=	getRow() / THREAD_NUM;
-	size_t		colMod			=	getRow() % THREAD_NUM;
-
-	for(size_t num=0;num<THREAD_NUM;num++)
-	{
-		funcInfo[num]	=	orgFuncInfo;
+	size_t					chunkNum	=	useChunk ? pool.getChunkNum(threadNum, getRow()) : threadNum;
+	std::vector<size_t>		bound(chunkNum + 1);
 
-		funcInfo[num].startCol	=	num * threadPerCol;
-		funcInfo[num].endCol		=	funcInfo[num].startCol + threadPerCol - 1;
-	}
+	splitRows(kind, info, chunkNum, &bound[0]);
 
-	funcInfo[THREAD_NUM-1].endCol	+=	colMod;
+	ChunkQueue				queue(threadNum, chunkNum);
 
-	// Thread ??
-	for(size_t num=0;num<THREAD_NUM;num++)
+	for(size_t num=0;num<threadNum;num++)
 	{
-#if(PLATFORM == PLATFORM_WINDOWS)
-
-		id[num]	=	(HANDLE)_beginthreadex	(	NULL,
-												0,
-												SparseMatrix2::threadFunc,
-												&funcInfo[num],
-												0,
-												NULL
-											);
-
-#elif(PLATFORM == PLATFORM_LINUX)
-
-		pthread_create	(	&id[num],
-								NULL,
-								SparseMatrix2::threadFunc,
-								&funcInfo[num]
-							);
-
-#endif
+		funcInfo[num]	=	orgFuncInfo;
 
-	}
+		funcInfo[num].startCol	=	bound[num];
+		funcInfo[num].endCol		=	bound[num+1] - 1;
 
-	for(size_t num=0;num<THREAD_NUM;num++)
-	{
-		switch( kind )
+		if( useChunk == true )
 		{
-		case FUNC_COMPARE:
-			{
-				THREAD_RETURN_TYPE	retVal		=	(THREAD_RETURN_TYPE)FALSE;
-
-				info.retVal		=	(THREAD_RETURN_TYPE)TRUE;
-
-#if(PLATFORM == PLATFORM_WINDOWS)
-
-				::WaitForSingleObjectEx	(	id[num],
-											INFINITE,
-											FALSE
-										);
-
-				::GetExitCodeThread(id[num], (LPDWORD)&retVal);
-
-				::CloseHandle(id[num]);
-
-#elif(PLATFORM == PLATFORM_LINUX)
-
-				pthread_join(id[num], &retVal);
-
-#endif
-
-				info.retVal	=	(THREAD_RETURN_TYPE)((unsigned long)info.retVal & (unsigned long)retVal);
-			}
-			break;
-		default:
-
-#if(PLATFORM == PLATFORM_WINDOWS)
-
-			::WaitForSingleObjectEx	(	id[num],
-										INFINITE,
-										FALSE
-									);
-			::CloseHandle(id[num]);
+			funcInfo[num].queue			=	&queue;
+			funcInfo[num].chunkStart	=	&bound[0];
+			funcInfo[num].task			=	num;
+		}
 
-#elif(PLATFORM == PLATFORM_LINUX)
+		args[num]		=	&funcInfo[num];
+	}
 
-			pthread_join(id[num], NULL);
+	// 쓰레드 풀에서 수행
+	pool.execute	(	BasicSparseMatrix2::threadFunc,
+						&args[0],
+						&retVal[0],
+						threadNum
+					);
 
-#endif
+	if( kind == FUNC_COMPARE )
+	{
+		info.retVal		=	(THREAD_RETURN_TYPE)TRUE;
 
-			break;
+		for(size_t num=0;num<threadNum;num++)
+		{
+			info.retVal	=	(THREAD_RETURN_TYPE)((unsigned long)info.retVal & (unsigned long)retVal[num]);
 		}
 	}
 }
 
-void		SparseMatrix2::doThreadFunc		(	FuncKind	kind,
+/**
+ * 쓰레드 연산 시작
+ * 행 구간은 요소 수가 비슷하도록 나눈다.
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::doThreadFunc		(	FuncKind	kind,
 												OpInfo&		info
 											)
 {
-	FuncInfo		orgFuncInfo	=	{info, NULL, 0, 0};
-	FuncInfo		funcInfo[THREAD_NUM];
-
-#if(PLATFORM == PLATFORM_WINDOWS)
-
-	HANDLE			id[THREAD_NUM];
-
-#elif(PLATFORM == PLATFORM_LINUX)
-
-	pthread_t		id[THREAD_NUM];
-
-#endif
+	ThreadPool&				pool		=	ThreadPool::getInstance();
+	size_t					threadNum	=	pool.getTaskNum(getRow());
+	FuncInfo				orgFuncInfo	=	{info, NULL, 0, 0, NULL, NULL, 0};
+	std::vector<FuncInfo>	funcInfo(threadNum);
+	std::vector<void*>		args(threadNum);
 
 	switch( kind )
 	{
 	case FUNC_COPY:
-		orgFuncInfo.func	=	SparseMatrix2::threadCopy;
+		orgFuncInfo.func	=	BasicSparseMatrix2::threadCopy;
+		break;
+	case FUNC_AXPBY:
+		orgFuncInfo.func	=	BasicSparseMatrix2::threadAxpby;
+		break;
+	case FUNC_COMBINE:
+		orgFuncInfo.func	=	BasicSparseMatrix2::threadCombine;
 		break;
 	default:
 		break;
 	}
 
-	size_t		threadPerCol	=	getRow() / THREAD_NUM;
-	size_t		colMod			=	getRow() % THREAD_NUM;
+	std::vector<size_t>		bound(threadNum + 1);
+
+	splitRows(kind, info, threadNum, &bound[0]);
 
-	for(size_t num=0;num<THREAD_NUM;num++)
+	for(size_t num=0;num<threadNum;num++)
 	{
 		funcInfo[num]	=	orgFuncInfo;
 
-		funcInfo[num].startCol	=	num * threadPerCol;
-		funcInfo[num].endCol		=	funcInfo[num].startCol + threadPerCol - 1;
-	}
-
-	funcInfo[THREAD_NUM-1].endCol	+=	colMod;
-
-	// Thread ??
-	for(size_t num=0;num<THREAD_NUM;num++)
-	{
-#if(PLATFORM == PLATFORM_WINDOWS)
+		funcInfo[num].startCol	=	bound[num];
+		funcInfo[num].endCol		=	bound[num+1] - 1;
 
-		id[num]	=	(HANDLE)_beginthreadex	(	NULL,
-												0,
-												SparseMatrix2::threadFunc,
-												&funcInfo[num],
-												0,
-												NULL
-											);
+		args[num]		=	&funcInfo[num];
+	}
 
-#elif(PLATFORM == PLATFORM_LINUX)
+	// 쓰레드 풀에서 수행
+	pool.execute	(	BasicSparseMatrix2::threadFunc,
+						&args[0],
+						NULL,
+						threadNum
+					);
+}
 
-		pthread_create	(	&id[num],
-								NULL,
-								SparseMatrix2::threadFunc,
-								&funcInfo[num]
-							);
+/**
+ * 작업 쓰레드 함수
+ * 조각 큐가 있으면 남은 조각이 없을 때까지 조각을 가져와 그 행 구간을 수행한다.
+ */
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadFunc		(	void*	pData	)
+{
+	FuncInfo*	info	=	(FuncInfo*)pData;
+	size_t		chunk	=	0;
 
-#endif
+	if( info->queue == NULL )
+	{
+		return	info->func(info);
 	}
 
-	for(size_t num=0;num<THREAD_NUM;num++)
+	while( info->queue->pop(info->task, chunk) == true )
 	{
-#if(PLATFORM == PLATFORM_WINDOWS)
-
-		::WaitForSingleObjectEx	(	id[num],
-									INFINITE,
-									FALSE
-								);
-		::CloseHandle(id[num]);
+		info->startCol	=	info->chunkStart[chunk];
+		info->endCol	=	info->chunkStart[chunk+1] - 1;
 
-#elif(PLATFORM == PLATFORM_LINUX)
-
-		pthread_join(id[num], NULL);
-
-#endif
+		info->func(info);
 	}
-}
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadFunc		(	void*	pData	)
-{
-	FuncInfo*	info	=	(FuncInfo*)pData;
-
-	return	info->func(info);
+	return	NULL;
 }
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadAdd		(	void*	pData	)
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadAdd		(	void*	pData	)
 {
 	FuncInfo*	info	=	(FuncInfo*)pData;
 	size_t		start	=	info->startCol;
 	size_t		end		=	info->endCol;
 	size_t		range	=	end - start;
 
-	const SparseMatrix2&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix2&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix2&			result		=	*info->opInfo.result;
+	const BasicSparseMatrix2&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix2&	operandB	=	*info->opInfo.operandB;
+	BasicSparseMatrix2&			result		=	*info->opInfo.result;
 
 	map_node_t*	nodeA	=	&operandA.mData[start];
 	map_node_t*	nodeB	=	&operandB.mData[start];
@@ -1066,7 +1285,7 @@ THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadAdd		(	void*	pData	)
 		{
 			elem_t		val		=	nodeRet[row].mMap[itor->first] + itor->second;
 
-			if( val != 0 )
+			if( val != elem_t(0) )
 			{
 				nodeRet[row].mMap[itor->first]	=	val;
 			}
@@ -1080,16 +1299,17 @@ THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadAdd		(	void*	pData	)
 	return		NULL;
 }
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadSub			(	void*	pData	)
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadSub			(	void*	pData	)
 {
 	FuncInfo*	info	=	(FuncInfo*)pData;
 	size_t		start	=	info->startCol;
 	size_t		end		=	info->endCol;
 	size_t		range	=	end - start;
 
-	const SparseMatrix2&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix2&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix2&			result		=	*info->opInfo.result;
+	const BasicSparseMatrix2&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix2&	operandB	=	*info->opInfo.operandB;
+	BasicSparseMatrix2&			result		=	*info->opInfo.result;
 
 	map_node_t*	nodeA	=	&operandA.mData[start];
 	map_node_t*	nodeB	=	&operandB.mData[start];
@@ -1109,7 +1329,7 @@ THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadSub			(	void*	pData	)
 		{
 			elem_t		val		=	nodeRet[row].mMap[itor->first] - itor->second;
 
-			if( val != 0 )
+			if( val != elem_t(0) )
 			{
 				nodeRet[row].mMap[itor->first]	=	val;
 			}
@@ -1123,16 +1343,17 @@ THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadSub			(	void*	pData	)
 	return		NULL;
 }
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadMultiply	(	void*	pData	)
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadMultiply	(	void*	pData	)
 {
 	FuncInfo*	info	=	(FuncInfo*)pData;
 	size_t		start	=	info->startCol;
 	size_t		end		=	info->endCol;
 	size_t		range	=	end - start;
 
-	const SparseMatrix2&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix2&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix2&			result		=	*info->opInfo.result;
+	const BasicSparseMatrix2&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix2&	operandB	=	*info->opInfo.operandB;
+	BasicSparseMatrix2&			result		=	*info->opInfo.result;
 
 	map_node_t*	nodeA	=	&operandA.mData[start];
 	map_node_t*	nodeB	=	operandB.mData;
@@ -1148,7 +1369,7 @@ THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadMultiply	(	void*	pData
 				{
 					elem_t		val		=	nodeRet[row].mMap[itor2->first] + (itor->second * itor2->second);
 
-					if( val != 0 )
+					if( val != elem_t(0) )
 					{
 						nodeRet[row].mMap[itor2->first]	=	val;
 					}
@@ -1169,16 +1390,17 @@ THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadMultiply	(	void*	pData
 	return	NULL;
 }
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadElemMul		(	void*	pData	)
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadElemMul		(	void*	pData	)
 {
 	FuncInfo*	info	=	(FuncInfo*)pData;
 	size_t		start	=	info->startCol;
 	size_t		end		=	info->endCol;
 	size_t		range	=	end - start;
 
-	const SparseMatrix2&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix2&	operandA	=	*info->opInfo.operandA;
 	elem_t					operandB	=	info->opInfo.elemOperandB;
-	SparseMatrix2&			result		=	*info->opInfo.result;
+	BasicSparseMatrix2&			result		=	*info->opInfo.result;
 
 	map_node_t*	nodeA	=	&operandA.mData[start];
 	map_node_t*	nodeRet	=	&result.mData[start];
@@ -1191,7 +1413,7 @@ THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadElemMul		(	void*	pData
 			{
 				elem_t		val			=	itor->second * operandB;
 
-				if( val != 0 )
+				if( val != elem_t(0) )
 				{
 					nodeRet[row].mMap[itor->first]	=	val;
 				}
@@ -1211,166 +1433,240 @@ THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadElemMul		(	void*	pData
 	return	NULL;
 }
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadTmultiply	(	void*	pData	)
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadCopy			(	void*	pData	)
 {
 	FuncInfo*	info	=	(FuncInfo*)pData;
 	size_t		start	=	info->startCol;
 	size_t		end		=	info->endCol;
 	size_t		range	=	end - start;
 
-	const SparseMatrix2&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix2&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix2&			result		=	*info->opInfo.result;
+	const BasicSparseMatrix2&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix2&	operandB	=	*info->opInfo.operandB;
 
 	map_node_t*	nodeA	=	&operandA.mData[start];
 	map_node_t*	nodeB	=	&operandB.mData[start];
-	map_node_t*	nodeRet	=	result.mData;
 
 	for(size_t row=0;row<=range;++row)
 	{
-		for(elem_map_itor itor=nodeA[row].mMap.begin();itor!=nodeA[row].mMap.end();++itor)
-		{
-			for(elem_map_itor itor2=nodeB[row].mMap.begin();itor2!=nodeB[row].mMap.end();itor2++)
-			{
-				LOCK(&nodeRet[itor->first].mLock);
+		nodeA[row].mMap	=	nodeB[row].mMap;
+	}
 
-				try
-				{
-					elem_t		val		=	nodeRet[itor->first].mMap[itor2->first] + (itor->second * itor2->second);
+	return	NULL;
+}
 
-					if( val != 0 )
-					{
-						nodeRet[itor->first].mMap[itor2->first]	=	val;
-					}
-					else
-					{
-						//printf("데이터가 0\n");
-						nodeRet[itor->first].mMap.erase(itor2->first);
-					}
-				}
-				catch( std::out_of_range&	)
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadCompare		(	void*	pData	)
+{
+	THREAD_RETURN_TYPE	flag		=	(THREAD_RETURN_TYPE)TRUE;
+	FuncInfo*			info		=	(FuncInfo*)pData;
+	size_t				start		=	info->startCol;
+	size_t				end			=	info->endCol;
+	size_t				range		=	end - start;
+
+	const BasicSparseMatrix2&	operandA	=	*info->opInfo.operandA;
+	const BasicSparseMatrix2&	operandB	=	*info->opInfo.operandB;
+
+	map_node_t*			nodeA		=	&operandA.mData[start];
+	map_node_t*			nodeB		=	&operandB.mData[start];
+
+	try
+	{
+		for(size_t row=0;row<=range;++row)
+		{
+			for(elem_map_itor itor=nodeA[row].mMap.begin();itor!=nodeA[row].mMap.end();++itor)
+			{
+				if( itor->second != nodeB[row].mMap.at(itor->first) )
 				{
-					printf("범위 초과\n");
+					flag	=	(THREAD_RETURN_TYPE)FALSE;
+					break;
 				}
+			}
 
-				UNLOCK(&nodeRet[itor->first].mLock);
+			if( flag == (THREAD_RETURN_TYPE)FALSE )
+			{
+				break;
 			}
 		}
 	}
+	catch( std::out_of_range&	)
+	{
+		flag	=	(THREAD_RETURN_TYPE)FALSE;
+	}
+
+	return	(THREAD_RETURN_TYPE)flag;
+}
+
+/**
+ * 지정한 범위의 행에 대한 행렬 x 벡터
+ * return 항상 NULL을 리턴
+ */
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadSpmv		(	void*	pData	)
+{
+	FuncInfo*		info		=	(FuncInfo*)pData;
+	const BasicSparseMatrix2::OpInfo&	opInfo	=	info->opInfo;
+
+	opInfo.operandA->spmvRows	(	opInfo.elemOperandB,
+									opInfo.vecX,
+									opInfo.beta,
+									opInfo.vecY,
+									info->startCol,
+									info->endCol + 1
+								);
 
 	return	NULL;
 }
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadStmultiply	(	void*	pData	)
+/**
+ * 지정한 범위의 행에 대한 자신의 갱신 (this = beta * this + alpha * operand)
+ * return 항상 NULL을 리턴
+ */
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadAxpby		(	void*	pData	)
 {
 	FuncInfo*	info	=	(FuncInfo*)pData;
 	size_t		start	=	info->startCol;
 	size_t		end		=	info->endCol;
-	size_t		range	=	end - start;
 
-	const SparseMatrix2&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix2&	operandB	=	*info->opInfo.operandB;
-	SparseMatrix2&			result		=	*info->opInfo.result;
+	const BasicSparseMatrix2*	operand		=	info->opInfo.operandB;
+	BasicSparseMatrix2&			result		=	*info->opInfo.result;
 
-	map_node_t*	nodeA	=	&operandA.mData[start];
-	map_node_t*	nodeB	=	&operandB.mData[start];
-	map_node_t*	nodeRet	=	result.mData;
-
-	for(size_t row=0;row<=range;++row)
+	for(size_t row=start;row<=end;++row)
 	{
-		for(elem_map_itor itor=nodeA[row].mMap.begin();itor!=nodeA[row].mMap.end();++itor)
-		{
-			for(elem_map_itor itor2=nodeB[row].mMap.begin();itor2!=nodeB[row].mMap.end();itor2++)
-			{
-				LOCK(&nodeRet[itor->first].mLock);
-
-				try
-				{
-					elem_t		val		=	nodeRet[itor->first].mMap[itor2->first] + (itor->second * itor2->second);
-
-					if( val != 0 )
-					{
-						nodeRet[itor->first].mMap[itor2->first]	=	val;
-					}
-					else
-					{
-						//printf("데이터가 0\n");
-						nodeRet[itor->first].mMap.erase(itor2->first);
-					}
-				}
-				catch( std::out_of_range&	)
-				{
-					printf("범위 초과\n");
-				}
-
-				UNLOCK(&nodeRet[itor->first].mLock);
-			}
-		}
+		updateRow_	(	result.mData[row].mMap,
+						( operand != NULL ) ? &operand->mData[row].mMap : NULL,
+						info->opInfo.elemOperandB,
+						info->opInfo.beta
+					);
 	}
 
 	return	NULL;
 }
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadCopy			(	void*	pData	)
+/**
+ * 지정한 범위의 행에 대한 선형 결합
+ * return 항상 NULL을 리턴
+ */
+template<class T, class R>
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	BasicSparseMatrix2<T, R>::threadCombine		(	void*	pData	)
 {
 	FuncInfo*	info	=	(FuncInfo*)pData;
 	size_t		start	=	info->startCol;
 	size_t		end		=	info->endCol;
-	size_t		range	=	end - start;
 
-	const SparseMatrix2&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix2&	operandB	=	*info->opInfo.operandB;
+	const BasicSparseMatrix2::OpInfo&	opInfo	=	info->opInfo;
+	BasicSparseMatrix2&					result	=	*opInfo.result;
 
-	map_node_t*	nodeA	=	&operandA.mData[start];
-	map_node_t*	nodeB	=	&operandB.mData[start];
+	map_t		map(result.getAllocator());
 
-	for(size_t row=0;row<=range;++row)
+	for(size_t row=start;row<=end;++row)
 	{
-		nodeA[row].mMap	=	nodeB[row].mMap;
+		combineRow_(opInfo.termNum, opInfo.coef, opInfo.terms, row, map);
+		result.mData[row].mMap.swap(map);
 	}
 
 	return	NULL;
 }
 
-THREAD_RETURN_TYPE THREAD_FUNC_TYPE	SparseMatrix2::threadCompare		(	void*	pData	)
+/**
+ * 한 행의 갱신 (mapA = beta * mapA + alpha * mapB)
+ * 결과가 0인 요소는 제거한다.
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::updateRow_		(	map_t&			mapA,	///< 갱신 할 행
+												const map_t*		mapB,	///< 더할 행 (NULL이면 없음)
+												elem_t								alpha,	///< 더할 행에 곱할 값
+												elem_t								beta	///< 갱신 할 행에 곱할 값
+											)
 {
-	THREAD_RETURN_TYPE	flag		=	(THREAD_RETURN_TYPE)TRUE;
-	FuncInfo*			info		=	(FuncInfo*)pData;
-	size_t				start		=	info->startCol;
-	size_t				end			=	info->endCol;
-	size_t				range		=	end - start;
+	if( beta == elem_t(0) )
+	{
+		mapA.clear();
+	}
+	else if( beta != elem_t(1) )
+	{
+		typename map_t::iterator	itor	=	mapA.begin();
 
-	const SparseMatrix2&	operandA	=	*info->opInfo.operandA;
-	const SparseMatrix2&	operandB	=	*info->opInfo.operandB;
+		while( itor != mapA.end() )
+		{
+			itor->second	*=	beta;
 
-	map_node_t*			nodeA		=	&operandA.mData[start];
-	map_node_t*			nodeB		=	&operandB.mData[start];
+			if( itor->second == elem_t(0) )
+			{
+				itor	=	mapA.erase(itor);
+			}
+			else
+			{
+				++itor;
+			}
+		}
+	}
 
-	try
+	if( ( mapB == NULL ) ||
+		( alpha == elem_t(0) ) )
 	{
-		for(size_t row=0;row<=range;++row)
+		return;
+	}
+
+	for(elem_map_itor itorB=mapB->begin();itorB!=mapB->end();++itorB)
+	{
+		elem_t		val		=	alpha * itorB->second;
+
+		if( val == elem_t(0) )
 		{
-			for(elem_map_itor itor=nodeA[row].mMap.begin();itor!=nodeA[row].mMap.end();++itor)
-			{
-				if( itor->second != nodeB[row].mMap.at(itor->first) )
-				{
-					flag	=	(THREAD_RETURN_TYPE)FALSE;
-					break;
-				}
-			}
+			continue;
+		}
+
+		// 없는 열이면 추가하고, 있으면 더한다.
+		std::pair<typename map_t::iterator, bool>		ret		=	mapA.insert(std::make_pair(itorB->first, val));
+
+		if( ret.second == false )
+		{
+			ret.first->second	+=	val;
 
-			if( flag == false )
+			if( ret.first->second == elem_t(0) )
 			{
-				break;
+				mapA.erase(ret.first);
 			}
 		}
 	}
-	catch( std::out_of_range&	)
+}
+
+/**
+ * 한 행의 선형 결합 (result = coef[0] * operand[0]의 행 + ...)
+ * 결과가 0인 요소는 제거한다.
+ */
+template<class T, class R>
+void		BasicSparseMatrix2<T, R>::combineRow_		(	size_t								num,		///< 항 수
+												const elem_t						coef[],		///< 항 별 계수
+												const BasicSparseMatrix2* const			operand[],	///< 항 별 피연산자
+												size_t								row,		///< 계산 할 행
+												map_t&			result		///< 결과 행
+											)
+{
+	result.clear();
+
+	for(size_t cnt=0;cnt<num;++cnt)
 	{
-		flag	=	(THREAD_RETURN_TYPE)FALSE;
+		updateRow_(result, &operand[cnt]->mData[row].mMap, coef[cnt], 1);
 	}
-
-	return	(THREAD_RETURN_TYPE)flag;
 }
 
+/////////////////////////////
+// 요소 / 행 형식 별 명시적 인스턴스
+
+template class	BasicSparseMatrix2< float >;
+template class	BasicSparseMatrix2< double >;
+template class	BasicSparseMatrix2< std::complex<float> >;
+template class	BasicSparseMatrix2< std::complex<double> >;
+template class	BasicSparseMatrix2< float, SortedRow<float> >;
+template class	BasicSparseMatrix2< double, SortedRow<double> >;
+template class	BasicSparseMatrix2< std::complex<float>, SortedRow< std::complex<float> > >;
+template class	BasicSparseMatrix2< std::complex<double>, SortedRow< std::complex<double> > >;
+template class	BasicSparseMatrix2< float, HashRow<float> >;
+template class	BasicSparseMatrix2< double, HashRow<double> >;
+template class	BasicSparseMatrix2< std::complex<float>, HashRow< std::complex<float> > >;
+template class	BasicSparseMatrix2< std::complex<double>, HashRow< std::complex<double> > >;
+
 };
@@ -0,0 +1,799 @@
+/*
+ * thread_pool.cpp
+ *
+ *  Created on: 2015. 7. 20.
+ *      Author: asran
+ */
+
+#include "thread_pool.h"
+#include "matrix_error.h"
+
+#include <stdlib.h>
+
+#if(PLATFORM == PLATFORM_LINUX)
+#include <unistd.h>
+#include <sched.h>
+#endif
+
+namespace matrix
+{
+
+/// 현재 쓰레드가 풀의 작업 쓰레드인지 여부
+/// 작업 쓰레드 안에서 다시 execute를 호출하면 교착 상태가 되므로 직접 수행한다.
+static thread_local bool	sInWorker	=	false;
+
+/**
+ * 생성자
+ */
+ThreadPool::ThreadPool		(	size_t		threadNum,	///< 동시에 계산하는 쓰레드 수 (0이면 CPU 코어 수)
+								bool		affinity,	///< 작업 쓰레드 CPU 고정 여부
+								size_t		threshold,	///< 쓰레드를 사용할 최소 작업 크기 (요소 수)
+								bool		firstTouch	///< 작업을 쓰레드에 고정 배정 (first touch 모드)
+							)
+:mThreadNum(( threadNum == 0 ) ? getCoreNum() : threadNum),
+ mWorkerNum(0),
+ mAffinity(affinity),
+ mThreshold(std::max(threshold, (size_t)1)),
+ mFirstTouch(firstTouch),
+ mExit(false),
+ mFunc(NULL),
+ mArgs(NULL),
+ mRetVal(NULL),
+ mTaskNum(0),
+ mNextTask(0),
+ mRemainTask(0),
+ mJob(0),
+ mError(),
+ mWorkerInfo(NULL),
+ mThread(NULL)
+{
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	::InitializeCriticalSectionEx(&mSubmitLock, MAX_SPIN_COUNT, 0);
+	::InitializeCriticalSectionEx(&mLock, MAX_SPIN_COUNT, 0);
+	::InitializeConditionVariable(&mWorkCond);
+	::InitializeConditionVariable(&mDoneCond);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	pthread_mutex_init(&mSubmitLock, NULL);
+	pthread_mutex_init(&mLock, NULL);
+	pthread_cond_init(&mWorkCond, NULL);
+	pthread_cond_init(&mDoneCond, NULL);
+
+#endif
+
+	// 작업 쓰레드를 고정하기 전에 프로세스의 CPU 목록을 읽어 둔다.
+	getCpuList();
+
+	createThreads();
+}
+
+/**
+ * 소멸자
+ */
+ThreadPool::~ThreadPool		(	void	)
+{
+	destroyThreads();
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	::DeleteCriticalSection(&mSubmitLock);
+	::DeleteCriticalSection(&mLock);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	pthread_cond_destroy(&mDoneCond);
+	pthread_cond_destroy(&mWorkCond);
+	pthread_mutex_destroy(&mLock);
+	pthread_mutex_destroy(&mSubmitLock);
+
+#endif
+}
+
+/**
+ * 작업 수행
+ * taskNum 개의 작업을 작업 쓰레드에 나누어 수행하고, 모든 작업이 끝날 때까지 대기한다.
+ * 호출한 쓰레드도 남은 작업을 함께 수행한다.
+ * first touch 모드에서는 작업 num을 (num % 쓰레드 수)번 쓰레드가 수행한다.
+ * @exception 작업에서 예외가 발생하면 모든 작업이 끝난 후 처음 발생한 예외를 호출한 쓰레드에서 다시 발생
+ */
+void		ThreadPool::execute		(	Operation				func,		///< 작업 함수
+										void*					args[],		///< 작업 별 인자
+										THREAD_RETURN_TYPE		retVal[],	///< 작업 별 결과 (NULL 가능)
+										size_t					taskNum		///< 작업 수
+									)
+{
+	if( ( sInWorker == true ) ||
+		( mWorkerNum == 0 ) ||
+		( taskNum < 2 ) )
+	{
+		for(size_t num=0;num<taskNum;++num)
+		{
+			THREAD_RETURN_TYPE	ret		=	func(args[num]);
+
+			if( retVal != NULL )
+			{
+				retVal[num]		=	ret;
+			}
+		}
+
+		return;
+	}
+
+	LOCK(&mSubmitLock);
+	LOCK(&mLock);
+
+	mFunc			=	func;
+	mArgs			=	args;
+	mRetVal			=	retVal;
+	mTaskNum		=	taskNum;
+	mNextTask		=	0;
+	mRemainTask		=	taskNum;
+	mJob++;
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	::WakeAllConditionVariable(&mWorkCond);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	pthread_cond_broadcast(&mWorkCond);
+
+#endif
+
+	runTasks(0);
+
+	// 작업 인자는 호출한 쓰레드의 스택에 있으므로, 예외가 발생해도 모든 작업이 끝날 때까지 기다린다.
+	while( mRemainTask != 0 )
+	{
+		waitDone();
+	}
+
+	std::exception_ptr		error	=	mError;
+
+	mFunc			=	NULL;
+	mArgs			=	NULL;
+	mRetVal			=	NULL;
+	mTaskNum		=	0;
+	mNextTask		=	0;
+	mError			=	std::exception_ptr();
+
+	UNLOCK(&mLock);
+	UNLOCK(&mSubmitLock);
+
+	if( error != NULL )
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+/**
+ * 쓰레드 수 설정
+ * 기존 작업 쓰레드를 종료하고 새 수만큼 다시 생성한다.
+ * @exception 작업 쓰레드 안에서 호출하거나 메모리 할당 실패 시 에러 발생
+ */
+void		ThreadPool::setThreadNum		(	size_t		threadNum	///< 동시에 계산하는 쓰레드 수 (0이면 CPU 코어 수)
+											)
+{
+	if( sInWorker == true )
+	{
+		throw matrix::ErrMsg::createErrMsg("작업 쓰레드 안에서는 쓰레드 수를 바꿀 수 없습니다.");
+	}
+
+	if( threadNum == 0 )
+	{
+		threadNum	=	getCoreNum();
+	}
+
+	LOCK(&mSubmitLock);
+
+	try
+	{
+		if( threadNum != mThreadNum )
+		{
+			destroyThreads();
+
+			mThreadNum	=	threadNum;
+
+			createThreads();
+		}
+	}
+	catch( ErrMsg*	)
+	{
+		UNLOCK(&mSubmitLock);
+		throw;
+	}
+
+	UNLOCK(&mSubmitLock);
+}
+
+/**
+ * 작업 쓰레드 CPU 고정 여부 설정
+ * 고정하면 작업 쓰레드 num을 프로세스가 사용할 수 있는 CPU 중 (num + 1)번째 CPU에 고정한다. (첫 번째 CPU는 호출한 쓰레드 몫)
+ * 고정에 실패하면 고정하지 않은 상태로 남으며, getAffinity()가 false를 리턴한다.
+ */
+void		ThreadPool::setAffinity		(	bool		affinity	///< CPU 고정 여부
+										)
+{
+	LOCK(&mSubmitLock);
+
+	mAffinity	=	affinity;
+	applyAffinity();
+
+	UNLOCK(&mSubmitLock);
+}
+
+/**
+ * first touch 모드 설정
+ * 켜면 작업을 순서대로 가져가지 않고 작업 번호에 따라 정해진 쓰레드가 수행하여,
+ * 같은 행 분할을 쓰는 연산과 저장 공간 초기화가 매번 같은 쓰레드 (CPU 고정 시 같은 CPU)에서 수행된다.
+ */
+void		ThreadPool::setFirstTouch		(	bool		firstTouch	///< first touch 모드 여부
+											)
+{
+	LOCK(&mSubmitLock);
+
+	mFirstTouch		=	firstTouch;
+
+	UNLOCK(&mSubmitLock);
+}
+
+/**
+ * 쓰레드를 사용할 최소 작업 크기 설정
+ * 연산이 읽는 요소 수가 이 값보다 작으면 호출한 쓰레드에서 바로 수행한다.
+ */
+void		ThreadPool::setThreshold		(	size_t		threshold	///< 최소 작업 크기 (요소 수, 최소 1)
+											)
+{
+	mThreshold	=	std::max(threshold, (size_t)1);
+}
+
+/**
+ * 라이브러리 공용 쓰레드 풀 가져오기
+ * 최초 호출 시 환경 변수로 설정을 초기화 한다.
+ * MATRIX_NUM_THREADS (쓰레드 수, 기본 프로세스가 사용할 수 있는 CPU 수), MATRIX_THREAD_AFFINITY (0이 아니면 CPU 고정),
+ * MATRIX_THREAD_THRESHOLD (쓰레드를 사용할 최소 요소 수), MATRIX_FIRST_TOUCH (0이 아니면 first touch 모드)
+ * @return 쓰레드 풀 객체
+ */
+ThreadPool&		ThreadPool::getInstance		(	void	)
+{
+	static ThreadPool		pool	(	getEnvValue("MATRIX_NUM_THREADS", 0),
+										getEnvValue("MATRIX_THREAD_AFFINITY", 0) != 0,
+										getEnvValue("MATRIX_THREAD_THRESHOLD", DEFAULT_THRESHOLD),
+										getEnvValue("MATRIX_FIRST_TOUCH", 0) != 0
+									);
+
+	return	pool;
+}
+
+/**
+ * 사용 가능한 CPU 코어 수 가져오기
+ * 프로세스의 CPU 고정 (cpuset, taskset 등)으로 허용 된 CPU만 센다.
+ * @return CPU 코어 수 (최소 1)
+ */
+size_t		ThreadPool::getCoreNum		(	void	)
+{
+	return	getCpuList().size();
+}
+
+/**
+ * 프로세스가 사용할 수 있는 CPU 목록 가져오기
+ * 처음 호출할 때 읽은 목록을 저장해 두고 계속 사용하므로, 작업 쓰레드를 고정한 후에도 원래 목록이 유지된다.
+ * @return CPU 번호 목록 (오름차순, 최소 1 개)
+ */
+const std::vector<size_t>&	ThreadPool::getCpuList		(	void	)
+{
+	static const std::vector<size_t>	sCpuList	=	readCpuList();
+
+	return	sCpuList;
+}
+
+/**
+ * 프로세스가 사용할 수 있는 CPU 목록 읽기
+ * 목록을 읽을 수 없으면 온라인 CPU 수 만큼 0번부터 채운다.
+ * @return CPU 번호 목록 (오름차순, 최소 1 개)
+ */
+std::vector<size_t>		ThreadPool::readCpuList		(	void	)
+{
+	std::vector<size_t>		cpuList;
+	size_t					coreNum		=	1;
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	DWORD_PTR		processMask;
+	DWORD_PTR		systemMask;
+	SYSTEM_INFO		info;
+
+	if( ::GetProcessAffinityMask(::GetCurrentProcess(), &processMask, &systemMask) != 0 )
+	{
+		for(size_t cpu=0;cpu<sizeof(DWORD_PTR)*8;++cpu)
+		{
+			if( ( processMask & ( (DWORD_PTR)1 << cpu ) ) != 0 )
+			{
+				cpuList.push_back(cpu);
+			}
+		}
+	}
+
+	::GetSystemInfo(&info);
+	coreNum		=	info.dwNumberOfProcessors;
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	cpu_set_t		cpuSet;
+
+	CPU_ZERO(&cpuSet);
+
+	if( sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0 )
+	{
+		for(size_t cpu=0;cpu<CPU_SETSIZE;++cpu)
+		{
+			if( CPU_ISSET(cpu, &cpuSet) )
+			{
+				cpuList.push_back(cpu);
+			}
+		}
+	}
+
+	long	num		=	sysconf(_SC_NPROCESSORS_ONLN);
+
+	if( num > 0 )
+	{
+		coreNum		=	(size_t)num;
+	}
+
+#endif
+
+	if( cpuList.empty() == true )
+	{
+		for(size_t cpu=0;cpu<std::max(coreNum, (size_t)1);++cpu)
+		{
+			cpuList.push_back(cpu);
+		}
+	}
+
+	return	cpuList;
+}
+
+/**
+ * 환경 변수 값 가져오기
+ * @return 환경 변수의 0 이상 정수 값, 없거나 정수가 아니면 기본 값
+ */
+size_t		ThreadPool::getEnvValue		(	const char*		name,		///< 환경 변수 이름
+											size_t			defValue	///< 기본 값
+										)
+{
+	const char*		str		=	getenv(name);
+	char*			end		=	NULL;
+
+	if( ( str == NULL ) || ( *str == '\0' ) )
+	{
+		return	defValue;
+	}
+
+	long long		value	=	strtoll(str, &end, 10);
+
+	if( ( *end != '\0' ) || ( value < 0 ) )
+	{
+		return	defValue;
+	}
+
+	return	(size_t)value;
+}
+
+/**
+ * 작업 쓰레드 생성
+ * 호출한 쓰레드도 작업을 수행하므로 (쓰레드 수 - 1)개를 만든다.
+ * @exception 메모리 할당 실패 시 에러 발생
+ */
+void		ThreadPool::createThreads		(	void	)
+{
+	mExit		=	false;
+	mWorkerNum	=	mThreadNum - 1;
+
+	if( mWorkerNum == 0 )
+	{
+		return;
+	}
+
+	try
+	{
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+		mThread		=	new HANDLE[mWorkerNum];
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+		mThread		=	new pthread_t[mWorkerNum];
+
+#endif
+
+		mWorkerInfo	=	new WorkerInfo[mWorkerNum];
+	}
+	catch( std::bad_alloc&	exception	)
+	{
+		delete[]	mThread;
+		mThread		=	NULL;
+		mWorkerNum	=	0;
+
+		throw matrix::ErrMsg::createErrMsg(exception.what());
+	}
+
+	for(size_t num=0;num<mWorkerNum;++num)
+	{
+		mWorkerInfo[num].pool	=	this;
+		mWorkerInfo[num].id		=	num;
+		mWorkerInfo[num].job	=	mJob;
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+		mThread[num]	=	(HANDLE)_beginthreadex	(	NULL,
+														0,
+														ThreadPool::workerFunc,
+														&mWorkerInfo[num],
+														0,
+														NULL
+													);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+		pthread_create	(	&mThread[num],
+							NULL,
+							ThreadPool::workerFunc,
+							&mWorkerInfo[num]
+						);
+
+#endif
+	}
+
+	if( mAffinity == true )
+	{
+		applyAffinity();
+	}
+}
+
+/**
+ * 작업 쓰레드 CPU 고정 적용
+ * 작업 쓰레드 num은 프로세스가 사용할 수 있는 CPU 중 (num + 1)번째 CPU에 고정한다. (첫 번째 CPU는 호출한 쓰레드 몫)
+ * 고정하지 않으면 처음 읽은 프로세스의 CPU 목록 전체로 되돌린다.
+ * 고정에 실패한 쓰레드가 있으면 모든 작업 쓰레드의 고정을 풀고 mAffinity를 false로 바꾸므로,
+ * getAffinity()로 실제 고정 여부를 확인할 수 있다.
+ */
+void		ThreadPool::applyAffinity		(	void	)
+{
+	const std::vector<size_t>&	cpuList		=	getCpuList();
+	bool						failed		=	false;
+
+	for(size_t num=0;num<mWorkerNum;++num)
+	{
+		size_t		core	=	cpuList[( num + 1 ) % cpuList.size()];
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+		DWORD_PTR	mask	=	0;
+
+		if( mAffinity == true )
+		{
+			mask	=	(DWORD_PTR)1 << ( core % ( sizeof(DWORD_PTR) * 8 ) );
+		}
+		else
+		{
+			for(size_t cnt=0;cnt<cpuList.size();++cnt)
+			{
+				mask	|=	(DWORD_PTR)1 << ( cpuList[cnt] % ( sizeof(DWORD_PTR) * 8 ) );
+			}
+		}
+
+		if( ::SetThreadAffinityMask(mThread[num], mask) == 0 )
+		{
+			failed	=	true;
+		}
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+		cpu_set_t	cpuSet;
+
+		CPU_ZERO(&cpuSet);
+
+		if( mAffinity == true )
+		{
+			CPU_SET(core, &cpuSet);
+		}
+		else
+		{
+			for(size_t cnt=0;cnt<cpuList.size();++cnt)
+			{
+				CPU_SET(cpuList[cnt], &cpuSet);
+			}
+		}
+
+		if( pthread_setaffinity_np(mThread[num], sizeof(cpuSet), &cpuSet) != 0 )
+		{
+			failed	=	true;
+		}
+
+#endif
+	}
+
+	if( ( failed == true ) &&
+		( mAffinity == true ) )
+	{
+		mAffinity	=	false;
+		applyAffinity();
+	}
+}
+
+/**
+ * 작업 쓰레드 종료 및 제거
+ */
+void		ThreadPool::destroyThreads		(	void	)
+{
+	LOCK(&mLock);
+
+	mExit	=	true;
+
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	::WakeAllConditionVariable(&mWorkCond);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	pthread_cond_broadcast(&mWorkCond);
+
+#endif
+
+	UNLOCK(&mLock);
+
+	for(size_t num=0;num<mWorkerNum;++num)
+	{
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+		::WaitForSingleObjectEx	(	mThread[num],
+									INFINITE,
+									FALSE
+								);
+		::CloseHandle(mThread[num]);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+		pthread_join(mThread[num], NULL);
+
+#endif
+	}
+
+	delete[]	mThread;
+	delete[]	mWorkerInfo;
+	mThread		=	NULL;
+	mWorkerInfo	=	NULL;
+	mWorkerNum	=	0;
+}
+
+/**
+ * 남은 작업을 하나씩 가져와 수행
+ * first touch 모드에서는 executor번 쓰레드 몫의 작업만 수행한다.
+ * 작업에서 발생한 예외는 처음 것만 mError에 기록하고, 이후 작업은 수행하지 않고 완료 처리한다.
+ * mLock을 잡은 상태로 호출해야 하며, 리턴 시에도 mLock을 잡은 상태이다.
+ */
+void		ThreadPool::runTasks		(	size_t		executor	///< 쓰레드 번호 (0은 호출한 쓰레드, 작업 쓰레드 num은 num + 1)
+									)
+{
+	size_t		num		=	executor;
+
+	while( true )
+	{
+		if( mFirstTouch == false )
+		{
+			num		=	mNextTask++;
+		}
+
+		if( num >= mTaskNum )
+		{
+			break;
+		}
+
+		Operation				func	=	mFunc;
+		void*					arg		=	mArgs[num];
+		THREAD_RETURN_TYPE*		retVal	=	mRetVal;
+		bool					skip	=	( mError != NULL );
+		std::exception_ptr		error;
+
+		UNLOCK(&mLock);
+
+		try
+		{
+			if( skip == false )
+			{
+				THREAD_RETURN_TYPE		ret		=	func(arg);
+
+				if( retVal != NULL )
+				{
+					retVal[num]		=	ret;
+				}
+			}
+		}
+		catch( ... )
+		{
+			error	=	std::current_exception();
+		}
+
+		LOCK(&mLock);
+
+		if( ( error != NULL ) && ( mError == NULL ) )
+		{
+			mError	=	error;
+		}
+
+		if( --mRemainTask == 0 )
+		{
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+			::WakeAllConditionVariable(&mDoneCond);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+			pthread_cond_broadcast(&mDoneCond);
+
+#endif
+		}
+
+		num		+=	mThreadNum;
+	}
+}
+
+/**
+ * 새 작업 도착 대기
+ */
+void		ThreadPool::waitWork		(	void	)
+{
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	::SleepConditionVariableCS(&mWorkCond, &mLock, INFINITE);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	pthread_cond_wait(&mWorkCond, &mLock);
+
+#endif
+}
+
+/**
+ * 작업 완료 대기
+ */
+void		ThreadPool::waitDone		(	void	)
+{
+#if(PLATFORM == PLATFORM_WINDOWS)
+
+	::SleepConditionVariableCS(&mDoneCond, &mLock, INFINITE);
+
+#elif(PLATFORM == PLATFORM_LINUX)
+
+	pthread_cond_wait(&mDoneCond, &mLock);
+
+#endif
+}
+
+/**
+ * 작업 쓰레드 함수
+ * 새 작업이 요청되면 남은 작업 (first touch 모드에서는 자기 몫의 작업)을 수행하고, 다시 대기한다.
+ * return 항상 NULL을 리턴
+ */
+THREAD_RETURN_TYPE THREAD_FUNC_TYPE	ThreadPool::workerFunc		(	void*	pData	)
+{
+	WorkerInfo*		info	=	(WorkerInfo*)pData;
+	ThreadPool*		pool	=	info->pool;
+
+	sInWorker	=	true;
+
+	LOCK(&pool->mLock);
+
+	while( pool->mExit == false )
+	{
+		if( info->job != pool->mJob )
+		{
+			info->job	=	pool->mJob;
+			pool->runTasks(info->id + 1);
+		}
+		else
+		{
+			pool->waitWork();
+		}
+	}
+
+	UNLOCK(&pool->mLock);
+
+	return	0;
+}
+
+/**
+ * 생성자
+ * 조각 chunkNum 개를 작업 taskNum 개에 연속 구간으로 배정한다.
+ */
+ChunkQueue::ChunkQueue		(	size_t		taskNum,	///< 작업 수
+								size_t		chunkNum	///< 조각 수 (2^32 미만)
+							)
+:mRange(taskNum)
+{
+	for(size_t task=0;task<taskNum;++task)
+	{
+		uint64_t	front	=	chunkNum * task / taskNum;
+		uint64_t	back	=	chunkNum * (task + 1) / taskNum;
+
+		mRange[task].store(( front << 32 ) | back);
+	}
+}
+
+/**
+ * 조각 가져오기
+ * 자기 구간의 앞에서 가져오고, 비어 있으면 다음 작업부터 차례로 구간의 뒤에서 훔쳐온다.
+ * 조각은 새로 추가되지 않으므로, 모든 구간이 비어 있으면 작업이 끝난 것이다.
+ * @return 가져온 조각이 있으면 true, 남은 조각이 없으면 false
+ */
+bool		ChunkQueue::pop		(	size_t		task,	///< 작업 번호
+									size_t&		chunk	///< 가져온 조각 번호
+								)
+{
+	if( popFront(task, chunk) == true )
+	{
+		return	true;
+	}
+
+	for(size_t cnt=1;cnt<mRange.size();++cnt)
+	{
+		if( popBack(( task + cnt ) % mRange.size(), chunk) == true )
+		{
+			return	true;
+		}
+	}
+
+	return	false;
+}
+
+/**
+ * 구간의 앞에서 조각 가져오기
+ * @return 가져온 조각이 있으면 true
+ */
+bool		ChunkQueue::popFront		(	size_t		task,	///< 구간 작업 번호
+											size_t&		chunk	///< 가져온 조각 번호
+										)
+{
+	uint64_t	range	=	mRange[task].load();
+
+	while( ( range >> 32 ) < ( range & 0xFFFFFFFF ) )
+	{
+		if( mRange[task].compare_exchange_weak(range, range + ( (uint64_t)1 << 32 )) == true )
+		{
+			chunk	=	(size_t)( range >> 32 );
+
+			return	true;
+		}
+	}
+
+	return	false;
+}
+
+/**
+ * 구간의 뒤에서 조각 가져오기
+ * @return 가져온 조각이 있으면 true
+ */
+bool		ChunkQueue::popBack		(	size_t		task,	///< 구간 작업 번호
+										size_t&		chunk	///< 가져온 조각 번호
+									)
+{
+	uint64_t	range	=	mRange[task].load();
+
+	while( ( range >> 32 ) < ( range & 0xFFFFFFFF ) )
+	{
+		if( mRange[task].compare_exchange_weak(range, range - 1) == true )
+		{
+			chunk	=	(size_t)( range & 0xFFFFFFFF ) - 1;
+
+			return	true;
+		}
+	}
+
+	return	false;
+}
+
+};
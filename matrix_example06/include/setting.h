@@ -25,7 +25,7 @@
 #include "matrix_csr.h"
 typedef	matrix::MatrixCSR			matrix_t;
 
-#define	TEST_MULTI_THREAD			(0)
+#define	TEST_MULTI_THREAD			(1)
 
 #endif
 
@@ -8,6 +8,8 @@
  */
 
 #include <matrix_error.h>
+#include <matrix_builder.h>
+#include <matrix_file.h>
 #include <cmath>
 #include <unistd.h>
 #include <stdio.h>
@@ -39,37 +41,61 @@ int		main	(	int		argc,
 
 		size_t		matrix_size	=	atol(argv[2]);
 
-		// 객체 선언
-		printf("Matrix data file open - %s\n", matrix_file_name);
-		FILE*	matrixFile		=	fopen(matrix_file_name, "r");			// A data file
-
-		// matrix 데이터 파일 여는 데 실패하면 예외 던짐.
-		if( matrixFile == NULL )
-		{
-			throw	matrix::ErrMsg::createErrMsg("파일 열기 실패");
-		}
-
 		initUsage	=	test::Test::calcMemUsage();
 		printf("init  : %09lu\n", initUsage);
 
-		matrix_t		matrixA(matrix_size, matrix_size);		// A data matrix
+		matrix_t				matrixA(matrix_size, matrix_size);		// A data matrix
 
-		// 데이터 넣기
-		printf("Input matrix data from matrix data file...\n");
-		for(size_t row=0;row<matrix_size;++row)
+#ifdef	MATRIX_CSR
+		// 이진 CSR 파일은 텍스트를 읽지 않고 파일을 매핑하여 바로 사용한다.
+		if( matrix::MatrixFile::isCSRFile(matrix_file_name) )
+		{
+			printf("Map binary CSR file - %s\n", matrix_file_name);
+			matrix::MatrixFile::loadCSR(matrixA, matrix_file_name);
+		}
+		else
+#endif
+		// Matrix Market 파일은 파일 크기 정보를 사용하여 바로 읽는다.
+		if( ( strlen(matrix_file_name) > 4 ) &&
+			( strcmp(matrix_file_name + strlen(matrix_file_name) - 4, ".mtx") == 0 ) )
 		{
-			for(size_t col=0;col<matrix_size;++col)
+			printf("Read Matrix Market file - %s\n", matrix_file_name);
+			matrix::MatrixFile::readMtx(matrixA, matrix_file_name);
+		}
+		else
+		{
+			// 객체 선언
+			printf("Matrix data file open - %s\n", matrix_file_name);
+			FILE*	matrixFile		=	fopen(matrix_file_name, "r");			// A data file
+
+			// matrix 데이터 파일 여는 데 실패하면 예외 던짐.
+			if( matrixFile == NULL )
 			{
-				double	value	=	0.0;
+				throw	matrix::ErrMsg::createErrMsg("파일 열기 실패");
+			}
 
-				if( fscanf(matrixFile, "%lf", &value) != 0 )
+			matrix::MatrixBuilder	builderA(matrix_size, matrix_size);	// A data 요소 모음
+
+			// 데이터 넣기
+			printf("Input matrix data from matrix data file...\n");
+			for(size_t row=0;row<matrix_size;++row)
+			{
+				for(size_t col=0;col<matrix_size;++col)
 				{
-					if( value != 0.0 )
+					double	value	=	0.0;
+
+					if( fscanf(matrixFile, "%lf", &value) != 0 )
 					{
-						matrixA.setElem(row, col, value);
+						if( value != 0.0 )
+						{
+							builderA.addElem(row, col, value);
+						}
 					}
 				}
 			}
+
+			fclose(matrixFile);
+			builderA.build(matrixA);
 		}
 
 		dataAUsage	=	test::Test::calcMemUsage() - initUsage;